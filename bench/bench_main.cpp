@@ -0,0 +1,299 @@
+/**
+* @file bench_main.cpp
+*
+* @brief `eser_bench`: encode/decode throughput of `eser::flat` against a raw `memcpy` baseline
+*        and a hand-written `htonl`-style codec.
+*
+* Usage: `eser_bench [filter]` runs every case whose name contains `filter` (all cases by default).
+* Each line reports the fastest of several timed batches as ns/op and MB/s of payload.
+*
+* Case names are `direction/type/codec`, where codec is one of:
+* - `memcpy`    — copies the host representation; the lower bound for a native wire.
+* - `htonl`     — a hand-written big-endian codec (shifts / `reverse` per scalar, no library).
+* - `eser-le`   — `serialize<endianness::little>` / `deserialize<endianness::little>`.
+* - `eser-be`   — `serialize<endianness::big>` / `deserialize<endianness::big>`.
+*
+* The `frame/...` cases compare a checksummed `frame` against serializing and then running the
+* checksum over the buffer in a second pass (`two-pass`).
+*
+* Build with optimizations (`-DCMAKE_BUILD_TYPE=Release`); a debug build measures the asserts.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+* - 2026-10-14
+* -     Added the `frame/...` cases.
+*/
+#include "harness.hpp"
+#include "eser/eser.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+using namespace eser::flat;
+using eser::utils::endianness;
+using eser::utils::fixed_string;
+namespace bench = eser::bench;
+
+namespace {
+    alignas(64) std::byte l_wire[1 << 16];
+
+    // A hand-written network-order codec, the kind eser replaces.
+    inline std::uint16_t hand_htons(std::uint16_t v) noexcept { return static_cast<std::uint16_t>((v << 8) | (v >> 8)); }
+    inline std::uint32_t hand_htonl(std::uint32_t v) noexcept
+    {
+        return ((v & 0x000000FFu) << 24) | ((v & 0x0000FF00u) << 8) | ((v & 0x00FF0000u) >> 8) | ((v & 0xFF000000u) >> 24);
+    }
+    inline std::uint32_t float_bits(float f) noexcept { std::uint32_t u; std::memcpy(&u, &f, 4); return u; }
+    inline float bits_float(std::uint32_t u) noexcept { float f; std::memcpy(&f, &u, 4); return f; }
+
+    enum class opcode : std::uint16_t { idle = 0, read = 0x0102, write = 0x0304 };
+
+    struct pod_record {
+        std::uint64_t timestamp;
+        std::uint32_t id;
+        std::uint32_t flags;
+        float values[12];
+    };
+
+    void scalars(const bench::settings &config)
+    {
+        std::uint32_t id = 0xA1B2C3D4;
+        std::uint16_t kind = 0x0102;
+        float value = 3.25f;
+        constexpr std::size_t bytes = 4 + 2 + 4;
+
+        bench::run(config, "encode/u32+u16+f32/memcpy", bytes, [&]{
+            bench::do_not_optimize(id);
+            std::memcpy(l_wire, &id, 4);
+            std::memcpy(l_wire + 4, &kind, 2);
+            std::memcpy(l_wire + 6, &value, 4);
+        });
+        bench::run(config, "encode/u32+u16+f32/htonl", bytes, [&]{
+            bench::do_not_optimize(id);
+            const std::uint32_t a = hand_htonl(id), c = hand_htonl(float_bits(value));
+            const std::uint16_t b = hand_htons(kind);
+            std::memcpy(l_wire, &a, 4);
+            std::memcpy(l_wire + 4, &b, 2);
+            std::memcpy(l_wire + 6, &c, 4);
+        });
+        bench::run(config, "encode/u32+u16+f32/eser-le", bytes, [&]{
+            bench::do_not_optimize(id);
+            serialize<endianness::little>(id, kind, value).to(l_wire);
+        });
+        bench::run(config, "encode/u32+u16+f32/eser-be", bytes, [&]{
+            bench::do_not_optimize(id);
+            serialize<endianness::big>(id, kind, value).to(l_wire);
+        });
+
+        serialize<endianness::big>(id, kind, value).to(l_wire);
+        bench::run(config, "decode/u32+u16+f32/memcpy", bytes, [&]{
+            std::memcpy(&id, l_wire, 4);
+            std::memcpy(&kind, l_wire + 4, 2);
+            std::memcpy(&value, l_wire + 6, 4);
+            bench::do_not_optimize(id);
+        });
+        bench::run(config, "decode/u32+u16+f32/htonl", bytes, [&]{
+            std::uint32_t a, c; std::uint16_t b;
+            std::memcpy(&a, l_wire, 4);
+            std::memcpy(&b, l_wire + 4, 2);
+            std::memcpy(&c, l_wire + 6, 4);
+            id = hand_htonl(a), kind = hand_htons(b), value = bits_float(hand_htonl(c));
+            bench::do_not_optimize(id);
+        });
+        bench::run(config, "decode/u32+u16+f32/eser-le", bytes, [&]{
+            auto fields = deserialize<endianness::little>(l_wire).to<std::tuple<std::uint32_t, std::uint16_t, float>>();
+            bench::do_not_optimize(fields);
+        });
+        bench::run(config, "decode/u32+u16+f32/eser-be", bytes, [&]{
+            auto fields = deserialize<endianness::big>(l_wire).to<std::tuple<std::uint32_t, std::uint16_t, float>>();
+            bench::do_not_optimize(fields);
+        });
+    }
+
+    void enums(const bench::settings &config)
+    {
+        opcode op = opcode::write;
+        bench::run(config, "encode/enum-u16/memcpy", 2, [&]{
+            bench::do_not_optimize(op);
+            std::memcpy(l_wire, &op, 2);
+        });
+        bench::run(config, "encode/enum-u16/htonl", 2, [&]{
+            bench::do_not_optimize(op);
+            const std::uint16_t v = hand_htons(static_cast<std::uint16_t>(op));
+            std::memcpy(l_wire, &v, 2);
+        });
+        bench::run(config, "encode/enum-u16/eser-le", 2, [&]{
+            bench::do_not_optimize(op);
+            serialize<endianness::little>(op).to(l_wire);
+        });
+        bench::run(config, "encode/enum-u16/eser-be", 2, [&]{
+            bench::do_not_optimize(op);
+            serialize<endianness::big>(op).to(l_wire);
+        });
+        bench::run(config, "decode/enum-u16/eser-le", 2, [&]{
+            auto value = deserialize<endianness::little>(l_wire).to<opcode>();
+            bench::do_not_optimize(value);
+        });
+        bench::run(config, "decode/enum-u16/eser-be", 2, [&]{
+            auto value = deserialize<endianness::big>(l_wire).to<opcode>();
+            bench::do_not_optimize(value);
+        });
+    }
+
+    template<std::size_t N>
+    void strings(const bench::settings &config, const char *encode_memcpy, const char *encode_eser, const char *decode_eser)
+    {
+        fixed_string<N> name("sensor/temp0");
+        bench::run(config, encode_memcpy, sizeof(name), [&]{
+            bench::do_not_optimize(name);
+            std::memcpy(l_wire, &name, sizeof(name));
+        });
+        bench::run(config, encode_eser, sizeof(name), [&]{
+            bench::do_not_optimize(name);
+            serialize(name).to(l_wire);
+        });
+        bench::run(config, decode_eser, sizeof(name), [&]{
+            auto value = deserialize(l_wire).to<fixed_string<N>>();
+            bench::do_not_optimize(value);
+        });
+    }
+
+    template<std::size_t N>
+    void arrays(const bench::settings &config)
+    {
+        static std::array<std::uint32_t, N> values{};
+        for (std::size_t i = 0; i < N; ++i) values[i] = static_cast<std::uint32_t>(i * 2654435761u);
+        constexpr std::size_t bytes = N * sizeof(std::uint32_t);
+
+        char name[64];
+        auto label = [&](const char *direction, const char *codec) {
+            std::snprintf(name, sizeof(name), "%s/array<u32,%zu>/%s", direction, N, codec);
+            return name;
+        };
+
+        bench::run(config, label("encode", "memcpy"), bytes, [&]{
+            bench::do_not_optimize(values);
+            std::memcpy(l_wire, values.data(), bytes);
+        });
+        bench::run(config, label("encode", "htonl"), bytes, [&]{
+            bench::do_not_optimize(values);
+            for (std::size_t i = 0; i < N; ++i) {
+                const std::uint32_t v = hand_htonl(values[i]);
+                std::memcpy(l_wire + 4 * i, &v, 4);
+            }
+        });
+        bench::run(config, label("encode", "eser-le"), bytes, [&]{
+            bench::do_not_optimize(values);
+            serialize<endianness::little>(values).to(l_wire);
+        });
+        bench::run(config, label("encode", "eser-be"), bytes, [&]{
+            bench::do_not_optimize(values);
+            serialize<endianness::big>(values).to(l_wire);
+        });
+
+        bench::run(config, label("decode", "memcpy"), bytes, [&]{
+            std::memcpy(values.data(), l_wire, bytes);
+            bench::do_not_optimize(values);
+        });
+        bench::run(config, label("decode", "htonl"), bytes, [&]{
+            for (std::size_t i = 0; i < N; ++i) {
+                std::uint32_t v;
+                std::memcpy(&v, l_wire + 4 * i, 4);
+                values[i] = hand_htonl(v);
+            }
+            bench::do_not_optimize(values);
+        });
+        bench::run(config, label("decode", "eser-le"), bytes, [&]{
+            (void)deserialize<endianness::little>(l_wire).to_range(values.data(), N);
+            bench::do_not_optimize(values);
+        });
+        bench::run(config, label("decode", "eser-be"), bytes, [&]{
+            (void)deserialize<endianness::big>(l_wire).to_range(values.data(), N);
+            bench::do_not_optimize(values);
+        });
+    }
+
+    template<typename Checksum>
+    void frames(const bench::settings &config, const char *checksum)
+    {
+        using link = frame<Checksum, endianness::big>;
+        std::array<std::uint16_t, 240> samples{};
+        for (std::size_t i = 0; i < samples.size(); ++i) samples[i] = static_cast<std::uint16_t>(i * 7);
+        const std::uint32_t id = 0xA1B2C3D4;
+        constexpr std::size_t bytes = link::template max_size_of<std::uint32_t, std::array<std::uint16_t, 240>>();
+
+        char name[64];
+        auto label = [&](const char *codec) {
+            std::snprintf(name, sizeof(name), "frame/%s-be-%zuB/%s", checksum, bytes, codec);
+            return name;
+        };
+
+        bench::run(config, label("two-pass"), bytes, [&]{
+            bench::do_not_optimize(samples);
+            serialize<endianness::big>(std::uint16_t{link::sync}, std::uint16_t{484}, id, samples).to(l_wire);
+            const auto crc = checksum_of<Checksum>(l_wire + 2, 2 + 484);
+            serialize<endianness::big>(crc).to(l_wire + 4 + 484, sizeof(l_wire) - 4 - 484);
+        });
+        bench::run(config, label("eser"), bytes, [&]{
+            bench::do_not_optimize(samples);
+            link::serialize(id, samples).to(l_wire);
+        });
+        bench::run(config, label("eser-open"), bytes, [&]{
+            auto fields = link::open(l_wire, bytes)->template to<std::tuple<std::uint32_t, std::array<std::uint16_t, 240>>>();
+            bench::do_not_optimize(fields);
+        });
+    }
+
+    void structs(const bench::settings &config)
+    {
+        pod_record record{};
+        record.timestamp = 1234567890123ull;
+        record.id = 42;
+        bench::run(config, "encode/struct-64B/memcpy", sizeof(record), [&]{
+            bench::do_not_optimize(record);
+            std::memcpy(l_wire, &record, sizeof(record));
+        });
+        bench::run(config, "encode/struct-64B/eser-native", sizeof(record), [&]{
+            bench::do_not_optimize(record);
+            serialize<eser::internal::host_endianness>(record).to(l_wire);
+        });
+        bench::run(config, "decode/struct-64B/memcpy", sizeof(record), [&]{
+            std::memcpy(&record, l_wire, sizeof(record));
+            bench::do_not_optimize(record);
+        });
+        bench::run(config, "decode/struct-64B/eser-native", sizeof(record), [&]{
+            auto value = deserialize<eser::internal::host_endianness>(l_wire).to<pod_record>();
+            bench::do_not_optimize(value);
+        });
+    }
+}
+
+int main(int argc, char **argv)
+{
+    bench::settings config;
+    if (argc > 1) config.filter = argv[1];
+
+    std::printf("%-44s %18s %17s\n", "case", "time", "throughput");
+    scalars(config);
+    enums(config);
+    strings<16>(config, "encode/fixed_string<16>/memcpy", "encode/fixed_string<16>/eser", "decode/fixed_string<16>/eser");
+    strings<64>(config, "encode/fixed_string<64>/memcpy", "encode/fixed_string<64>/eser", "decode/fixed_string<64>/eser");
+    arrays<16>(config);
+    arrays<256>(config);
+    arrays<4096>(config);
+    structs(config);
+    frames<crc16_ccitt>(config, "crc16");
+    frames<crc32c>(config, "crc32c");
+    return 0;
+}
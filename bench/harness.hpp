@@ -0,0 +1,108 @@
+/**
+* @file harness.hpp
+*
+* @brief A minimal, dependency-free micro-benchmark harness for `eser_bench`.
+*
+* Each case is a callable that performs one operation. The harness calibrates the iteration count
+* until a batch runs for at least `min_batch`, times `repetitions` such batches with
+* `std::chrono::steady_clock`, and reports the fastest one (the least disturbed by the system) as
+* nanoseconds per operation and bytes per second.
+*
+* `do_not_optimize` / `clobber_memory` keep the optimizer from deleting the work being measured;
+* they are the usual empty-`asm` barriers on GCC/Clang and a volatile sink elsewhere.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_BENCH_HARNESS_HPP_
+#define ESER_BENCH_HARNESS_HPP_
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+namespace eser::bench{
+    /**
+    * @brief Make the optimizer assume `value` is read (and may be modified) here.
+    * @param value The object whose computation must not be elided.
+    */
+    template<typename T>
+    inline void do_not_optimize(T &value) noexcept
+    {
+        #if defined(__GNUC__) || defined(__clang__)
+            asm volatile("" : "+m"(value) : : "memory");
+        #else
+            static volatile unsigned char sink;
+            sink = *static_cast<volatile unsigned char *>(static_cast<void *>(&value));
+        #endif
+    }
+
+    /**
+    * @brief Make the optimizer assume all memory is read and written here.
+    */
+    inline void clobber_memory() noexcept
+    {
+        #if defined(__GNUC__) || defined(__clang__)
+            asm volatile("" : : : "memory");
+        #else
+            std::atomic_signal_fence(std::memory_order_seq_cst);
+        #endif
+    }
+
+    /**
+    * @brief Run-time settings shared by every case.
+    */
+    struct settings{
+        const char *filter = nullptr;                     ///< Only run cases whose name contains this.
+        std::chrono::nanoseconds min_batch{20'000'000};   ///< Minimum duration of one timed batch.
+        int repetitions = 5;                              ///< Timed batches per case; the fastest is reported.
+    };
+
+    /**
+    * @brief Time `op` and print one result line.
+    *
+    * @param config The run settings.
+    * @param name The case name (`group/variant/size`).
+    * @param bytes_per_op The payload bytes one call of `op` moves, for the throughput column.
+    * @param op The operation to measure; called repeatedly.
+    */
+    template<typename Op>
+    inline void run(const settings &config, const char *name, std::size_t bytes_per_op, Op &&op)
+    {
+        if (config.filter != nullptr and std::strstr(name, config.filter) == nullptr) return;
+        using clock = std::chrono::steady_clock;
+
+        std::uint64_t iterations = 1;
+        for (;;) {
+            const auto start = clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) { op(); clobber_memory(); }
+            if (clock::now() - start >= config.min_batch or iterations >= (std::uint64_t{1} << 40)) break;
+            iterations *= 2;
+        }
+
+        double best_ns = 0;
+        for (int r = 0; r < config.repetitions; ++r) {
+            const auto start = clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) { op(); clobber_memory(); }
+            const std::chrono::duration<double, std::nano> elapsed = clock::now() - start;
+            const double ns = elapsed.count() / static_cast<double>(iterations);
+            if (r == 0 or ns < best_ns) best_ns = ns;
+        }
+
+        const double bytes_per_second = best_ns > 0 ? static_cast<double>(bytes_per_op) * 1e9 / best_ns : 0;
+        std::printf("%-44s %12.2f ns/op %12.1f MB/s\n", name, best_ns, bytes_per_second / 1e6);
+    }
+} // namespace eser::bench
+
+#endif // ESER_BENCH_HARNESS_HPP_
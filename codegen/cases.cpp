@@ -0,0 +1,88 @@
+/**
+* @file cases.cpp
+*
+* @brief Representative encode/decode calls whose generated code `eser_codegen` checks.
+*
+* Every case is an `extern "C"` function so its symbol is stable across compilers; the budgets in
+* budgets.json are keyed by these names. Buffers are fixed-size array references, so the capacity
+* check folds at compile time — exactly how `serialize(...).to(buffer)` is used in practice.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#include "eser/flat/serializer.hpp"
+#include "eser/flat/deserializer.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+using namespace eser::flat;
+using eser::utils::endianness;
+
+namespace {
+    using fields = std::tuple<std::uint32_t, std::uint16_t, float>;
+
+    template<endianness Wire>
+    inline bool decode_fields(const std::byte (&buffer)[16], std::uint32_t *a, std::uint16_t *b, float *c)
+    {
+        auto decoded = deserialize<Wire>(buffer).template to<fields>();
+        if (not decoded) return false;
+        std::tie(*a, *b, *c) = *decoded;
+        return true;
+    }
+}
+
+extern "C" {
+    /// Native three-field encode: three stores, no loop, no call.
+    std::size_t eser_encode_le_3(std::byte (&buffer)[16], std::uint32_t a, std::uint16_t b, float c)
+    {
+        return serialize<endianness::little>(a, b, c).to(buffer);
+    }
+
+    /// Swapped three-field encode: byte-swap instructions and stores, no loop, no call.
+    std::size_t eser_encode_be_3(std::byte (&buffer)[16], std::uint32_t a, std::uint16_t b, float c)
+    {
+        return serialize<endianness::big>(a, b, c).to(buffer);
+    }
+
+    /// Native three-field tuple decode: loads, no loop, no call.
+    bool eser_decode_le_3(const std::byte (&buffer)[16], std::uint32_t *a, std::uint16_t *b, float *c)
+    {
+        return decode_fields<endianness::little>(buffer, a, b, c);
+    }
+
+    /// Swapped three-field tuple decode: loads and byte swaps, no loop, no call.
+    bool eser_decode_be_3(const std::byte (&buffer)[16], std::uint32_t *a, std::uint16_t *b, float *c)
+    {
+        return decode_fields<endianness::big>(buffer, a, b, c);
+    }
+
+    /// Native 64-byte array encode: one block copy, no call.
+    std::size_t eser_encode_le_array16(std::byte (&buffer)[64], const std::array<std::uint32_t, 16> &values)
+    {
+        return serialize<endianness::little>(values).to(buffer);
+    }
+
+    /// Swapped 64-byte array encode: the swap kernel must stay inlined (no call).
+    std::size_t eser_encode_be_array16(std::byte (&buffer)[64], const std::array<std::uint32_t, 16> &values)
+    {
+        return serialize<endianness::big>(values).to(buffer);
+    }
+
+    /// Single enum encode on a swapped wire: one swap and one store.
+    std::size_t eser_encode_be_enum(std::byte (&buffer)[2], std::uint16_t raw)
+    {
+        enum class opcode : std::uint16_t {};
+        return serialize<endianness::big>(static_cast<opcode>(raw)).to(buffer);
+    }
+}
@@ -19,6 +19,7 @@
 *
 * - @ref eser_utils "eser_utils" : Utility components and type traits used across serialization tasks.
 * - @ref eser_flat "eser_flat" : High-performance binary serialization and deserialization utilities.
+* - @ref eser_varint "eser_varint" : Variable-length (LEB128/zigzag) encoding for mostly-small integers.
 *
 * ## Features
 *
@@ -66,4 +67,5 @@
 #define ESER_HPP_
 #include "utils/utils.hpp"
 #include "flat/flat.hpp"
+#include "varint/varint.hpp"
 #endif // ESER_HPP_
@@ -0,0 +1,190 @@
+/**
+* @file batch.hpp
+*
+* @ingroup eser_flat
+*
+* @brief Batched encoding into I/O-owned buffers, and in-place decoding of completion buffers.
+*
+* An asynchronous I/O layer (io_uring with registered or provided buffers, asio, a DMA engine)
+* owns the memory a write is submitted from and the memory a read completes into. Copying
+* between those buffers and a private one, and submitting one small message per system call, are
+* both avoidable:
+*
+* - `batch_writer<Provider>` serializes messages back to back straight into a buffer the I/O layer
+*   hands out, and submits the whole buffer at once when the next message does not fit or on
+*   `flush()`. Many small messages then cost one submission.
+* - `for_each_message<Tuple, Wire>(data, size, handler)` decodes every whole message of a
+*   completion buffer in place and reports how many bytes it used, so a message split across two
+*   completions can be carried over.
+*
+* ## The buffer provider concept
+*
+* The writer is I/O-agnostic: it talks to a provider with two members, checked by
+* `is_buffer_provider_v`. Both are called from `append` / `flush` on the writer's thread.
+*
+* | Member | Meaning |
+* |---|---|
+* | `chunk acquire()` | a writable buffer for the next batch; `{nullptr, 0}` if none is free |
+* | `void submit(const_chunk filled)` | hand the filled prefix of the last acquired buffer to the I/O layer |
+*
+* The buffer belongs to the I/O layer after `submit` until its completion; recycling it into
+* `acquire` is the provider's business. For io_uring, `acquire` would pop a registered buffer and
+* `submit` would queue one `IORING_OP_WRITE_FIXED` for it:
+*
+* ```cpp
+* struct ring_provider {
+*     chunk acquire() { auto *b = pool.pop(); return b ? chunk{b->data, b->size} : chunk{nullptr, 0}; }
+*     void submit(const_chunk filled) { queue_write_fixed(fd, filled.data, filled.size, index_of(filled.data)); }
+* };
+*
+* ring_provider provider;
+* batch_writer<ring_provider> out(provider);
+* for (const auto &s : samples) out.append<endianness::big>(s.id, s.value);   // bytes land in the registered buffer
+* out.flush();                                                                 // one submission for the batch
+*
+* // on completion of a read into a provided buffer:
+* std::size_t used = for_each_message<std::tuple<std::uint32_t, float>, endianness::big>(
+*     cqe_data, cqe_size, [](std::uint32_t id, float value){ handle(id, value); });
+* ```
+*
+* A coroutine front end (`co_await` on a submission) is a thin wrapper over these callbacks and
+* belongs with the I/O layer that knows how to resume; nothing here needs C++20.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_BATCH_HPP_
+#define ESER_FLAT_BATCH_HPP_
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "../internal/byte.hpp"
+#include "../internal/traits.hpp"
+#include "../utils/endianness.hpp"
+#include "stream.hpp"
+#include "size.hpp"
+
+namespace eser::flat{
+    using utils::endianness;
+
+    /**
+    * @struct is_buffer_provider
+    * @brief Detects a type that models the buffer provider concept (see the file documentation).
+    * @tparam T The type to inspect.
+    */
+    template<typename T, typename = void>
+    struct is_buffer_provider : std::false_type {};
+
+    /**
+    * @brief Specialization of `is_buffer_provider` for types with `acquire` and `submit`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    struct is_buffer_provider<T, std::void_t<
+        decltype(static_cast<chunk>(std::declval<T&>().acquire())),
+        decltype(std::declval<T&>().submit(std::declval<const_chunk>()))
+    >> : std::true_type {};
+
+    /**
+    * @var is_buffer_provider_v
+    * @brief Convenience variable template for `is_buffer_provider<T>::value`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    inline constexpr bool is_buffer_provider_v = is_buffer_provider<T>::value;
+
+    /**
+    * @class batch_writer
+    * @brief Serializes messages back to back into provider buffers and submits them in batches.
+    *
+    * Holds the current buffer and its fill level; it references the provider and does not own
+    * any memory. Pending messages are not submitted by the destructor: call `flush()`.
+    *
+    * The provider's buffers are assumed to be of one size: a message larger than the current
+    * buffer is refused without submitting the pending ones, and an acquired buffer stays with
+    * the writer until a message is written to it, so none is acquired and then dropped.
+    *
+    * @tparam Provider A type modelling the buffer provider concept.
+    */
+    template<typename Provider>
+    class batch_writer{
+        static_assert(is_buffer_provider_v<Provider>,
+            "[eser] batch_writer needs a provider with chunk acquire() and void submit(const_chunk)");
+
+    public:
+        /**
+        * @brief A writer over `provider`; the first buffer is acquired by the first `append`.
+        */
+        constexpr explicit batch_writer(Provider &provider) noexcept;
+
+        batch_writer(const batch_writer &) = delete;
+        batch_writer &operator=(const batch_writer &) = delete;
+
+        /**
+        * @brief Serialize one message after the pending ones.
+        *
+        * If the current buffer has no room for it, the pending messages are submitted first and a
+        * new buffer is acquired. A buffer that is still empty is reused instead.
+        *
+        * @tparam Wire The byte order, as in `serialize<Wire>` (default `endianness::little`).
+        * @tparam T... The deduced field types.
+        * @param values The message's fields.
+        * @return `false` (nothing written, nothing submitted) if the provider has no buffer, or the
+        *         message is larger than a whole buffer.
+        */
+        template<endianness Wire = endianness::little, typename... T>
+        bool append(const T &...values) noexcept;
+
+        /**
+        * @brief Submit the pending messages, if any, as one buffer.
+        * @return The number of messages submitted.
+        */
+        std::size_t flush() noexcept;
+
+        /**
+        * @brief The messages written since the last submission.
+        */
+        [[nodiscard]] constexpr std::size_t pending() const noexcept;
+
+        /**
+        * @brief The bytes written since the last submission.
+        */
+        [[nodiscard]] constexpr std::size_t pending_bytes() const noexcept;
+
+    private:
+        Provider *_provider;     ///< Where buffers come from and go to.
+        chunk _buffer;           ///< The buffer being filled (`nullptr` until acquired).
+        std::size_t _used;       ///< Bytes written to it.
+        std::size_t _messages;   ///< Messages written to it.
+    };
+
+    /**
+    * @brief Decode every whole message of a buffer in place and pass its fields to `handler`.
+    *
+    * Messages are read back to back, as `batch_writer` (or repeated `serialize(...).to()`) wrote
+    * them, straight from `data`; nothing is copied but the decoded values.
+    *
+    * @tparam Tuple The message type, a `std::tuple<Es...>` as for `deserializer::to<Tuple>()`.
+    * @tparam Wire The byte order (default `endianness::little`).
+    * @tparam Handler Callable as `handler(Es...)`.
+    * @param data The completion buffer.
+    * @param size Its length in bytes.
+    * @param handler Called once per message, in order.
+    * @return The bytes used by the decoded messages. Decoding stops at the first message that is
+    *         truncated or invalid; the bytes from there on are the caller's to carry over.
+    */
+    template<typename Tuple, endianness Wire = endianness::little, typename Handler>
+    std::size_t for_each_message(const std::byte *data, std::size_t size, Handler &&handler);
+} // namespace eser::flat
+
+#include "batch.tpp"
+#endif // ESER_FLAT_BATCH_HPP_
@@ -0,0 +1,99 @@
+/**
+* @file batch.tpp
+*
+* @brief Definition of functionality in batch.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_BATCH_TPP_
+#define ESER_FLAT_BATCH_TPP_
+#include "batch.hpp"
+#include <optional>
+#include <tuple>
+#include "serializer.hpp"
+#include "deserializer.hpp"
+
+namespace eser::flat{
+    template<typename Provider>
+    constexpr batch_writer<Provider>::batch_writer(Provider &provider) noexcept
+    : _provider(&provider), _buffer{nullptr, 0}, _used(0), _messages(0)
+    {
+    }
+
+    template<typename Provider>
+    template<endianness Wire, typename... T>
+    inline bool batch_writer<Provider>::append(const T &...values) noexcept
+    {
+        const std::size_t bytes = serialized_size(values...);
+        if (bytes > _buffer.size - _used) {
+            // Larger than a whole buffer: refuse it before anything is submitted or acquired.
+            if (_buffer.data != nullptr and bytes > _buffer.size) return false;
+            flush();
+            if (_buffer.data == nullptr) {
+                _buffer = _provider->acquire();
+                _used = 0;
+                if (_buffer.data == nullptr) {
+                    _buffer.size = 0;
+                    return false;
+                }
+                if (bytes > _buffer.size) return false;   // keep the empty buffer for the next append
+            }
+        }
+        serialize<Wire>(values...).to(_buffer.data + _used, _buffer.size - _used);
+        _used += bytes;
+        ++_messages;
+        return true;
+    }
+
+    template<typename Provider>
+    inline std::size_t batch_writer<Provider>::flush() noexcept
+    {
+        const std::size_t messages = _messages;
+        if (messages != 0) {
+            _provider->submit(const_chunk{_buffer.data, _used});
+            _buffer = chunk{nullptr, 0};
+            _used = 0;
+            _messages = 0;
+        }
+        return messages;
+    }
+
+    template<typename Provider>
+    constexpr std::size_t batch_writer<Provider>::pending() const noexcept
+    {
+        return _messages;
+    }
+
+    template<typename Provider>
+    constexpr std::size_t batch_writer<Provider>::pending_bytes() const noexcept
+    {
+        return _used;
+    }
+
+    template<typename Tuple, endianness Wire, typename Handler>
+    inline std::size_t for_each_message(const std::byte *data, std::size_t size, Handler &&handler)
+    {
+        static_assert(internal::is_tuple_v<Tuple>, "[eser] for_each_message reads std::tuple messages");
+        auto reader = deserialize<Wire>(data, size);
+        std::size_t used = 0;
+        while (used < size) {
+            std::optional<Tuple> message = reader.template to<Tuple>();
+            if (not message) break;
+            used += std::apply([](const auto &...fields){ return serialized_size(fields...); }, *message);
+            std::apply(handler, std::move(*message));
+        }
+        return used;
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_BATCH_TPP_
@@ -0,0 +1,197 @@
+/**
+* @file buffer_pool.hpp
+*
+* @ingroup eser_flat
+*
+* @brief A static pool of message buffers, sized at compile time by the messages they hold and
+*        handed out through a lock-free freelist.
+*
+* Call sites that serialize usually declare their own `std::byte buffer[64]`, sized by a guess.
+* Each guess costs stack in every frame of a deep call chain, and a wrong one fails at run time.
+* A `message_pool` computes the slot size from the message types instead, and shares a fixed
+* number of slots between every call site:
+*
+* ```cpp
+* using protocol = message_set<std::uint8_t, ping, telemetry, shutdown>;
+* static message_pool<8, protocol, std::tuple<std::uint32_t, bounded_string<32>>> pool;
+*
+* std::byte *buffer = pool.acquire();            // nullptr when all 8 slots are in use
+* if (buffer) {
+*     const std::size_t n = serialize(std::uint8_t{ping::id}, seq).to(buffer, pool.slot_size);
+*     send(buffer, n);
+*     pool.release(buffer);
+* }
+* ```
+*
+* The slot size is the largest `max_serialized_size_of` over the declared messages. Every slot
+* starts on its own 64-byte cache line, so buffers used on different cores do not false-share.
+* `acquire` and `release` pop and push a Treiber stack of slot indices. The head packs the index
+* with a version tag in one `std::size_t`, so a compare-and-swap cannot succeed on a head that
+* was popped and pushed back in between (the ABA problem). Any thread may acquire and release.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_BUFFER_POOL_HPP_
+#define ESER_FLAT_BUFFER_POOL_HPP_
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <tuple>
+#include "../internal/byte.hpp"
+#include "message_set.hpp"
+#include "size.hpp"
+
+namespace eser::flat{
+    namespace details{
+        /**
+        * @struct message_capacity
+        * @brief The largest wire size of one message, used to size a @ref buffer_pool slot.
+        *
+        * A field type counts with `max_serialized_size_of<T>()`.
+        *
+        * @tparam Message A field type, a `std::tuple` of fields, a @ref message_type or a
+        *                 @ref message_set.
+        */
+        template<typename Message>
+        struct message_capacity{
+            static constexpr std::size_t value = max_serialized_size_of<Message>();   ///< The size in bytes.
+        };
+
+        /**
+        * @brief Specialization of `message_capacity` for a message of fields `T...`.
+        */
+        template<typename... T>
+        struct message_capacity<std::tuple<T...>>{
+            static constexpr std::size_t value = max_serialized_size_of<T...>();   ///< The size in bytes.
+        };
+
+        /**
+        * @brief Specialization of `message_capacity` for a bare @ref message_type: its payload,
+        *        without the id.
+        */
+        template<auto Id, typename... T>
+        struct message_capacity<message_type<Id, T...>>{
+            static constexpr std::size_t value = message_type<Id, T...>::size;   ///< The size in bytes.
+        };
+
+        /**
+        * @brief Specialization of `message_capacity` for a @ref message_set: its longest message,
+        *        id included.
+        */
+        template<typename Id, typename... Messages>
+        struct message_capacity<message_set<Id, Messages...>>{
+            static constexpr std::size_t value = message_set<Id, Messages...>::max_size;   ///< The size in bytes.
+        };
+    } // namespace details
+
+    /**
+    * @var max_message_size_v
+    * @brief The largest wire size over every message of `Messages...`.
+    * @tparam Messages... Field types, `std::tuple`s of fields, @ref message_type "message_types"
+    *                     or @ref message_set "message_sets", in any mix.
+    */
+    template<typename... Messages>
+    inline constexpr std::size_t max_message_size_v = std::max({details::message_capacity<Messages>::value...});
+
+    /**
+    * @class buffer_pool
+    * @brief `Count` buffers of `SlotSize` bytes each, on separate cache lines, acquired and released
+    *        lock-free from any thread.
+    *
+    * The pool does not own what the buffers hold and never touches their bytes: a released buffer
+    * keeps its contents until the next `acquire` hands it out again.
+    *
+    * @tparam Count The number of buffers; strictly positive.
+    * @tparam SlotSize The size of each buffer, in bytes; strictly positive.
+    */
+    template<std::size_t Count, std::size_t SlotSize>
+    class buffer_pool{
+        static_assert(Count > 0, "buffer_pool Count must be strictly positive");
+        static_assert(SlotSize > 0, "buffer_pool SlotSize must be strictly positive");
+
+        /**
+        * @brief The bits of the head that hold a slot index (or `Count`, the empty list).
+        */
+        static constexpr unsigned index_bits() noexcept;
+
+        static_assert(index_bits() <= std::numeric_limits<std::size_t>::digits / 2,
+            "buffer_pool Count is too large to leave room for the freelist's version tag");
+
+    public:
+        static constexpr std::size_t cache_line = 64;        ///< The alignment of the head and of every slot.
+        static constexpr std::size_t slot_size = SlotSize;   ///< The size of each buffer, in bytes.
+
+        /**
+        * @brief A pool with every buffer free.
+        */
+        buffer_pool() noexcept;
+
+        buffer_pool(const buffer_pool &) = delete;
+        buffer_pool &operator=(const buffer_pool &) = delete;
+
+        /**
+        * @brief The number of buffers.
+        */
+        [[nodiscard]] static constexpr std::size_t capacity() noexcept;
+
+        /**
+        * @brief Take a free buffer.
+        * @return `slot_size` bytes aligned to `cache_line`, owned by the caller until `release`; or
+        *         `nullptr` if every buffer is in use.
+        */
+        [[nodiscard]] std::byte *acquire() noexcept;
+
+        /**
+        * @brief Give a buffer back.
+        * @param buffer A pointer returned by `acquire` on this pool and not released since. Anything
+        *               else is flagged by `assert` and ignored.
+        */
+        void release(std::byte *buffer) noexcept;
+
+        /**
+        * @brief Whether `buffer` is the start of one of this pool's buffers.
+        */
+        [[nodiscard]] bool owns(const std::byte *buffer) const noexcept;
+
+        /**
+        * @brief The number of free buffers. A snapshot while other threads acquire or release.
+        */
+        [[nodiscard]] std::size_t available() const noexcept;
+
+    private:
+        static constexpr std::size_t index_mask = (std::size_t{1} << index_bits()) - 1;   ///< The index part of the head.
+        static constexpr std::size_t tag_step = std::size_t{1} << index_bits();          ///< One version of the head.
+
+        /**
+        * @brief One buffer, on its own cache lines.
+        */
+        struct alignas(cache_line) slot{
+            std::byte data[SlotSize];           ///< The buffer handed out.
+            std::atomic<std::size_t> next;      ///< The next free slot while this one is free.
+        };
+
+        alignas(cache_line) std::atomic<std::size_t> _head; ///< Version tag and index of the first free slot.
+        slot _slots[Count];                                 ///< The buffers.
+    };
+
+    /**
+    * @brief A pool of `Count` buffers, each large enough for any message of `Messages...`.
+    * @see max_message_size_v
+    */
+    template<std::size_t Count, typename... Messages>
+    using message_pool = buffer_pool<Count, max_message_size_v<Messages...>>;
+} // namespace eser::flat
+
+#include "buffer_pool.tpp"
+#endif // ESER_FLAT_BUFFER_POOL_HPP_
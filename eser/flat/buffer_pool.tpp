@@ -0,0 +1,100 @@
+/**
+* @file buffer_pool.tpp
+*
+* @brief Definition of functionality in buffer_pool.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_BUFFER_POOL_TPP_
+#define ESER_FLAT_BUFFER_POOL_TPP_
+#include "buffer_pool.hpp"
+#include <cassert>
+#include <cstdint>
+
+namespace eser::flat{
+    template<std::size_t Count, std::size_t SlotSize>
+    constexpr unsigned buffer_pool<Count, SlotSize>::index_bits() noexcept
+    {
+        unsigned bits = 0;
+        for (std::size_t n = Count; n != 0; n >>= 1) ++bits;
+        return bits;
+    }
+
+    template<std::size_t Count, std::size_t SlotSize>
+    inline buffer_pool<Count, SlotSize>::buffer_pool() noexcept
+    : _head(0)
+    {
+        for (std::size_t i = 0; i < Count; ++i) _slots[i].next.store(i + 1, std::memory_order_relaxed);
+    }
+
+    template<std::size_t Count, std::size_t SlotSize>
+    constexpr std::size_t buffer_pool<Count, SlotSize>::capacity() noexcept
+    {
+        return Count;
+    }
+
+    template<std::size_t Count, std::size_t SlotSize>
+    inline std::byte *buffer_pool<Count, SlotSize>::acquire() noexcept
+    {
+        std::size_t head = _head.load(std::memory_order_acquire);
+        std::size_t index;
+        do {
+            index = head & index_mask;
+            if (index == Count) return nullptr;
+            // The slot may be taken and pushed back meanwhile; the tag makes the CAS fail then.
+            const std::size_t next = _slots[index].next.load(std::memory_order_relaxed);
+            const std::size_t desired = ((head & ~index_mask) + tag_step) | next;
+            if (_head.compare_exchange_weak(head, desired, std::memory_order_acquire, std::memory_order_acquire)) break;
+        } while (true);
+        return _slots[index].data;
+    }
+
+    template<std::size_t Count, std::size_t SlotSize>
+    inline void buffer_pool<Count, SlotSize>::release(std::byte *buffer) noexcept
+    {
+        if (not owns(buffer)) {
+            assert(false && "buffer_pool::release: the buffer does not belong to this pool");
+            return;
+        }
+        const std::size_t index = static_cast<std::size_t>(
+            reinterpret_cast<std::uintptr_t>(buffer) - reinterpret_cast<std::uintptr_t>(_slots)) / sizeof(slot);
+
+        std::size_t head = _head.load(std::memory_order_relaxed);
+        do {
+            _slots[index].next.store(head & index_mask, std::memory_order_relaxed);
+        } while (not _head.compare_exchange_weak(head, ((head & ~index_mask) + tag_step) | index,
+                                                 std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    template<std::size_t Count, std::size_t SlotSize>
+    inline bool buffer_pool<Count, SlotSize>::owns(const std::byte *buffer) const noexcept
+    {
+        const auto first = reinterpret_cast<std::uintptr_t>(_slots);
+        const auto address = reinterpret_cast<std::uintptr_t>(buffer);
+        return address >= first and address - first < sizeof(_slots) and (address - first) % sizeof(slot) == 0;
+    }
+
+    template<std::size_t Count, std::size_t SlotSize>
+    inline std::size_t buffer_pool<Count, SlotSize>::available() const noexcept
+    {
+        std::size_t free = 0;
+        // Bounded by Count: the list may change under a concurrent walk.
+        for (std::size_t index = _head.load(std::memory_order_acquire) & index_mask;
+             index < Count and free < Count;
+             index = _slots[index].next.load(std::memory_order_relaxed))
+            ++free;
+        return free;
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_BUFFER_POOL_TPP_
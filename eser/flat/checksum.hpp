@@ -0,0 +1,227 @@
+/**
+* @file checksum.hpp
+*
+* @ingroup eser_flat
+*
+* @brief Checksum policies (CRC-16/CCITT, CRC-32, CRC-32C) and sink / source adapters that
+*        compute them while a message is written or read.
+*
+* A checksum policy is a type with these members; the library provides four:
+*
+* | Member | Meaning |
+* |---|---|
+* | `value_type` | the unsigned checksum type |
+* | `static constexpr std::size_t size` | bytes the checksum takes on the wire (0 for none) |
+* | `static constexpr value_type initial` | the register before the first byte |
+* | `static value_type update(value_type, const std::byte*, std::size_t)` | feed bytes to the register |
+* | `static constexpr value_type finalize(value_type)` | the checksum of the bytes fed so far |
+*
+* | Policy | Parameters | Check value of `"123456789"` |
+* |---|---|---|
+* | @ref crc16_ccitt | poly 0x1021, init 0xFFFF, MSB-first, no final XOR (CRC-16/CCITT-FALSE) | `0x29B1` |
+* | @ref crc32 | poly 0x04C11DB7 reflected, init and final XOR 0xFFFFFFFF (IEEE 802.3, zlib) | `0xCBF43926` |
+* | @ref crc32c | poly 0x1EDC6F41 reflected, init and final XOR 0xFFFFFFFF (Castagnoli, iSCSI) | `0xE3069283` |
+* | @ref no_checksum | nothing on the wire | — |
+*
+* The CRC kernels use the target's CRC instruction where there is one (see internal/crc.hpp). On
+* x86-64 only CRC-32C has an instruction (SSE4.2), so prefer @ref crc32c there when both ends are
+* free to choose.
+*
+* `checksum_sink` and `checksum_source` wrap any sink or source (see stream.hpp) and feed every
+* byte that passes through them to a policy. Each field is checksummed right after it is written
+* or before it is decoded, while it is still in cache: there is no second pass over the message.
+*
+* ```cpp
+* span_sink out(buffer, sizeof(buffer));
+* checksum_sink<crc32c, span_sink> summed(out);
+* serialize(id, timestamp, samples).to(summed);
+* std::uint32_t crc = summed.value();
+* ```
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_CHECKSUM_HPP_
+#define ESER_FLAT_CHECKSUM_HPP_
+#include <cstddef>
+#include <cstdint>
+#include "../internal/byte.hpp"
+#include "../internal/crc.hpp"
+#include "stream.hpp"
+
+namespace eser::flat{
+    /**
+    * @struct crc16_ccitt
+    * @brief CRC-16/CCITT-FALSE: polynomial 0x1021, initial 0xFFFF, MSB-first, no final XOR.
+    */
+    struct crc16_ccitt{
+        using value_type = std::uint16_t;                 ///< The checksum type.
+        static constexpr std::size_t size = 2;            ///< Wire bytes.
+        static constexpr value_type initial = 0xFFFFu;    ///< The initial register.
+
+        /**
+        * @brief Feed `n` bytes to the register.
+        */
+        static value_type update(value_type state, const std::byte *data, std::size_t n) noexcept;
+
+        /**
+        * @brief The checksum of the bytes fed so far.
+        */
+        static constexpr value_type finalize(value_type state) noexcept;
+    };
+
+    /**
+    * @struct crc32
+    * @brief CRC-32 as in IEEE 802.3 and zlib: reflected polynomial 0xEDB88320, initial and final
+    *        XOR 0xFFFFFFFF.
+    */
+    struct crc32{
+        using value_type = std::uint32_t;                 ///< The checksum type.
+        static constexpr std::size_t size = 4;            ///< Wire bytes.
+        static constexpr value_type initial = 0xFFFFFFFFu; ///< The initial register.
+
+        /**
+        * @brief Feed `n` bytes to the register.
+        */
+        static value_type update(value_type state, const std::byte *data, std::size_t n) noexcept;
+
+        /**
+        * @brief The checksum of the bytes fed so far.
+        */
+        static constexpr value_type finalize(value_type state) noexcept;
+    };
+
+    /**
+    * @struct crc32c
+    * @brief CRC-32C (Castagnoli): reflected polynomial 0x82F63B78, initial and final XOR 0xFFFFFFFF.
+    */
+    struct crc32c{
+        using value_type = std::uint32_t;                 ///< The checksum type.
+        static constexpr std::size_t size = 4;            ///< Wire bytes.
+        static constexpr value_type initial = 0xFFFFFFFFu; ///< The initial register.
+
+        /**
+        * @brief Feed `n` bytes to the register.
+        */
+        static value_type update(value_type state, const std::byte *data, std::size_t n) noexcept;
+
+        /**
+        * @brief The checksum of the bytes fed so far.
+        */
+        static constexpr value_type finalize(value_type state) noexcept;
+    };
+
+    /**
+    * @struct no_checksum
+    * @brief No checksum: nothing is computed and nothing is written.
+    */
+    struct no_checksum{
+        using value_type = std::uint8_t;                  ///< Placeholder checksum type.
+        static constexpr std::size_t size = 0;            ///< Wire bytes.
+        static constexpr value_type initial = 0;          ///< The initial register.
+
+        /**
+        * @brief Ignores the bytes.
+        */
+        static constexpr value_type update(value_type state, const std::byte *data, std::size_t n) noexcept;
+
+        /**
+        * @brief Always 0.
+        */
+        static constexpr value_type finalize(value_type state) noexcept;
+    };
+
+    /**
+    * @brief The checksum of `n` contiguous bytes.
+    * @tparam Checksum The checksum policy.
+    * @param data The bytes.
+    * @param n The number of bytes.
+    * @return `Checksum::finalize(Checksum::update(Checksum::initial, data, n))`.
+    */
+    template<typename Checksum>
+    [[nodiscard]] typename Checksum::value_type checksum_of(const std::byte *data, std::size_t n) noexcept;
+
+    /**
+    * @class checksum_sink
+    * @brief A sink that forwards to another sink and checksums every byte written through it.
+    *
+    * Bytes written in place (`contiguous` then `advance`) are checksummed at `advance`, just after
+    * the serializer wrote them; bytes copied with `write` are checksummed from the source.
+    *
+    * @tparam Checksum The checksum policy.
+    * @tparam Sink The wrapped sink type (`is_sink_v<Sink>`); referenced, not owned.
+    */
+    template<typename Checksum, typename Sink>
+    class checksum_sink{
+    public:
+        using value_type = typename Checksum::value_type; ///< The checksum type.
+
+        /**
+        * @brief Wrap `sink`, starting from `Checksum::initial`.
+        */
+        constexpr explicit checksum_sink(Sink &sink) noexcept;
+
+        [[nodiscard]] std::size_t available() const noexcept;          ///< Bytes left in the wrapped sink.
+        [[nodiscard]] std::byte *contiguous(std::size_t n) noexcept;     ///< The wrapped sink's cursor, if `n` bytes are in one region.
+        void advance(std::size_t n) noexcept;                            ///< Checksum and commit `n` bytes written in place.
+        void write(const std::byte *src, std::size_t n) noexcept;        ///< Checksum and copy `n <= available()` bytes.
+
+        /**
+        * @brief The checksum of every byte written so far.
+        */
+        [[nodiscard]] value_type value() const noexcept;
+
+    private:
+        Sink *_sink;              ///< The wrapped sink.
+        std::byte *_pending;      ///< The region handed out by the last `contiguous` call.
+        value_type _state;        ///< The checksum register.
+    };
+
+    /**
+    * @class checksum_source
+    * @brief A source that reads from another source and checksums every byte read through it.
+    *
+    * Bytes decoded in place (`contiguous` then `advance`) are checksummed at `advance`; bytes copied
+    * with `read` are checksummed from the destination.
+    *
+    * @tparam Checksum The checksum policy.
+    * @tparam Source The wrapped source type (`is_source_v<Source>`); referenced, not owned.
+    */
+    template<typename Checksum, typename Source>
+    class checksum_source{
+    public:
+        using value_type = typename Checksum::value_type; ///< The checksum type.
+
+        /**
+        * @brief Wrap `source`, starting from `Checksum::initial`.
+        */
+        constexpr explicit checksum_source(Source &source) noexcept;
+
+        [[nodiscard]] std::size_t available() const noexcept;              ///< Bytes left in the wrapped source.
+        [[nodiscard]] const std::byte *contiguous(std::size_t n) noexcept;   ///< The wrapped source's cursor, if `n` bytes are in one region.
+        void advance(std::size_t n) noexcept;                                ///< Checksum and consume `n` bytes read in place.
+        void read(std::byte *dst, std::size_t n) noexcept;                   ///< Copy out and checksum `n <= available()` bytes.
+
+        /**
+        * @brief The checksum of every byte read so far.
+        */
+        [[nodiscard]] value_type value() const noexcept;
+
+    private:
+        Source *_source;          ///< The wrapped source.
+        const std::byte *_pending; ///< The region handed out by the last `contiguous` call.
+        value_type _state;        ///< The checksum register.
+    };
+} // namespace eser::flat
+
+#include "checksum.tpp"
+#endif // ESER_FLAT_CHECKSUM_HPP_
@@ -0,0 +1,155 @@
+/**
+* @file checksum.tpp
+*
+* @brief Definition of functionality in checksum.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_CHECKSUM_TPP_
+#define ESER_FLAT_CHECKSUM_TPP_
+#include "checksum.hpp"
+#include <cassert>
+
+namespace eser::flat{
+    inline crc16_ccitt::value_type crc16_ccitt::update(value_type state, const std::byte *data, std::size_t n) noexcept
+    {
+        return internal::crc16_ccitt_update(state, data, n);
+    }
+
+    constexpr crc16_ccitt::value_type crc16_ccitt::finalize(value_type state) noexcept
+    {
+        return state;
+    }
+
+    inline crc32::value_type crc32::update(value_type state, const std::byte *data, std::size_t n) noexcept
+    {
+        return internal::crc32_update(state, data, n);
+    }
+
+    constexpr crc32::value_type crc32::finalize(value_type state) noexcept
+    {
+        return ~state;
+    }
+
+    inline crc32c::value_type crc32c::update(value_type state, const std::byte *data, std::size_t n) noexcept
+    {
+        return internal::crc32c_update(state, data, n);
+    }
+
+    constexpr crc32c::value_type crc32c::finalize(value_type state) noexcept
+    {
+        return ~state;
+    }
+
+    constexpr no_checksum::value_type no_checksum::update(value_type state, const std::byte *data, std::size_t n) noexcept
+    {
+        return (void)data, (void)n, state;
+    }
+
+    constexpr no_checksum::value_type no_checksum::finalize(value_type state) noexcept
+    {
+        return (void)state, 0;
+    }
+
+    template<typename Checksum>
+    inline typename Checksum::value_type checksum_of(const std::byte *data, std::size_t n) noexcept
+    {
+        return Checksum::finalize(Checksum::update(Checksum::initial, data, n));
+    }
+
+    template<typename Checksum, typename Sink>
+    constexpr checksum_sink<Checksum, Sink>::checksum_sink(Sink &sink) noexcept
+    : _sink(&sink), _pending(nullptr), _state(Checksum::initial)
+    {
+        static_assert(is_sink_v<Sink>, "checksum_sink wraps a type modelling the sink concept (see stream.hpp)");
+    }
+
+    template<typename Checksum, typename Sink>
+    inline std::size_t checksum_sink<Checksum, Sink>::available() const noexcept
+    {
+        return _sink->available();
+    }
+
+    template<typename Checksum, typename Sink>
+    inline std::byte *checksum_sink<Checksum, Sink>::contiguous(std::size_t n) noexcept
+    {
+        _pending = _sink->contiguous(n);
+        return _pending;
+    }
+
+    template<typename Checksum, typename Sink>
+    inline void checksum_sink<Checksum, Sink>::advance(std::size_t n) noexcept
+    {
+        assert(_pending != nullptr && "checksum_sink::advance without a preceding contiguous()");
+        _state = Checksum::update(_state, _pending, n);
+        _pending = nullptr;
+        _sink->advance(n);
+    }
+
+    template<typename Checksum, typename Sink>
+    inline void checksum_sink<Checksum, Sink>::write(const std::byte *src, std::size_t n) noexcept
+    {
+        _state = Checksum::update(_state, src, n);
+        _sink->write(src, n);
+    }
+
+    template<typename Checksum, typename Sink>
+    inline typename checksum_sink<Checksum, Sink>::value_type checksum_sink<Checksum, Sink>::value() const noexcept
+    {
+        return Checksum::finalize(_state);
+    }
+
+    template<typename Checksum, typename Source>
+    constexpr checksum_source<Checksum, Source>::checksum_source(Source &source) noexcept
+    : _source(&source), _pending(nullptr), _state(Checksum::initial)
+    {
+        static_assert(is_source_v<Source>, "checksum_source wraps a type modelling the source concept (see stream.hpp)");
+    }
+
+    template<typename Checksum, typename Source>
+    inline std::size_t checksum_source<Checksum, Source>::available() const noexcept
+    {
+        return _source->available();
+    }
+
+    template<typename Checksum, typename Source>
+    inline const std::byte *checksum_source<Checksum, Source>::contiguous(std::size_t n) noexcept
+    {
+        _pending = _source->contiguous(n);
+        return _pending;
+    }
+
+    template<typename Checksum, typename Source>
+    inline void checksum_source<Checksum, Source>::advance(std::size_t n) noexcept
+    {
+        assert(_pending != nullptr && "checksum_source::advance without a preceding contiguous()");
+        _state = Checksum::update(_state, _pending, n);
+        _pending = nullptr;
+        _source->advance(n);
+    }
+
+    template<typename Checksum, typename Source>
+    inline void checksum_source<Checksum, Source>::read(std::byte *dst, std::size_t n) noexcept
+    {
+        _source->read(dst, n);
+        _state = Checksum::update(_state, dst, n);
+    }
+
+    template<typename Checksum, typename Source>
+    inline typename checksum_source<Checksum, Source>::value_type checksum_source<Checksum, Source>::value() const noexcept
+    {
+        return Checksum::finalize(_state);
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_CHECKSUM_TPP_
@@ -0,0 +1,173 @@
+/**
+* @file convert.hpp
+*
+* @ingroup eser_flat
+*
+* @brief Byte-order conversion of a whole serialized message in place.
+*
+* A message `T...` written with one byte order can be rewritten in the other without decoding it.
+* The walk is driven by the message's compile-time layout: every multi-byte field is reversed at
+* its offset, and nothing else is touched.
+*
+* ```cpp
+* using sample = std::tuple<std::uint32_t, float[1024], fixed_string<16>>;
+*
+* // The blob came off the network big-endian; make it host order once, then read it freely.
+* convert_in_place<endianness::big, endianness::little, std::uint32_t, float[1024], fixed_string<16>>(blob, size);
+* auto samples = layout<std::uint32_t, float[1024], fixed_string<16>>::get<1>(blob);
+* ```
+*
+* - Consecutive fields whose elements have the same width are swapped as one run with the
+*   vectorized `internal::byteswap_copy` kernel; a `float[1024]` followed by a `std::uint32_t` is one
+*   call over 1025 elements.
+* - Endianness-neutral fields (single bytes, `bool`, `fixed_string`, any type with
+*   `is_endianness_neutral`) are skipped; so is everything when `From == To`.
+* - Structs described with `ESER_REFLECT` / `ESER_REFLECT_PACKED` are converted member by member;
+*   their padding is left as is.
+* - A bit group is repacked: its members sit at the opposite bit positions in the two orders, so
+*   the group is not a plain byte reversal.
+*
+* Bounded fields have no fixed offsets and are rejected at compile time, like in `layout`.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_CONVERT_HPP_
+#define ESER_FLAT_CONVERT_HPP_
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "../internal/byte.hpp"
+#include "../internal/traits.hpp"
+#include "../internal/endianness.hpp"
+#include "../internal/byteswap.hpp"
+#include "../utils/endianness.hpp"
+#include "../utils/bits.hpp"
+#include "../utils/reflect.hpp"
+#include "size.hpp"
+
+namespace eser::flat{
+    using utils::endianness;
+
+    /**
+    * @brief Rewrite a serialized message `T...` from the `From` byte order to the `To` byte order,
+    *        in place.
+    *
+    * Afterwards the buffer is byte for byte what `serialize<To>(values...)` would have written for
+    * the values `deserialize<From>` reads from it now.
+    *
+    * @tparam From The byte order the message was written with.
+    * @tparam To The byte order to convert it to.
+    * @tparam T... The message's field types, in wire order (as passed to `serialize(...)`). Must be
+    *              of fixed size.
+    * @param data The first byte of the message.
+    * @param size The bytes available at `data`.
+    * @return `serialized_size_of<T...>()`, the bytes converted; 0 (and nothing changed) if `size`
+    *         is smaller.
+    */
+    template<endianness From, endianness To, typename... T>
+    std::size_t convert_in_place(std::byte *data, std::size_t size) noexcept;
+
+    namespace details{
+        /**
+        * @brief The byte order whose wire differs from the host's when converting between `From`
+        *        and `To`, for `internal::needs_byte_swap_v`.
+        */
+        template<endianness From, endianness To>
+        inline constexpr endianness foreign_order_v = From != internal::host_endianness ? From : To;
+
+        /**
+        * @brief The element width of a field that converts as a plain run of scalars (a scalar, an
+        *        enum, a lone `utils::bits`, or a C-/`std::array` of them), 0 for any other field and
+        *        for a field with nothing to swap.
+        * @tparam Wire The foreign byte order (see @ref foreign_order_v).
+        * @tparam T The field type.
+        */
+        template<endianness Wire, typename T>
+        constexpr std::size_t swap_width() noexcept;
+
+        /**
+        * @brief The runs of message `T...`: maximal sequences of consecutive plain-run fields (see
+        *        @ref swap_width) of the same element width, each swapped with one kernel call.
+        *
+        * Bit-packed fields never belong to a run. Every query is `constexpr`.
+        *
+        * @tparam Wire The foreign byte order (see @ref foreign_order_v).
+        * @tparam T... The message's field types, in wire order.
+        */
+        template<endianness Wire, typename... T>
+        struct swap_runs{
+            /**
+            * @brief The element width of every field (0 for a field outside any run).
+            */
+            static constexpr std::array<std::size_t, sizeof...(T)> widths = [](){
+                std::array<std::size_t, sizeof...(T)> w = { swap_width<Wire, T>()... };
+                for (std::size_t i = 0; i < sizeof...(T); ++i) if (bit_groups<T...>::packed(i)) w[i] = 0;
+                return w;
+            }();
+
+            /**
+            * @brief Whether field `i` starts a run.
+            */
+            static constexpr bool starts(std::size_t i) noexcept
+            {
+                return widths[i] != 0 and (i == 0 or widths[i - 1] != widths[i]);
+            }
+
+            /**
+            * @brief The number of elements in the run field `i` starts.
+            */
+            static constexpr std::size_t elements(std::size_t i) noexcept
+            {
+                constexpr std::array<std::size_t, sizeof...(T)> sizes = { serialized_size_of<T>()... };
+                std::size_t count = 0;
+                for (std::size_t k = i; k < sizeof...(T) and widths[k] == widths[i]; ++k) count += sizes[k] / widths[k];
+                return count;
+            }
+        };
+
+        /**
+        * @brief Reverse every multi-byte scalar of the wire image of one `T` at `data`.
+        *
+        * Used for the fields that are not a plain run: described structs and arrays of them.
+        * @tparam Wire The foreign byte order (see @ref foreign_order_v).
+        * @tparam T The field type.
+        * @param data The field's first byte.
+        */
+        template<endianness Wire, typename T>
+        void swap_in_place(std::byte *data) noexcept;
+
+        /**
+        * @brief Repack the bit group whose first field is `First` from the `From` layout to the `To`
+        *        layout.
+        * @param data The group's first byte.
+        */
+        template<endianness From, endianness To, std::size_t First, typename... T, std::size_t... K>
+        void convert_bit_group(std::byte *data, std::index_sequence<K...>) noexcept;
+
+        /**
+        * @brief Convert field `I` of the message: at the start of a run, the whole run; at the first
+        *        field of a bit group, the group; nothing at a run's or group's other members.
+        * @param data The first byte of the message.
+        */
+        template<endianness From, endianness To, std::size_t I, typename... T>
+        void convert_field(std::byte *data) noexcept;
+
+        template<endianness From, endianness To, typename... T, std::size_t... I>
+        void convert_fields(std::byte *data, std::index_sequence<I...>) noexcept;
+    } // namespace details
+} // namespace eser::flat
+
+#include "convert.tpp"
+#endif // ESER_FLAT_CONVERT_HPP_
@@ -0,0 +1,131 @@
+/**
+* @file convert.tpp
+*
+* @brief Definition of functionality in convert.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_CONVERT_TPP_
+#define ESER_FLAT_CONVERT_TPP_
+#include "convert.hpp"
+#include "deserializer.hpp"   // for details::load_bit_group
+
+namespace eser::flat{
+    namespace details{
+        template<endianness Wire, typename T>
+        constexpr std::size_t swap_width() noexcept
+        {
+            using bare_t = std::remove_cv_t<std::remove_reference_t<T>>;
+            using leaf = std::remove_cv_t<internal::array_leaf_t<bare_t>>;
+            if constexpr ((std::is_arithmetic_v<leaf> or std::is_enum_v<leaf> or utils::is_bits_v<leaf>)
+                          and internal::needs_byte_swap_v<Wire, bare_t>)
+                return sizeof(leaf);
+            else
+                return 0;
+        }
+
+        template<endianness Wire, typename T>
+        inline void swap_in_place(std::byte *data) noexcept
+        {
+            using bare_t = std::remove_cv_t<std::remove_reference_t<T>>;
+            if constexpr (not internal::needs_byte_swap_v<Wire, bare_t>) {
+                static_cast<void>(data);
+            } else if constexpr (swap_width<Wire, bare_t>() != 0) {
+                constexpr std::size_t width = swap_width<Wire, bare_t>();
+                internal::byteswap_copy<width>(data, data, serialized_size_of<bare_t>() / width);
+            } else if constexpr (std::is_array_v<bare_t> or internal::is_std_array_v<bare_t>) {
+                using element = std::remove_cv_t<std::remove_reference_t<decltype(std::declval<bare_t &>()[0])>>;
+                constexpr std::size_t stride = serialized_size_of<element>();
+                for (std::size_t i = 0; i < serialized_size_of<bare_t>() / stride; ++i)
+                    swap_in_place<Wire, element>(data + i * stride);
+            } else if constexpr (utils::is_packed_v<bare_t>) {
+                // back to back: each member starts where the previous one's wire image ends
+                std::size_t offset = 0;
+                utils::reflection_t<bare_t>::for_each([data, &offset](auto m){
+                    using value_type = typename decltype(m)::value_type;
+                    swap_in_place<Wire, value_type>(data + offset);
+                    offset += serialized_size_of<value_type>();
+                });
+            } else {
+                static_assert(utils::is_reflected_v<bare_t>,
+                    "[eser] trivially-copyable structs are serialized as raw bytes and cannot be "
+                    "byte-swapped; describe the members with ESER_REFLECT (eser/utils/reflect.hpp), "
+                    "or specialize is_endianness_neutral if the type is byte-only");
+                utils::reflection_t<bare_t>::for_each([data](auto m){
+                    swap_in_place<Wire, typename decltype(m)::value_type>(data + decltype(m)::offset);
+                });
+            }
+        }
+
+        template<endianness From, endianness To, std::size_t First, typename... T, std::size_t... K>
+        inline void convert_bit_group(std::byte *data, std::index_sequence<K...>) noexcept
+        {
+            using groups = bit_groups<T...>;
+            constexpr std::size_t bytes = groups::group_size(First);
+            constexpr std::size_t span = bytes * 8;
+            constexpr auto shift = [](endianness wire, std::size_t i){
+                return wire == endianness::little ? groups::bit_offset(i) : span - groups::bit_offset(i) - groups::widths[i];
+            };
+            constexpr auto mask = [](std::size_t width){
+                return width >= 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << width) - 1;
+            };
+            const std::uint64_t word = load_bit_group<From, bytes>(data);
+            std::uint64_t converted = 0;
+            ((converted |= ((word >> shift(From, First + K)) & mask(groups::widths[First + K])) << shift(To, First + K)), ...);
+            for (std::size_t b = 0; b < bytes; ++b) {
+                const std::size_t at = To == endianness::little ? 8 * b : 8 * (bytes - 1 - b);
+                data[b] = static_cast<std::byte>(converted >> at);
+            }
+        }
+
+        template<endianness From, endianness To, std::size_t I, typename... T>
+        inline void convert_field(std::byte *data) noexcept
+        {
+            using groups = bit_groups<T...>;
+            constexpr endianness wire = foreign_order_v<From, To>;
+            using runs = swap_runs<wire, T...>;
+
+            if constexpr (runs::widths[I] != 0) {
+                if constexpr (runs::starts(I)) {
+                    std::byte *run = data + groups::offset(I);
+                    internal::byteswap_copy<runs::widths[I]>(run, run, runs::elements(I));
+                }
+            } else if constexpr (groups::packed(I)) {
+                if constexpr (groups::first(I) == I)
+                    convert_bit_group<From, To, I, T...>(data + groups::offset(I), std::make_index_sequence<groups::members(I)>{});
+            } else {
+                swap_in_place<wire, internal::type_at_t<I, T...>>(data + groups::offset(I));
+            }
+        }
+
+        template<endianness From, endianness To, typename... T, std::size_t... I>
+        inline void convert_fields(std::byte *data, std::index_sequence<I...>) noexcept
+        {
+            (convert_field<From, To, I, T...>(data), ...);
+        }
+    } // namespace details
+
+    template<endianness From, endianness To, typename... T>
+    inline std::size_t convert_in_place(std::byte *data, std::size_t size) noexcept
+    {
+        static_assert(sizeof...(T) > 0, "A message needs at least one field");
+        static_assert(details::is_fixed_size_v<T...>, "[eser] convert_in_place needs fixed field offsets; bounded_vector / bounded_string fields have none");
+        constexpr std::size_t bytes = serialized_size_of<T...>();
+        if (size < bytes) return 0;
+        if constexpr (From != To)
+            details::convert_fields<From, To, T...>(data, std::index_sequence_for<T...>{});
+        return bytes;
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_CONVERT_TPP_
@@ -0,0 +1,224 @@
+/**
+* @file delta.hpp
+*
+* @ingroup eser_flat
+*
+* @brief Stateful delta codecs for streams of frames that change a few fields at a time.
+*
+* A telemetry loop that sends `serialize(a, b, c, ...)` every tick resends the fields that did not
+* change as well. `delta_encoder<Wire, T...>` keeps the previous frame's wire image and sends only
+* what differs from it; `delta_decoder<Wire, T...>` keeps the same image on the receiving side and
+* rebuilds the full message:
+*
+* ```cpp
+* delta_encoder<endianness::big, std::uint32_t, float, float, std::uint16_t> tx;
+* std::byte packet[tx.max_size()];
+* const std::size_t n = tx.encode_into(packet, sizeof(packet), tick, roll, pitch, status);
+*
+* delta_decoder<endianness::big, std::uint32_t, float, float, std::uint16_t> rx;
+* auto frame = rx.decode(packet, n);   // std::optional<std::tuple<std::uint32_t, float, float, std::uint16_t>>
+* ```
+*
+* Two encodings, both compared against the previous frame:
+*
+* - **Changed fields** (`encode_into` / `decode`): a bitmap of `ceil(sizeof...(T) / 8)` bytes, bit
+*   `i % 8` of byte `i / 8` set when field `i` changed, followed by the wire bytes of the changed
+*   fields in order. A bit group of `utils::bits` fields is one field, reported on its first member.
+* - **XOR** (`encode_xor_into` / `decode_xor`): the frame's wire image XOR the previous one, always
+*   `serialized_size_of<T...>()` bytes. Unchanged bytes are zero, which a downstream compressor
+*   squeezes out.
+*
+* Both ends start from an all-zero image, so the first frame carries every nonzero field. The two
+* ends must see the same sequence of frames: a lost or reordered packet desynchronizes them until
+* both are `reset()`, or until the encoder sends a full frame after `refresh()`.
+*
+* Comparison works on wire bytes, so "changed" means "encodes differently": `-0.0f` and `0.0f` differ,
+* and two NaNs with the same bits do not.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_DELTA_HPP_
+#define ESER_FLAT_DELTA_HPP_
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+#include "../internal/byte.hpp"
+#include "../internal/traits.hpp"
+#include "../utils/endianness.hpp"
+#include "size.hpp"
+
+namespace eser::flat{
+    using utils::endianness;
+
+    namespace details{
+        /**
+        * @brief The bytes of the changed-field bitmap of a message with `Fields` fields.
+        * @tparam Fields The number of fields.
+        */
+        template<std::size_t Fields>
+        inline constexpr std::size_t delta_bitmap_size_v = (Fields + 7) / 8;
+
+        /**
+        * @brief The wire offset and size of every field of `T...`; a bit group is one field at its
+        *        first member, the other members have size 0.
+        */
+        template<typename... T>
+        struct delta_fields{
+            static constexpr std::array<std::size_t, sizeof...(T)> offsets = [](){
+                std::array<std::size_t, sizeof...(T)> o{};
+                for (std::size_t i = 0; i < sizeof...(T); ++i) o[i] = bit_groups<T...>::offset(i);
+                return o;
+            }();
+            static constexpr std::array<std::size_t, sizeof...(T)> sizes = [](){
+                std::array<std::size_t, sizeof...(T)> s{};
+                for (std::size_t i = 0; i < sizeof...(T); ++i) s[i] = bit_groups<T...>::wire_size(i);
+                return s;
+            }();
+        };
+    } // namespace details
+
+    /**
+    * @class delta_encoder
+    * @brief Encodes each frame of `T...` against the previous one.
+    *
+    * Holds the wire image of the last frame encoded (`serialized_size_of<T...>()` bytes) and nothing
+    * else; it is a plain value and may be copied to snapshot the stream state.
+    *
+    * @tparam Wire The byte order of the fields, as in `serialize<Wire>`.
+    * @tparam T... The message's field types, in wire order. Must be of fixed size.
+    */
+    template<endianness Wire, typename... T>
+    class delta_encoder{
+        static_assert(sizeof...(T) > 0, "A message needs at least one field");
+        static_assert(details::is_fixed_size_v<T...>, "[eser] a delta codec compares fields at fixed offsets; bounded_vector / bounded_string fields have none");
+
+    public:
+        /**
+        * @brief The most bytes `encode_into` writes: the bitmap and every field.
+        */
+        [[nodiscard]] static constexpr std::size_t max_size() noexcept;
+
+        /**
+        * @brief The bytes `encode_xor_into` writes: the full wire image.
+        */
+        [[nodiscard]] static constexpr std::size_t xor_size() noexcept;
+
+        /**
+        * @brief An encoder whose previous frame is all zero bytes.
+        */
+        constexpr delta_encoder() noexcept;
+
+        /**
+        * @brief Write the changed-field bitmap and the fields of `values` that differ from the
+        *        previous frame, which `values` then becomes.
+        *
+        * @param buffer The output.
+        * @param size The bytes available at `buffer`; `max_size()` always suffices.
+        * @param values The frame.
+        * @return The bytes written, or `0` if they do not fit — nothing is written and the previous
+        *         frame is kept (an `assert` fires in debug builds, as in `serializer`).
+        */
+        std::size_t encode_into(std::byte *buffer, std::size_t size, const T &...values) noexcept;
+
+        /**
+        * @brief Write the wire image of `values` XOR the previous frame, which `values` then becomes.
+        *
+        * @param buffer The output.
+        * @param size The bytes available at `buffer`; must be at least `xor_size()`.
+        * @param values The frame.
+        * @return `xor_size()`, or `0` if the buffer is too small (nothing written, state kept).
+        */
+        std::size_t encode_xor_into(std::byte *buffer, std::size_t size, const T &...values) noexcept;
+
+        /**
+        * @brief Send every field on the next `encode_into`, e.g. once a decoder has joined or lost
+        *        a packet. The previous frame itself is kept.
+        */
+        void refresh() noexcept;
+
+        /**
+        * @brief Return to the all-zero previous frame, in step with `delta_decoder::reset`.
+        */
+        void reset() noexcept;
+
+    private:
+        /**
+        * @brief Serialize `values` into a wire image.
+        */
+        static std::array<std::byte, serialized_size_of<T...>()> image_of(const T &...values) noexcept;
+
+        std::array<std::byte, serialized_size_of<T...>()> _previous; ///< Wire image of the last frame.
+        bool _full;                                                  ///< Whether the next frame sends every field.
+    };
+
+    /**
+    * @class delta_decoder
+    * @brief Rebuilds each frame of `T...` from a `delta_encoder`'s output and the previous frame.
+    *
+    * @tparam Wire The byte order of the fields; must match the encoder's.
+    * @tparam T... The message's field types; must match the encoder's.
+    */
+    template<endianness Wire, typename... T>
+    class delta_decoder{
+        static_assert(sizeof...(T) > 0, "A message needs at least one field");
+        static_assert(details::is_fixed_size_v<T...>, "[eser] a delta codec compares fields at fixed offsets; bounded_vector / bounded_string fields have none");
+
+    public:
+        /**
+        * @brief The decoded message: the fields, C-arrays mapped to `std::array`.
+        */
+        using message_type = std::tuple<internal::as_std_array_t<T>...>;
+
+        /**
+        * @brief A decoder whose previous frame is all zero bytes.
+        */
+        constexpr delta_decoder() noexcept;
+
+        /**
+        * @brief Apply a changed-field frame to the previous frame and decode the result.
+        *
+        * @param data The output of one `delta_encoder::encode_into` call.
+        * @param size Its length in bytes; it must be exact.
+        * @return The full message, or `std::nullopt` (state unchanged) if the frame is truncated,
+        *         has trailing bytes, or flags a field the message does not have.
+        */
+        [[nodiscard]] std::optional<message_type> decode(const std::byte *data, std::size_t size) noexcept;
+
+        /**
+        * @brief Apply an XOR frame to the previous frame and decode the result.
+        *
+        * @param data The output of one `delta_encoder::encode_xor_into` call.
+        * @param size Its length in bytes; must be `serialized_size_of<T...>()`.
+        * @return The full message, or `std::nullopt` (state unchanged) if `size` is wrong.
+        */
+        [[nodiscard]] std::optional<message_type> decode_xor(const std::byte *data, std::size_t size) noexcept;
+
+        /**
+        * @brief Return to the all-zero previous frame, in step with `delta_encoder::reset`.
+        */
+        void reset() noexcept;
+
+    private:
+        /**
+        * @brief Decode the current image.
+        */
+        std::optional<message_type> current() const noexcept;
+
+        std::array<std::byte, serialized_size_of<T...>()> _previous; ///< Wire image of the last frame.
+    };
+} // namespace eser::flat
+
+#include "delta.tpp"
+#endif // ESER_FLAT_DELTA_HPP_
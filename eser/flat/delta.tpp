@@ -0,0 +1,164 @@
+/**
+* @file delta.tpp
+*
+* @brief Definition of functionality in delta.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_DELTA_TPP_
+#define ESER_FLAT_DELTA_TPP_
+#include "delta.hpp"
+#include <cassert>
+#include <cstring>
+#include "serializer.hpp"
+#include "deserializer.hpp"
+
+namespace eser::flat{
+    template<endianness Wire, typename... T>
+    constexpr std::size_t delta_encoder<Wire, T...>::max_size() noexcept
+    {
+        return details::delta_bitmap_size_v<sizeof...(T)> + serialized_size_of<T...>();
+    }
+
+    template<endianness Wire, typename... T>
+    constexpr std::size_t delta_encoder<Wire, T...>::xor_size() noexcept
+    {
+        return serialized_size_of<T...>();
+    }
+
+    template<endianness Wire, typename... T>
+    constexpr delta_encoder<Wire, T...>::delta_encoder() noexcept
+    : _previous{}, _full(false)
+    {
+    }
+
+    template<endianness Wire, typename... T>
+    inline std::size_t delta_encoder<Wire, T...>::encode_into(std::byte *buffer, std::size_t size, const T &...values) noexcept
+    {
+        using fields = details::delta_fields<T...>;
+        constexpr std::size_t bitmap = details::delta_bitmap_size_v<sizeof...(T)>;
+        const auto image = image_of(values...);
+
+        std::array<std::byte, bitmap> changed{};
+        std::size_t bytes = bitmap;
+        for (std::size_t i = 0; i < sizeof...(T); ++i) {
+            const std::size_t at = fields::offsets[i], width = fields::sizes[i];
+            if (width == 0) continue;
+            if (_full or std::memcmp(image.data() + at, _previous.data() + at, width) != 0) {
+                changed[i / 8] |= std::byte{1} << (i % 8);
+                bytes += width;
+            }
+        }
+        if (bytes > size) {
+            assert(false && "Buffer size is insufficient for the delta frame");
+            return 0;
+        }
+
+        std::memcpy(buffer, changed.data(), bitmap);
+        std::byte *out = buffer + bitmap;
+        for (std::size_t i = 0; i < sizeof...(T); ++i) {
+            if ((changed[i / 8] & (std::byte{1} << (i % 8))) == std::byte{0}) continue;
+            std::memcpy(out, image.data() + fields::offsets[i], fields::sizes[i]);
+            out += fields::sizes[i];
+        }
+        _previous = image;
+        _full = false;
+        return bytes;
+    }
+
+    template<endianness Wire, typename... T>
+    inline std::size_t delta_encoder<Wire, T...>::encode_xor_into(std::byte *buffer, std::size_t size, const T &...values) noexcept
+    {
+        if (size < xor_size()) {
+            assert(false && "Buffer size is insufficient for the delta frame");
+            return 0;
+        }
+        const auto image = image_of(values...);
+        for (std::size_t i = 0; i < image.size(); ++i) buffer[i] = image[i] ^ _previous[i];
+        _previous = image;
+        _full = false;
+        return xor_size();
+    }
+
+    template<endianness Wire, typename... T>
+    inline void delta_encoder<Wire, T...>::refresh() noexcept
+    {
+        _full = true;
+    }
+
+    template<endianness Wire, typename... T>
+    inline void delta_encoder<Wire, T...>::reset() noexcept
+    {
+        _previous = {};
+        _full = false;
+    }
+
+    template<endianness Wire, typename... T>
+    inline std::array<std::byte, serialized_size_of<T...>()> delta_encoder<Wire, T...>::image_of(const T &...values) noexcept
+    {
+        std::array<std::byte, serialized_size_of<T...>()> image;
+        details::serialize_fields<Wire>(image.data(), image.size(), std::forward_as_tuple(values...));
+        return image;
+    }
+
+    template<endianness Wire, typename... T>
+    constexpr delta_decoder<Wire, T...>::delta_decoder() noexcept
+    : _previous{}
+    {
+    }
+
+    template<endianness Wire, typename... T>
+    inline std::optional<typename delta_decoder<Wire, T...>::message_type> delta_decoder<Wire, T...>::decode(const std::byte *data, std::size_t size) noexcept
+    {
+        using fields = details::delta_fields<T...>;
+        constexpr std::size_t bitmap = details::delta_bitmap_size_v<sizeof...(T)>;
+        if (size < bitmap) return std::nullopt;
+
+        auto image = _previous;
+        const std::byte *in = data + bitmap;
+        std::size_t left = size - bitmap;
+        for (std::size_t i = 0; i < bitmap * 8; ++i) {
+            if ((data[i / 8] & (std::byte{1} << (i % 8))) == std::byte{0}) continue;
+            // a flag past the last field, or on a non-first member of a bit group, is malformed
+            if (i >= sizeof...(T) or fields::sizes[i] == 0 or left < fields::sizes[i]) return std::nullopt;
+            std::memcpy(image.data() + fields::offsets[i], in, fields::sizes[i]);
+            in += fields::sizes[i];
+            left -= fields::sizes[i];
+        }
+        if (left != 0) return std::nullopt;
+        _previous = image;
+        return current();
+    }
+
+    template<endianness Wire, typename... T>
+    inline std::optional<typename delta_decoder<Wire, T...>::message_type> delta_decoder<Wire, T...>::decode_xor(const std::byte *data, std::size_t size) noexcept
+    {
+        if (size != _previous.size()) return std::nullopt;
+        for (std::size_t i = 0; i < _previous.size(); ++i) _previous[i] ^= data[i];
+        return current();
+    }
+
+    template<endianness Wire, typename... T>
+    inline void delta_decoder<Wire, T...>::reset() noexcept
+    {
+        _previous = {};
+    }
+
+    template<endianness Wire, typename... T>
+    inline std::optional<typename delta_decoder<Wire, T...>::message_type> delta_decoder<Wire, T...>::current() const noexcept
+    {
+        return deserialize<Wire>(_previous.data(), _previous.size()).template to<message_type>();
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_DELTA_TPP_
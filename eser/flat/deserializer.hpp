@@ -40,22 +40,259 @@
 *
 *       Added the `Wire` endianness policy: `deserializer<Wire>` byte-reverses scalars when
 *       `Wire` differs from the host order; structs are restricted to native-endian wires.
+* - 2026-10-14
+*       Added `to_range<T>(out, count)`: reads a batch of identical records with a single length
+*       check, collapsing to one `memcpy` when no record needs byte-swapping.
+* - 2026-10-14
+*       `to<T>()` accepts C-arrays (returned as the matching `std::array`). Added `view<T>()` and
+*       `field_view`: a bounds-checked, zero-copy view over the wire bytes that decodes lazily.
+*       The per-value decoding moved into `details::deserialize_value`, shared by both.
+* - 2026-10-14
+*       Added `stream_deserializer` and `deserialize(Source&)`: read from a chunk list, ring buffer
+*       or any other source (see stream.hpp) without first copying into a contiguous buffer.
+* - 2026-10-14
+*       Tuple reads unpack bit groups of consecutive `utils::bits` fields (see utils/bits.hpp).
+* - 2026-10-14
+*       Added the bounded `to<T>()` overload for `utils::bounded_vector` / `utils::bounded_string`;
+*       tuple reads with bounded fields validate every length prefix and roll back on failure.
+*       `stream_deserializer`, `to_range` and `view` reject bounded types at compile time.
+* - 2026-10-14
+*       Structs described with `ESER_REFLECT` can be read from a non-native wire.
+* - 2026-10-14
+*       Structs described with `ESER_REFLECT_PACKED` are read from their packed image; every
+*       length check uses `serialized_size_of`.
+* - 2026-10-14
+*       Added the executor overload of `to_range`, which splits a large batch across threads (see
+*       executor.hpp).
+* - 2026-10-14
+*       `to()` reports each message, the bytes it consumed and failures to the observer policy
+*       (see observer.hpp); the default policy compiles to nothing.
+* - 2026-10-14
+*       Added `unchecked_deserializer`, created by `claim<T...>()` / `claim(bytes)` (checked once)
+*       or `deserialize<Wire>(unchecked, data, length)` (unchecked): values come back directly,
+*       with no per-read length check.
+* - 2026-10-14
+*       Added `to<T>(arena)`: `utils::arena_vector` fields are decoded into a caller-provided arena.
 */
 #ifndef ESER_FLAT_DESERIALIZER_HPP_
 #define ESER_FLAT_DESERIALIZER_HPP_
 #include "../internal/byte.hpp"
 #include "../internal/traits.hpp"
 #include "../utils/endianness.hpp"
+#include "../utils/bits.hpp"
+#include "../utils/arena.hpp"
+#include "observer.hpp"
+#include "size.hpp"
+#include "stream.hpp"
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
 #include <tuple>
 #include <array>
 #include <optional>
+#include <utility>
 
 namespace eser::flat{
     using utils::endianness;
 
+    namespace details{
+        /**
+        * @brief Decode one trivially-copyable value from its wire bytes.
+        *
+        * Copies `sizeof(T)` bytes from `data` and converts them from the `Wire` order. A `bool` is
+        * normalized (any non-zero byte is `true`); a `std::array` is swapped while it is copied.
+        * Shared by `deserializer` (which advances its cursor afterwards) and `field_view`.
+        *
+        * @tparam Wire The byte order of the stream.
+        * @tparam T The trivially-copyable type to decode.
+        * @param data The first wire byte; the caller guarantees `sizeof(T)` readable bytes.
+        * @return The decoded value.
+        */
+        template<endianness Wire, typename T>
+        T deserialize_value(const std::byte *data) noexcept;
+
+        /**
+        * @brief Decode a struct described with `ESER_REFLECT_PACKED` from its packed wire image,
+        *        member by member in the listed order.
+        *
+        * @tparam Wire The byte order of the stream.
+        * @tparam T The packed struct.
+        * @param out Receives the members; unlisted members keep their value.
+        * @param data The first wire byte; the caller guarantees `serialized_size_of<T>()` bytes.
+        */
+        template<endianness Wire, typename T>
+        void deserialize_members(T &out, const std::byte *data) noexcept;
+
+        /**
+        * @brief Decode one trivially-copyable value from a source, across region boundaries if needed.
+        *
+        * If the source's current region holds all `sizeof(T)` bytes the value is decoded in place by
+        * @ref deserialize_value. Otherwise a value that needs no conversion is copied straight into
+        * `out`; an array is split element by element; anything else is gathered into a stack
+        * temporary of its own size and decoded from there.
+        *
+        * @tparam Wire The byte order of the stream.
+        * @tparam Source A type modelling the source concept (see stream.hpp).
+        * @tparam T The trivially-copyable type to decode.
+        * @param source The input source; the caller guarantees `sizeof(T)` available bytes.
+        * @param out Receives the decoded value.
+        */
+        template<endianness Wire, typename Source, typename T>
+        void deserialize_value_from(Source &source, T &out) noexcept;
+
+        /**
+        * @brief The fewest wire bytes fields `I..` of the message `Es...` can occupy: bit groups
+        *        packed, and every bounded field empty (its length prefix alone).
+        * @pre Field `I` does not sit inside a bit group after its first member.
+        */
+        template<std::size_t I, typename... Es>
+        constexpr std::size_t min_wire_size() noexcept;
+
+        /**
+        * @brief The wire size of a tuple `Es...`: the sum of their sizes, with bit groups packed.
+        *        With bounded fields, the minimum (@ref min_wire_size).
+        */
+        template<typename... Es>
+        constexpr std::size_t tuple_wire_size() noexcept;
+
+        /**
+        * @brief Load the `Bytes` wire bytes of a bit group into one word.
+        *
+        * The inverse of the byte store in `serialize_bit_group`: the first byte is the least
+        * significant on a little-endian wire and the most significant on a big-endian one.
+        *
+        * @tparam Wire The byte order of the stream.
+        * @tparam Bytes The group size in bytes (at most 8).
+        * @param data The group's first wire byte.
+        * @return The packed word.
+        */
+        template<endianness Wire, std::size_t Bytes>
+        std::uint64_t load_bit_group(const std::byte *data) noexcept;
+
+        /**
+        * @brief Extract field `I` of the tuple `Es...` from the packed word of its bit group.
+        *
+        * @tparam Wire The byte order of the stream.
+        * @tparam I The field index; field `I` is a packed `utils::bits`.
+        * @tparam Es The tuple's element types.
+        * @param group The packed word.
+        * @return The field.
+        */
+        template<endianness Wire, std::size_t I, typename... Es>
+        internal::type_at_t<I, Es...> extract_bit_field(std::uint64_t group) noexcept;
+    }
+
+    template<endianness Wire>
+    class deserializer;
+
+    namespace details{
+        /**
+        * @struct no_arena
+        * @brief The arena of a read that was given none; a `utils::arena_vector` field then does not
+        *        compile.
+        */
+        struct no_arena{};
+    } // namespace details
+
+    template<endianness Wire>
+    class unchecked_deserializer;
+
+    /**
+    * @struct unchecked_t
+    * @brief Tag selecting the unchecked decode policy: `deserialize<Wire>(unchecked, data, length)`.
+    * @see unchecked_deserializer
+    */
+    struct unchecked_t{
+        explicit constexpr unchecked_t() noexcept = default;
+    };
+
+    /**
+    * @brief The tag value for `deserialize<Wire>(unchecked, data, length)`.
+    */
+    inline constexpr unchecked_t unchecked{};
+
+    /**
+    * @class field_view
+    * @brief A zero-copy, read-only view over one serialized value still sitting in the input buffer.
+    *
+    * Returned by `deserializer::view<T>()`. Nothing is copied when the view is made: it holds only a
+    * pointer to the `sizeof(T)` wire bytes, whose presence the deserializer checked. Values are
+    * decoded — and byte-swapped when `Wire` differs from the host — lazily, on access, and only the
+    * part that is accessed: indexing a view of a `std::array<float, 1024>` decodes one `float`.
+    * On a native wire, decoding is a plain (alignment-safe) `memcpy` of the accessed element.
+    *
+    * For array types the view is indexable; indexing a nested array yields a view of the inner
+    * array, indexing an array of leaves yields the decoded element.
+    *
+    * @tparam Wire The byte order of the stream.
+    * @tparam T The viewed type (trivially copyable; C-arrays are viewed as the matching `std::array`).
+    *
+    * @warning The view does not own the bytes: it must not outlive the buffer given to `deserialize`.
+    */
+    template<endianness Wire, typename T>
+    class field_view{
+    public:
+        using value_type = T; ///< The viewed type.
+
+        /**
+        * @brief Decode the whole value (equivalent to `to<T>()` on the same bytes).
+        * @return The decoded value.
+        */
+        [[nodiscard]] T get() const noexcept;
+
+        /**
+        * @brief The wire bytes of the viewed value, in place.
+        * @return A pointer to the first of `size_bytes()` bytes inside the input buffer.
+        */
+        [[nodiscard]] constexpr const std::byte* data() const noexcept;
+
+        /**
+        * @brief The number of wire bytes the value occupies.
+        * @return `sizeof(T)`.
+        */
+        [[nodiscard]] static constexpr std::size_t size_bytes() noexcept;
+
+        /**
+        * @brief The number of elements of a viewed array.
+        * @return `std::tuple_size_v<T>`.
+        */
+        template<typename U = T, std::enable_if_t<internal::is_std_array_v<U>, bool> = true>
+        [[nodiscard]] static constexpr std::size_t size() noexcept;
+
+        /**
+        * @brief Access element `index` of a viewed array.
+        *
+        * @param index The element index; must be `< size()` (checked by `assert` in debug builds).
+        * @return The decoded element, or a `field_view` of it when the element is itself an array.
+        */
+        template<typename U = T, std::enable_if_t<internal::is_std_array_v<U>, bool> = true>
+        [[nodiscard]] auto operator[](std::size_t index) const noexcept;
+
+        /**
+        * @brief Bounds-checked access to element `index` of a viewed array.
+        *
+        * @param index The element index.
+        * @return `std::nullopt` if `index >= size()`; otherwise what `operator[]` returns.
+        */
+        template<typename U = T, std::enable_if_t<internal::is_std_array_v<U>, bool> = true>
+        [[nodiscard]] auto at(std::size_t index) const noexcept;
+
+    private:
+        const std::byte *_data; ///< The first wire byte of the value (not owned).
+
+        /**
+        * @brief Construct a view over wire bytes already known to be in bounds.
+        * @param data The first wire byte of the value.
+        */
+        constexpr explicit field_view(const std::byte *data) noexcept;
+
+        template<endianness W>
+        friend class deserializer;
+
+        template<endianness W, typename U>
+        friend class field_view;
+    };
+
     /**
     * @class deserializer
     * @brief A utility class for deserializing data from a byte stream.
@@ -86,7 +323,8 @@ namespace eser::flat{
     *
     * @tparam Wire The byte order of the stream being read (default `endianness::little`). When it
     *              differs from the host order, scalar fields are byte-reversed; trivially-copyable
-    *              structs may then not be read (raw bytes cannot be swapped).
+    *              structs may then be read only if described with `ESER_REFLECT` (their members
+    *              are swapped one by one), as raw bytes cannot be swapped.
     */
     template<endianness Wire = endianness::little>
     class deserializer{
@@ -99,9 +337,10 @@ namespace eser::flat{
         * naming `std::array` elements (not C-arrays, which are not valid tuple members).
         *
         * @tparam Tuple A `std::tuple<Es...>` whose elements are each deserializable
-        *               (scalar, enum, `std::array`, or trivially-copyable struct).
+        *               (scalar, enum, `std::array`, trivially-copyable struct, or bounded field).
         * @return `std::nullopt` if the buffer holds fewer than the required bytes
-        *         (`sizeof(Es) + ...`); otherwise an engaged optional holding the tuple.
+        *         (`serialized_size_of<Es...>()`), or if a bounded field's length prefix is invalid (see the
+        *         bounded overload); the cursor then stays put. Otherwise the engaged tuple.
         */
         template<typename Tuple, std::enable_if_t<internal::is_tuple_v<Tuple>, bool> = true>
         [[nodiscard]] std::optional<Tuple> to() noexcept;
@@ -113,12 +352,12 @@ namespace eser::flat{
         * This single overload covers scalars, enums, `std::array`, and trivially-copyable
         * structs/PODs — every type that is safe to copy with `memcpy` and has a fixed layout.
         *
-        * To read a fixed-size array, name a `std::array<U, N>` (C-arrays are intentionally not
-        * accepted: they cannot be returned by value and cannot be `std::tuple` elements).
+        * To read a fixed-size array, name a `std::array<U, N>`, or the C-array type itself (see the
+        * C-array overload, which returns the matching `std::array`).
         *
         * @tparam T The type to deserialize. Must be:
         *          - `std::is_trivially_copyable_v<T> == true`
-        *          - not a C-array type (name a `std::array` instead)
+        *          - not a C-array type (handled by the C-array overload)
         *          - not a `std::tuple` (use the tuple overload)
         *
         * @return `std::nullopt` if the buffer holds fewer than `sizeof(T)` bytes;
@@ -134,10 +373,176 @@ namespace eser::flat{
         template<typename T, std::enable_if_t<
             std::is_trivially_copyable_v<T> &&
             !std::is_array_v<T> &&
-            !internal::is_tuple_v<T>, bool> = true>
+            !internal::is_tuple_v<T> &&
+            !utils::is_bounded_v<T>, bool> = true>
         [[nodiscard]] std::optional<T> to() noexcept;
 
-        
+        /**
+        * @brief Deserialize a `utils::bounded_vector` or `utils::bounded_string`.
+        *
+        * Reads the `length_type` prefix, then that many elements. Only the used elements are on
+        * the wire, so the read consumes `sizeof(length_type) + size() * sizeof(value_type)` bytes.
+        * The prefix comes off the wire and is validated before any element is read: a count above
+        * `capacity()`, or one promising more elements than the buffer holds, is rejected.
+        *
+        * @tparam T A bounded type.
+        * @return `std::nullopt` if the prefix is missing or invalid (the cursor stays put);
+        *         otherwise the engaged value.
+        */
+        template<typename T, std::enable_if_t<utils::is_bounded_v<T>, bool> = true>
+        [[nodiscard]] std::optional<T> to() noexcept;
+
+        /**
+        * @brief Deserialize a `std::tuple` whose `utils::arena_vector` fields are placed in `arena`.
+        *
+        * Exactly `to<Tuple>()`, except that each `arena_vector<E, N>` field takes `size()` elements
+        * from the arena instead of inline storage. Other fields, bounded ones included, are read
+        * as usual. Nothing is allocated from the heap: decoding a batch costs one arena reset.
+        *
+        * ```cpp
+        * utils::arena arena(scratch);
+        * auto m = d.to<std::tuple<std::uint32_t, utils::arena_vector<float, 1024>>>(arena);
+        * ```
+        *
+        * @tparam Tuple A `std::tuple<Es...>` of deserializable element types.
+        * @tparam Arena Any type with `void *allocate(std::size_t bytes, std::size_t alignment)`:
+        *               `utils::arena`, or a `std::pmr::memory_resource` on hosted builds.
+        * @param arena Receives the elements; the result points into it.
+        * @return `std::nullopt` if the buffer is too short, a length prefix is invalid, or the
+        *         arena returned `nullptr`; the cursor then stays put. Blocks already taken for the
+        *         rejected message stay in the arena until its next reset.
+        */
+        template<typename Tuple, typename Arena, std::enable_if_t<internal::is_tuple_v<Tuple>, bool> = true>
+        [[nodiscard]] std::optional<Tuple> to(Arena &arena) noexcept;
+
+        /**
+        * @brief Deserialize a single bounded field, an `arena_vector`'s elements placed in `arena`.
+        * @tparam T A bounded type (`utils::arena_vector`, `bounded_vector`, `bounded_string`).
+        * @tparam Arena As for the tuple overload.
+        * @param arena Receives the elements.
+        * @return `std::nullopt` if the prefix is missing or invalid or the arena is exhausted (the
+        *         cursor stays put); otherwise the value.
+        */
+        template<typename T, typename Arena, std::enable_if_t<utils::is_bounded_v<T>, bool> = true>
+        [[nodiscard]] std::optional<T> to(Arena &arena) noexcept;
+
+        /**
+        * @brief Deserialize a contiguous batch of `count` records of type `T` into `out`.
+        *
+        * The counterpart of `serialize_range`: reads `count * sizeof(T)` bytes with a single
+        * length check instead of one per record. When no record needs byte-swapping on the `Wire`
+        * order, the whole batch is read with one `memcpy`; otherwise each record goes through the
+        * same per-value reader as `to<T>()` (including `bool` normalization). All-or-nothing: if
+        * the buffer is too short, nothing is read, `out` is untouched and the cursor stays put.
+        *
+        * @tparam T The record type; the same requirements as the single-value `to<T>()`. Bounded
+        *           records have no fixed size and are rejected at compile time.
+        * @param out Destination for the records; must have room for `count` of them.
+        * @param count Number of records to read.
+        * @return `true` if all `count` records were read, `false` if the buffer is too short.
+        */
+        template<typename T, std::enable_if_t<
+            std::is_trivially_copyable_v<T> &&
+            !std::is_array_v<T> &&
+            !internal::is_tuple_v<T>, bool> = true>
+        [[nodiscard]] bool to_range(T *out, std::size_t count) noexcept;
+
+        /**
+        * @brief Deserialize a batch of `count` records, splitting a large batch across threads.
+        *
+        * The counterpart of the executor overload of `range_serializer::to`: record `i` is read from
+        * `i * serialized_size_of<T>()`, so parts of consecutive records are decoded independently
+        * and joined by the executor. Below `Threshold` bytes, with an executor of concurrency 1, or
+        * for `bool` records, this is `to_range(out, count)`. Same all-or-nothing contract.
+        *
+        * @tparam T The record type, as for `to_range(out, count)`.
+        * @tparam Threshold The smallest part, in bytes.
+        * @tparam Executor An executor (see executor.hpp): `concurrency()` and `run(parts, job)`.
+        * @param out Destination for the records; must have room for `count` of them.
+        * @param count Number of records to read.
+        * @param executor Runs the parts; `run` must return only once every part has.
+        * @return `true` if all `count` records were read, `false` if the buffer is too short.
+        */
+        template<typename T, std::size_t Threshold = parallel_threshold, typename Executor, std::enable_if_t<
+            std::is_trivially_copyable_v<T> &&
+            !std::is_array_v<T> &&
+            !internal::is_tuple_v<T>, bool> = true>
+        [[nodiscard]] bool to_range(T *out, std::size_t count, Executor &&executor);
+
+        /**
+        * @brief Deserialize a C-array (including nested arrays such as `int[2][3]`).
+        *
+        * A C-array cannot be returned by value, so the value comes back as the `std::array` with
+        * the same wire bytes: `to<int[2][3]>()` yields `std::optional<std::array<std::array<int, 3>, 2>>`.
+        * It is exactly `to<internal::as_std_array_t<T>>()`.
+        *
+        * @tparam T A bounded C-array of trivially-copyable elements.
+        * @return `std::nullopt` if the buffer holds fewer than `sizeof(T)` bytes; otherwise the array.
+        */
+        template<typename T, std::enable_if_t<
+            std::is_array_v<T> &&
+            (std::extent_v<T> > 0) &&
+            std::is_trivially_copyable_v<T>, bool> = true>
+        [[nodiscard]] std::optional<internal::as_std_array_t<T>> to() noexcept;
+
+        /**
+        * @brief Take a zero-copy view of the next value instead of decoding it.
+        *
+        * Checks that `sizeof(T)` bytes remain, advances the cursor past them, and returns a
+        * @ref field_view pointing at them in place. No bytes are copied until an element of the view
+        * is accessed, and then only that element is decoded (and byte-swapped if needed), so a large
+        * array payload can be inspected without materializing it — neither in a `std::optional`
+        * nor in a tuple.
+        *
+        * ```cpp
+        * auto d = deserialize(packet, length);
+        * if (auto samples = d.view<std::array<std::int16_t, 2048>>()) {
+        *     std::int16_t peak = (*samples)[17];   // decodes 2 bytes
+        * }
+        * ```
+        *
+        * @tparam T The type to view: anything `to<T>()` accepts except a tuple or a bounded field;
+        *           a C-array is viewed as the matching `std::array`.
+        * @return `std::nullopt` if the buffer holds fewer than `sizeof(T)` bytes; otherwise the view.
+        *
+        * @warning The view points into the input buffer and must not outlive it.
+        */
+        template<typename T, std::enable_if_t<
+            std::is_trivially_copyable_v<T> &&
+            !internal::is_tuple_v<T>, bool> = true>
+        [[nodiscard]] std::optional<field_view<Wire, internal::as_std_array_t<T>>> view() noexcept;
+
+        /**
+        * @brief Check once that a whole fixed-size message `T...` remains, and claim its bytes for
+        *        an @ref unchecked_deserializer.
+        *
+        * The checked-once policy: the one length check covers every read from the returned reader,
+        * which then returns values directly, with no per-field check and no `std::optional`. The
+        * cursor moves past the claimed bytes.
+        *
+        * ```cpp
+        * if (auto m = d.claim<std::uint32_t, std::uint16_t, float>()) {
+        *     auto id = m->to<std::uint32_t>();
+        *     auto [flags, gain] = m->to<std::tuple<std::uint16_t, float>>();
+        * }
+        * ```
+        *
+        * @tparam T The fields the claimed bytes hold, as for `to<std::tuple<T...>>()`; fixed-size.
+        * @return `std::nullopt` if fewer bytes remain (the cursor stays put); otherwise the reader.
+        */
+        template<typename... T>
+        [[nodiscard]] std::optional<unchecked_deserializer<Wire>> claim() noexcept;
+
+        /**
+        * @brief Check once that `bytes` bytes remain, and claim them for an @ref unchecked_deserializer.
+        *
+        * The runtime form of `claim<T...>()`, for a batch whose size is only known at run time; for
+        * example, `count` records of `serialized_size_of<T>()` bytes each.
+        *
+        * @param bytes The number of bytes to claim.
+        * @return `std::nullopt` if fewer bytes remain (the cursor stays put); otherwise the reader.
+        */
+        [[nodiscard]] std::optional<unchecked_deserializer<Wire>> claim(std::size_t bytes) noexcept;
 
     private:
         const std::byte *_data;       ///< Pointer to the byte stream.
@@ -168,6 +573,21 @@ namespace eser::flat{
         template<typename T>
         T deserialize_impl() noexcept;
 
+        /**
+        * @brief Read one bounded field into `out`, leaving at least `reserve` bytes unread.
+        *
+        * @tparam T A bounded type.
+        * @param out Receives the elements; resized to the wire count, or, for a `utils::arena_vector`,
+        *            pointed at them in `arena`.
+        * @param reserve Bytes the fields after this one need at least, so a prefix cannot claim them.
+        * @param arena Where an `arena_vector`'s elements go; unused for other bounded types.
+        * @return `false` (nothing consumed) if the prefix is missing, exceeds `capacity()`,
+        *         promises more elements than the buffer holds beyond `reserve`, or the arena is
+        *         exhausted.
+        */
+        template<typename T, typename Arena = details::no_arena>
+        bool deserialize_bounded(T &out, std::size_t reserve, Arena *arena = nullptr) noexcept;
+
         /**
         * @brief Tuple back-end for `to<std::tuple<Es...>>()`.
         *
@@ -176,10 +596,38 @@ namespace eser::flat{
         * tuple type without constructing one.
         *
         * @tparam Es The tuple's element types.
+        * @param arena Where `arena_vector` fields go (`details::no_arena` when there is none).
         * @return `std::nullopt` if the buffer is too short; otherwise the engaged tuple.
         */
-        template<typename... Es>
-        std::optional<std::tuple<Es...>> to_impl(internal::type_identity<std::tuple<Es...>>) noexcept;
+        template<typename... Es, typename Arena>
+        std::optional<std::tuple<Es...>> to_impl(internal::type_identity<std::tuple<Es...>>, Arena *arena) noexcept;
+
+        /**
+        * @brief Read element `I` of a tuple `Es...`.
+        *
+        * A field outside a bit group goes through @ref deserialize_impl. The first field of a
+        * group reads the whole group into `group` and advances past it; every member is then
+        * extracted from `group`. A bounded field goes through @ref deserialize_bounded, reserving
+        * the minimum size of the fields after it; a rejected prefix clears `ok`.
+        *
+        * @tparam I The element index.
+        * @tparam Es The tuple's element types.
+        * @param group The packed word of the current bit group.
+        * @param ok Cleared when a bounded field is rejected; later bounded fields are then skipped.
+        * @param arena Passed on to @ref deserialize_bounded.
+        * @return The deserialized element (value-initialized if rejected).
+        */
+        template<std::size_t I, typename... Es, typename Arena>
+        internal::type_at_t<I, Es...> deserialize_field(std::uint64_t &group, bool &ok, Arena *arena) noexcept;
+
+        /**
+        * @brief Read every element of a tuple `Es...` in order; the caller checked the minimum length.
+        * @tparam Es The tuple's element types.
+        * @param arena Passed on to @ref deserialize_field.
+        * @return The tuple, or `std::nullopt` with the cursor restored if a bounded field was rejected.
+        */
+        template<typename... Es, std::size_t... I, typename Arena>
+        std::optional<std::tuple<Es...>> read_fields(std::index_sequence<I...>, Arena *arena) noexcept;
 
         /**
         * @brief Construct a deserializer.
@@ -190,6 +638,274 @@ namespace eser::flat{
         constexpr explicit deserializer(const std::byte *data, std::size_t length);
     };
     
+    /**
+    * @class stream_deserializer
+    * @brief A consuming reader over a source that need not be contiguous (see stream.hpp).
+    *
+    * The counterpart of `serializer::to(Sink&)`: created by `deserialize(source)`, it reads the same
+    * types with the same `std::optional` contract as `deserializer`, from a chunk list, a ring buffer
+    * or any other source. A value that lies inside one region of the source is decoded in place;
+    * only a value that straddles a region boundary is gathered into a small stack temporary.
+    *
+    * Reads advance the underlying source, so the source's own cursor (e.g. `ring_source::position()`)
+    * reflects what was consumed. Zero-copy `view<T>()` is not offered: a value may not be contiguous.
+    * Bounded fields (`utils::bounded_vector`, `utils::bounded_string`) are rejected at compile time:
+    * a source cannot be rewound, so a rejected length prefix could not be un-read.
+    *
+    * `to()` reports each read to the observer, like `deserializer::to()` (see observer.hpp).
+    *
+    * @tparam Wire The byte order of the stream being read.
+    * @tparam Source The source type (`is_source_v<Source>`).
+    *
+    * @warning The same untrusted-input caveats as `deserializer` apply.
+    */
+    template<endianness Wire, typename Source>
+    class stream_deserializer{
+    public:
+        /**
+        * @brief Deserialize a `std::tuple` of values from the source.
+        * @tparam Tuple A `std::tuple<Es...>` of deserializable element types.
+        * @return `std::nullopt` if the source holds fewer than `serialized_size_of<Es...>()` bytes (nothing is
+        *         consumed); otherwise the engaged tuple.
+        * @see deserializer::to()
+        */
+        template<typename Tuple, std::enable_if_t<internal::is_tuple_v<Tuple>, bool> = true>
+        [[nodiscard]] std::optional<Tuple> to() noexcept;
+
+        /**
+        * @brief Deserialize a single trivially-copyable, non-array, non-tuple value.
+        * @tparam T The type to deserialize.
+        * @return `std::nullopt` if the source holds fewer than `sizeof(T)` bytes; otherwise the value.
+        * @see deserializer::to()
+        */
+        template<typename T, std::enable_if_t<
+            std::is_trivially_copyable_v<T> &&
+            !std::is_array_v<T> &&
+            !internal::is_tuple_v<T>, bool> = true>
+        [[nodiscard]] std::optional<T> to() noexcept;
+
+        /**
+        * @brief Deserialize a C-array, returned as the matching `std::array`.
+        * @tparam T A bounded C-array of trivially-copyable elements.
+        * @return `std::nullopt` if the source holds fewer than `sizeof(T)` bytes; otherwise the array.
+        * @see deserializer::to()
+        */
+        template<typename T, std::enable_if_t<
+            std::is_array_v<T> &&
+            (std::extent_v<T> > 0) &&
+            std::is_trivially_copyable_v<T>, bool> = true>
+        [[nodiscard]] std::optional<internal::as_std_array_t<T>> to() noexcept;
+
+        /**
+        * @brief Deserialize a contiguous batch of `count` records of type `T` into `out`.
+        *
+        * One length check for the batch. If the batch lies in the source's current region it is read
+        * with the same kernels as `deserializer::to_range`; otherwise record by record.
+        * All-or-nothing: if the source is too short, nothing is consumed.
+        *
+        * @tparam T The record type.
+        * @param out Destination for the records; must have room for `count` of them.
+        * @param count Number of records to read.
+        * @return `true` if all `count` records were read, `false` if the source is too short.
+        */
+        template<typename T, std::enable_if_t<
+            std::is_trivially_copyable_v<T> &&
+            !std::is_array_v<T> &&
+            !internal::is_tuple_v<T>, bool> = true>
+        [[nodiscard]] bool to_range(T *out, std::size_t count) noexcept;
+
+        /**
+        * @brief The number of bytes left in the source.
+        * @return `source.available()`.
+        */
+        [[nodiscard]] std::size_t available() const noexcept;
+
+    private:
+        Source *_source; ///< The underlying source (not owned).
+
+        /**
+        * @brief Friend function to create a `stream_deserializer` instance.
+        */
+        template<endianness W, typename S, std::enable_if_t<is_source_v<S>, bool>>
+        friend constexpr stream_deserializer<W, S> deserialize(S &source) noexcept;
+
+        /**
+        * @brief Read one value off the source; the caller guarantees the bytes exist.
+        * @tparam T The trivially-copyable type to read.
+        * @return The deserialized value.
+        */
+        template<typename T>
+        T deserialize_impl() noexcept;
+
+        /**
+        * @brief Tuple back-end for `to<std::tuple<Es...>>()`.
+        * @tparam Es The tuple's element types.
+        * @return `std::nullopt` if the source is too short; otherwise the engaged tuple.
+        */
+        template<typename... Es>
+        std::optional<std::tuple<Es...>> to_impl(internal::type_identity<std::tuple<Es...>>) noexcept;
+
+        /**
+        * @brief Read element `I` of a tuple `Es...`; a bit group is read from the source once, at
+        *        its first field (see `deserializer::deserialize_field`).
+        * @tparam I The element index.
+        * @tparam Es The tuple's element types.
+        * @param group The packed word of the current bit group.
+        * @return The deserialized element.
+        */
+        template<std::size_t I, typename... Es>
+        internal::type_at_t<I, Es...> deserialize_field(std::uint64_t &group) noexcept;
+
+        /**
+        * @brief Read every element of a tuple `Es...` in order; the caller checked the length.
+        * @tparam Es The tuple's element types.
+        * @return The tuple.
+        */
+        template<typename... Es, std::size_t... I>
+        std::tuple<Es...> read_fields(std::index_sequence<I...>) noexcept;
+
+        /**
+        * @brief Construct a stream deserializer.
+        * @param source The source to read from.
+        */
+        constexpr explicit stream_deserializer(Source &source) noexcept;
+    };
+
+    /**
+    * @class unchecked_deserializer
+    * @brief A reader that trusts its length: values come back directly, with no per-read check.
+    *
+    * `deserializer` checks the remaining length on every `to()` and wraps the result in a
+    * `std::optional`. When the length was validated once for the whole message, the per-read
+    * checks are redundant. This reader drops them: each read is a load and a pointer bump. In a
+    * loop the compiler can then hoist and combine the loads.
+    *
+    * It is created by one of two policies:
+    *
+    * - **checked once**: `deserializer::claim<T...>()` or `claim(bytes)` checks the length once
+    *   and hands the claimed bytes to this reader;
+    * - **unchecked**: `deserialize<Wire>(unchecked, data, length)` trusts the caller, typically
+    *   after the envelope (a frame, a record file) validated the length.
+    *
+    * Reading past the end is a caller bug: it is caught by an `assert` in debug builds and is
+    * undefined behavior otherwise. Bounded fields are rejected at compile time, because their
+    * length prefix comes from the wire and must be validated. `bool` values are still normalized.
+    * Reads are not reported to the observer (see observer.hpp).
+    *
+    * @tparam Wire The byte order of the stream being read.
+    *
+    * @warning The same untrusted-input caveats as `deserializer` apply, and more strictly: only
+    *          length-validated bytes may be read.
+    */
+    template<endianness Wire>
+    class unchecked_deserializer{
+    public:
+        /**
+        * @brief Deserialize a `std::tuple` of values.
+        * @tparam Tuple A `std::tuple<Es...>` of fixed-size element types (bit fields included).
+        * @return The tuple.
+        * @see deserializer::to()
+        */
+        template<typename Tuple, std::enable_if_t<internal::is_tuple_v<Tuple>, bool> = true>
+        [[nodiscard]] Tuple to() noexcept;
+
+        /**
+        * @brief Deserialize a single trivially-copyable, non-array, non-tuple value.
+        * @tparam T The type to deserialize.
+        * @return The value.
+        * @see deserializer::to()
+        */
+        template<typename T, std::enable_if_t<
+            std::is_trivially_copyable_v<T> &&
+            !std::is_array_v<T> &&
+            !internal::is_tuple_v<T>, bool> = true>
+        [[nodiscard]] T to() noexcept;
+
+        /**
+        * @brief Deserialize a C-array, returned as the matching `std::array`.
+        * @tparam T A bounded C-array of trivially-copyable elements.
+        * @return The array.
+        * @see deserializer::to()
+        */
+        template<typename T, std::enable_if_t<
+            std::is_array_v<T> &&
+            (std::extent_v<T> > 0) &&
+            std::is_trivially_copyable_v<T>, bool> = true>
+        [[nodiscard]] internal::as_std_array_t<T> to() noexcept;
+
+        /**
+        * @brief Deserialize a contiguous batch of `count` records of type `T` into `out`, with the
+        *        same kernels as `deserializer::to_range`.
+        * @tparam T The record type.
+        * @param out Destination for the records; must have room for `count` of them.
+        * @param count Number of records to read.
+        */
+        template<typename T, std::enable_if_t<
+            std::is_trivially_copyable_v<T> &&
+            !std::is_array_v<T> &&
+            !internal::is_tuple_v<T>, bool> = true>
+        void to_range(T *out, std::size_t count) noexcept;
+
+    private:
+        const std::byte *_data; ///< The next byte to read.
+        const std::byte *_end;  ///< One past the last readable byte; only checked by `assert`.
+
+        friend class deserializer<Wire>;
+
+        /**
+        * @brief Friend function to create an `unchecked_deserializer` instance.
+        */
+        template<endianness W>
+        friend constexpr unchecked_deserializer<W> deserialize(unchecked_t, const std::byte *data, std::size_t length) noexcept;
+
+        /**
+        * @brief Read one value and advance; the caller guarantees the bytes exist.
+        * @tparam T The trivially-copyable, fixed-size type to read.
+        * @return The deserialized value.
+        */
+        template<typename T>
+        T deserialize_impl() noexcept;
+
+        /**
+        * @brief Read element `I` of a tuple `Es...`; a bit group is loaded once, at its first field
+        *        (see `deserializer::deserialize_field`).
+        * @tparam I The element index.
+        * @tparam Es The tuple's element types.
+        * @param group The packed word of the current bit group.
+        * @return The deserialized element.
+        */
+        template<std::size_t I, typename... Es>
+        internal::type_at_t<I, Es...> deserialize_field(std::uint64_t &group) noexcept;
+
+        /**
+        * @brief Read every element of a tuple `Es...` in order.
+        * @tparam Es The tuple's element types.
+        * @return The tuple.
+        */
+        template<typename... Es, std::size_t... I>
+        std::tuple<Es...> read_fields(std::index_sequence<I...>) noexcept;
+
+        /**
+        * @brief Tuple back-end for `to<std::tuple<Es...>>()`.
+        * @tparam Es The tuple's element types.
+        * @return The tuple.
+        */
+        template<typename... Es>
+        std::tuple<Es...> to_impl(internal::type_identity<std::tuple<Es...>>) noexcept;
+
+        /**
+        * @brief Assert, in debug builds, that `bytes` more bytes are readable.
+        */
+        constexpr void expect(std::size_t bytes) const noexcept;
+
+        /**
+        * @brief Construct an unchecked deserializer.
+        * @param data The first byte to read.
+        * @param length The bytes the caller vouches for.
+        */
+        constexpr explicit unchecked_deserializer(const std::byte *data, std::size_t length) noexcept;
+    };
+
     /**
     * @brief Create a deserializer instance from a byte array.
     *
@@ -275,6 +991,55 @@ namespace eser::flat{
     {
         return deserialize<Wire>(data, N);
     }
+
+    /**
+    * @brief Create a reader over a non-contiguous source (chunk list, ring buffer, ...).
+    *
+    * ```cpp
+    * ring_source rx(dma_storage, sizeof(dma_storage), rx_tail, rx_used);
+    * auto d = deserialize<endianness::big>(rx);
+    * auto header = d.to<std::tuple<std::uint8_t, std::uint32_t>>();
+    * rx_tail = rx.position();   // publish the new read index
+    * ```
+    *
+    * @tparam Wire The byte order of the stream (default `endianness::little`).
+    * @tparam Source The source type (`is_source_v<Source>`, see stream.hpp).
+    * @param source The source to read from; it must outlive the returned reader.
+    * @return A `stream_deserializer` over `source`.
+    */
+    template<endianness Wire = endianness::little, typename Source, std::enable_if_t<is_source_v<Source>, bool> = true>
+    constexpr stream_deserializer<Wire, Source> deserialize(Source &source) noexcept;
+
+    /**
+    * @brief Create a reader that skips every length check (the unchecked decode policy).
+    *
+    * For bytes whose length was already validated, e.g. the payload of a frame whose checksum
+    * and length matched. Every read returns its value directly; see @ref unchecked_deserializer.
+    *
+    * ```cpp
+    * auto d = deserialize<endianness::big>(unchecked, payload, payload_length);
+    * const auto id   = d.to<std::uint32_t>();
+    * const auto gain = d.to<float>();
+    * ```
+    *
+    * @tparam Wire The byte order of the stream (default `endianness::little`).
+    * @param data Pointer to the byte stream; must be non-null (checked by `assert`).
+    * @param length The number of readable bytes; reads past it are only caught by `assert`.
+    * @return An `unchecked_deserializer` over the bytes.
+    * @warning `length` must have been validated against the bytes actually held.
+    */
+    template<endianness Wire = endianness::little>
+    constexpr unchecked_deserializer<Wire> deserialize(unchecked_t, const std::byte *data, std::size_t length) noexcept;
+
+    /**
+    * @brief Create an unchecked reader over a byte array.
+    * @see deserialize(unchecked_t, const std::byte*, std::size_t)
+    */
+    template<endianness Wire = endianness::little, std::size_t N>
+    constexpr unchecked_deserializer<Wire> deserialize(unchecked_t tag, const std::byte (&data)[N]) noexcept
+    {
+        return deserialize<Wire>(tag, data, N);
+    }
 } // namespace eser::flat
 
 #include "deserializer.tpp"
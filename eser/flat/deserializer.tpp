@@ -25,79 +25,772 @@
 *       `to()` became single-parameter; multi-field reads name a `std::tuple`. The
 *       per-array `deserialize_impl` was removed — `std::array` is trivially copyable and
 *       goes through the single memcpy reader like any other leaf value.
+* - 2026-10-14
+*       Added `to_range`: one length check per batch, one `memcpy` on a native wire.
+* - 2026-10-14
+*       `std::array` values and `to_range` batches are read through `details::deserialize_elements`:
+*       one `memcpy` on a native wire, or a fused swap-while-copying kernel, instead of a copy
+*       followed by an in-place swap.
+* - 2026-10-14
+*       Added the C-array `to<T[N]>()` overload, `view<T>()` and `field_view`; per-value decoding
+*       moved into `details::deserialize_value`.
+* - 2026-10-14
+*       Added `stream_deserializer` and `details::deserialize_value_from`.
+* - 2026-10-14
+*       Tuple reads go through the indexed `deserialize_field`, which unpacks bit groups.
+* - 2026-10-14
+*       Added `deserialize_bounded` and the bounded `to<T>()`; `read_fields` restores the cursor
+*       when a bounded field is rejected.
+* - 2026-10-14
+*       Wire sizes come from `serialized_size_of` instead of `sizeof`, so structs described with
+*       `ESER_REFLECT_PACKED` are read member by member (`deserialize_members`).
+* - 2026-10-14
+*       Added the parallel `to_range(out, count, executor)`.
+* - 2026-10-14
+*       `to()` reports every message to the active observer (see observer.hpp).
+* - 2026-10-14
+*       Added `deserializer::claim` and `unchecked_deserializer`.
+* - 2026-10-14
+*       Added `to<T>(arena)`; `deserialize_bounded` places `utils::arena_vector` elements in the arena.
+* - 2026-10-14
+*       `stream_deserializer::to()` reports to the observer, like `serializer::to(Sink&)`.
 */
 #ifndef ESER_FLAT_DESERIALIZER_TPP_
 #define ESER_FLAT_DESERIALIZER_TPP_
 #include "deserializer.hpp"
 #include "../internal/endianness.hpp"
+#include "../internal/byteswap.hpp"
+#include <algorithm>
 #include <cassert>
 #include <utility>
 #include <array>
 #include <cstring>
 #include <limits>
 namespace eser::flat{
+    namespace details{
+        /**
+        * @brief Read a contiguous run of `count` elements, choosing the copy kernel at compile time.
+        *
+        * The read-side counterpart of `serialize_elements`: one `memcpy` when no element needs
+        * converting from the `Wire` order, a fused swap-while-copying pass
+        * (@ref internal::byteswap_copy) for multi-byte scalars on a non-native wire, and
+        * element by element (recursing into nested `std::array`s) otherwise.
+        *
+        * @tparam Wire The byte order of the stream.
+        * @tparam E The element type.
+        * @param out Destination of the elements.
+        * @param data The first wire byte of the run; the caller guarantees `count * sizeof(E)` bytes.
+        * @param count The number of elements.
+        *
+        * @note Elements are copied wholesale: a `bool` element is not normalized (see the class docs).
+        */
+        template<endianness Wire, typename E>
+        inline void deserialize_elements(E *out, const std::byte *data, std::size_t count) noexcept
+        {
+            using leaf = internal::array_leaf_t<E>;
+            if constexpr (std::is_floating_point_v<leaf>)
+                static_assert(std::numeric_limits<leaf>::is_iec559,
+                    "[eser] floating-point deserialization requires an IEEE-754 (iec559) representation");
+            constexpr std::size_t stride = serialized_size_of<E>();
+            if constexpr (not internal::needs_byte_swap_v<Wire, E>) {
+                if (count != 0) std::memcpy(static_cast<void*>(out), data, count * sizeof(E));
+            } else if constexpr (internal::is_swapped_scalar_v<Wire, E>) {
+                internal::byteswap_copy<sizeof(E)>(out, data, count);
+            } else if constexpr (internal::is_std_array_v<E>) {
+                for (std::size_t i = 0; i < count; ++i)
+                    deserialize_elements<Wire>(out[i].data(), data + i * stride, out[i].size());
+            } else if constexpr (utils::is_packed_v<E>) {
+                for (std::size_t i = 0; i < count; ++i) out[i] = deserialize_value<Wire, E>(data + i * stride);
+            } else {
+                for (std::size_t i = 0; i < count; ++i) {
+                    std::memcpy(static_cast<void*>(out + i), data + i * stride, sizeof(E));
+                    internal::apply_wire_endianness<Wire>(out[i]);
+                }
+            }
+        }
+
+        template<endianness Wire, typename T>
+        inline void deserialize_members(T &out, const std::byte *data) noexcept
+        {
+            utils::reflection_t<T>::for_each([&out, &data](auto m){
+                using value_type = typename decltype(m)::value_type;
+                auto &member = decltype(m)::get(out);
+                if constexpr (std::is_array_v<value_type>)
+                    deserialize_elements<Wire>(&member[0], data, std::extent_v<value_type>);
+                else
+                    member = deserialize_value<Wire, value_type>(data);
+                data += serialized_size_of<value_type>();
+            });
+        }
+
+        template<endianness Wire, typename T>
+        inline T deserialize_value(const std::byte *data) noexcept
+        {
+            static_assert(std::is_trivially_copyable_v<T>, "deserialize_value requires a trivially-copyable type");
+            if constexpr (std::is_floating_point_v<T>)
+                static_assert(std::numeric_limits<T>::is_iec559,
+                    "[eser] floating-point deserialization requires an IEEE-754 (iec559) representation");
+            T value {};
+            if constexpr (std::is_same_v<T, bool>) {
+                // Read through an unsigned char and normalize: a wire byte other than 0/1 must not be
+                // materialized as a bool object, because a bool with a non-0/1 representation is a trap
+                // value and reading it is undefined behavior. Any non-zero byte deserializes to `true`.
+                // (This covers standalone `to<bool>()` and `bool` tuple elements; a `bool` nested inside
+                // a struct or std::array is copied wholesale and is NOT normalized — see the class docs.)
+                unsigned char raw = 0;
+                std::memcpy(&raw, data, sizeof(raw));
+                value = (raw != 0);
+            } else if constexpr (internal::is_std_array_v<T>) {
+                // whole-array memcpy, or swap the elements while copying them off the wire
+                deserialize_elements<Wire>(value.data(), data, value.size());
+            } else if constexpr (utils::is_packed_v<T> and internal::needs_byte_swap_v<Wire, T>) {
+                deserialize_members<Wire>(value, data);
+            } else {
+                std::memcpy(&value, data, sizeof(T));
+                internal::apply_wire_endianness<Wire>(value); // convert from wire order to host order
+            }
+            return value;
+        }
+
+        template<endianness Wire, typename Source, typename T>
+        inline void deserialize_value_from(Source &source, T &out) noexcept
+        {
+            constexpr std::size_t bytes = serialized_size_of<T>();
+            if (const std::byte *in = source.contiguous(bytes)) {
+                out = deserialize_value<Wire, T>(in);
+                source.advance(bytes);
+            } else if constexpr (not internal::needs_byte_swap_v<Wire, T> and not std::is_same_v<T, bool>) {
+                // no conversion needed: gather the bytes straight into the object
+                source.read(static_cast<std::byte *>(static_cast<void *>(&out)), sizeof(T));
+            } else if constexpr (internal::is_std_array_v<T>) {
+                for (auto &element : out) deserialize_value_from<Wire>(source, element);
+            } else {
+                std::byte scratch[bytes];
+                source.read(scratch, bytes);
+                out = deserialize_value<Wire, T>(scratch);
+            }
+        }
+
+        template<std::size_t I, typename... Es>
+        constexpr std::size_t min_wire_size() noexcept
+        {
+            constexpr std::array<std::size_t, sizeof...(Es)> payload = { payload_capacity<Es>()... };
+            std::size_t bytes = 0;
+            for (std::size_t k = I; k < sizeof...(Es); ++k) bytes += bit_groups<Es...>::wire_size(k) - payload[k];
+            return bytes;
+        }
+
+        template<typename... Es>
+        constexpr std::size_t tuple_wire_size() noexcept
+        {
+            if constexpr ((... or utils::is_bits_v<Es>) or not is_fixed_size_v<Es...>) return min_wire_size<0, Es...>();
+            else return (serialized_size_of<Es>() + ...);
+        }
+
+        template<endianness Wire, std::size_t Bytes>
+        inline std::uint64_t load_bit_group(const std::byte *data) noexcept
+        {
+            static_assert(Bytes > 0 and Bytes <= 8, "a bit group spans 1 to 8 bytes");
+            std::uint64_t word = 0;
+            for (std::size_t b = 0; b < Bytes; ++b) {
+                const std::size_t shift = Wire == endianness::little ? 8 * b : 8 * (Bytes - 1 - b);
+                word |= std::uint64_t{std::to_integer<std::uint8_t>(data[b])} << shift;
+            }
+            return word;
+        }
+
+        template<endianness Wire, std::size_t I, typename... Es>
+        inline internal::type_at_t<I, Es...> extract_bit_field(std::uint64_t group) noexcept
+        {
+            using groups = bit_groups<Es...>;
+            using field = internal::type_at_t<I, Es...>;
+            constexpr std::size_t span = groups::group_size(I) * 8;
+            constexpr std::size_t shift = Wire == endianness::little
+                ? groups::bit_offset(I)
+                : span - groups::bit_offset(I) - field::width;
+            return field::from_raw(static_cast<typename field::storage_type>(group >> shift));
+        }
+    } // namespace details
+
     template<endianness Wire>
     template<typename Tuple, std::enable_if_t<internal::is_tuple_v<Tuple>, bool>>
     inline std::optional<Tuple> deserializer<Wire>::to() noexcept
     {
-        return to_impl(internal::type_identity<Tuple>{});
+        const auto start = active_observer::start();
+        const std::size_t length = _length;
+        std::optional<Tuple> value = to_impl(internal::type_identity<Tuple>{}, static_cast<details::no_arena *>(nullptr));
+        details::report_decoded<Tuple>(start, length - _length);
+        return value;
+    }
+
+    template<endianness Wire>
+    template<typename Tuple, typename Arena, std::enable_if_t<internal::is_tuple_v<Tuple>, bool>>
+    inline std::optional<Tuple> deserializer<Wire>::to(Arena &arena) noexcept
+    {
+        const auto start = active_observer::start();
+        const std::size_t length = _length;
+        std::optional<Tuple> value = to_impl(internal::type_identity<Tuple>{}, &arena);
+        details::report_decoded<Tuple>(start, length - _length);
+        return value;
     }
 
     template<endianness Wire>
     template<typename T, std::enable_if_t<
         std::is_trivially_copyable_v<T> &&
         !std::is_array_v<T> &&
-        !internal::is_tuple_v<T>, bool>
+        !internal::is_tuple_v<T> &&
+        !utils::is_bounded_v<T>, bool>
     >
     inline std::optional<T> deserializer<Wire>::to() noexcept
     {
-        if (_length < sizeof(T)) return std::nullopt;
-        return deserialize_impl<T>();
+        const auto start = active_observer::start();
+        if (_length < serialized_size_of<T>()){
+            details::report_decoded<T>(start, 0);
+            return std::nullopt;
+        }
+        const T value = deserialize_impl<T>();
+        details::report_decoded<T>(start, serialized_size_of<T>());
+        return value;
     }
 
     template<endianness Wire>
-    template<typename... Es>
-    inline std::optional<std::tuple<Es...>> deserializer<Wire>::to_impl(internal::type_identity<std::tuple<Es...>>) noexcept
+    template<typename T, std::enable_if_t<utils::is_bounded_v<T>, bool>>
+    inline std::optional<T> deserializer<Wire>::to() noexcept
+    {
+        const auto start = active_observer::start();
+        const std::size_t length = _length;
+        T value {};
+        const bool read = deserialize_bounded(value, 0);
+        details::report_decoded<T>(start, length - _length);
+        if (not read) return std::nullopt;
+        return value;
+    }
+
+    template<endianness Wire>
+    template<typename T, typename Arena, std::enable_if_t<utils::is_bounded_v<T>, bool>>
+    inline std::optional<T> deserializer<Wire>::to(Arena &arena) noexcept
+    {
+        const auto start = active_observer::start();
+        const std::size_t length = _length;
+        T value {};
+        const bool read = deserialize_bounded(value, 0, &arena);
+        details::report_decoded<T>(start, length - _length);
+        if (not read) return std::nullopt;
+        return value;
+    }
+
+    template<endianness Wire>
+    template<typename T, std::enable_if_t<
+        std::is_trivially_copyable_v<T> &&
+        !std::is_array_v<T> &&
+        !internal::is_tuple_v<T>, bool>
+    >
+    inline bool deserializer<Wire>::to_range(T *out, std::size_t count) noexcept
+    {
+        static_assert(not utils::is_bounded_v<T>, "[eser] to_range needs fixed-size records; read bounded fields one by one");
+        constexpr std::size_t record_size = serialized_size_of<T>();
+        // Compare by division so `count * record_size` cannot overflow on a hostile count.
+        if (count > _length / record_size) return false;
+        if constexpr (std::is_same_v<T, bool>) {
+            // each byte must be normalized, not copied (see deserialize_impl)
+            for (std::size_t i = 0; i < count; ++i) out[i] = deserialize_impl<T>();
+        } else {
+            const std::size_t total_bytes = count * record_size;
+            details::deserialize_elements<Wire>(out, _data, count);
+            _data += total_bytes;
+            _length -= total_bytes;
+        }
+        return true;
+    }
+
+    template<endianness Wire>
+    template<typename T, std::size_t Threshold, typename Executor, std::enable_if_t<
+        std::is_trivially_copyable_v<T> &&
+        !std::is_array_v<T> &&
+        !internal::is_tuple_v<T>, bool>
+    >
+    inline bool deserializer<Wire>::to_range(T *out, std::size_t count, Executor &&executor)
+    {
+        static_assert(not utils::is_bounded_v<T>, "[eser] to_range needs fixed-size records; read bounded fields one by one");
+        constexpr std::size_t record_size = serialized_size_of<T>();
+        if constexpr (std::is_same_v<T, bool>) {
+            return to_range(out, count);
+        } else {
+            if (count > _length / record_size) return false;
+            const std::size_t parts = details::batch_parts(count, record_size, executor.concurrency(), Threshold);
+            if (parts <= 1) return to_range(out, count);
+
+            // each part owns a disjoint run of records and of input bytes
+            const std::size_t per_part = (count + parts - 1) / parts;
+            executor.run(parts, [out, data = _data, count, per_part](std::size_t part){
+                const std::size_t first = part * per_part;
+                if (first >= count) return;
+                const std::size_t n = std::min(per_part, count - first);
+                details::deserialize_elements<Wire>(out + first, data + first * record_size, n);
+            });
+            const std::size_t total_bytes = count * record_size;
+            _data += total_bytes;
+            _length -= total_bytes;
+            return true;
+        }
+    }
+
+    template<endianness Wire>
+    template<typename T, std::enable_if_t<
+        std::is_array_v<T> &&
+        (std::extent_v<T> > 0) &&
+        std::is_trivially_copyable_v<T>, bool>
+    >
+    inline std::optional<internal::as_std_array_t<T>> deserializer<Wire>::to() noexcept
+    {
+        using array = internal::as_std_array_t<T>;
+        static_assert(sizeof(array) == sizeof(T), "[eser] std::array and C-array layouts differ on this toolchain");
+        return to<array>();
+    }
+
+    template<endianness Wire>
+    template<typename T, std::enable_if_t<
+        std::is_trivially_copyable_v<T> &&
+        !internal::is_tuple_v<T>, bool>
+    >
+    inline std::optional<field_view<Wire, internal::as_std_array_t<T>>> deserializer<Wire>::view() noexcept
+    {
+        static_assert(not utils::is_bounded_v<T>, "[eser] a bounded field has no fixed wire size to view; read it with to<T>()");
+        using viewed = internal::as_std_array_t<T>;
+        constexpr std::size_t bytes = serialized_size_of<viewed>();
+        if (_length < bytes) return std::nullopt;
+        field_view<Wire, viewed> result(_data);
+        _data += bytes;
+        _length -= bytes;
+        return result;
+    }
+
+    template<endianness Wire>
+    template<typename... T>
+    inline std::optional<unchecked_deserializer<Wire>> deserializer<Wire>::claim() noexcept
+    {
+        static_assert(sizeof...(T) > 0, "[eser] claim needs at least one field");
+        static_assert(details::is_fixed_size_v<T...>, "[eser] claim needs fixed-size fields; read bounded fields with to<T>()");
+        return claim(details::tuple_wire_size<T...>());
+    }
+
+    template<endianness Wire>
+    inline std::optional<unchecked_deserializer<Wire>> deserializer<Wire>::claim(std::size_t bytes) noexcept
+    {
+        if (_length < bytes) return std::nullopt;
+        unchecked_deserializer<Wire> claimed(_data, bytes);
+        _data += bytes;
+        _length -= bytes;
+        return claimed;
+    }
+
+    template<endianness Wire>
+    template<typename... Es, typename Arena>
+    inline std::optional<std::tuple<Es...>> deserializer<Wire>::to_impl(internal::type_identity<std::tuple<Es...>>, Arena *arena) noexcept
     {
         static_assert(sizeof...(Es) > 0, "Cannot deserialize an empty std::tuple<>; name at least one field");
-        constexpr std::size_t bytes_required = (sizeof(Es) + ...);
+        constexpr std::size_t bytes_required = details::tuple_wire_size<Es...>();
         if (_length < bytes_required) return std::nullopt;
-        // Braced init guarantees left-to-right evaluation, so each deserialize_impl
+        return read_fields<Es...>(std::index_sequence_for<Es...>{}, arena);
+    }
+
+    template<endianness Wire>
+    template<typename... Es, std::size_t... I, typename Arena>
+    inline std::optional<std::tuple<Es...>> deserializer<Wire>::read_fields(std::index_sequence<I...>, Arena *arena) noexcept
+    {
+        const std::byte *data = _data;
+        const std::size_t length = _length;
+        std::uint64_t group = 0;
+        bool ok = true;
+        // Braced init guarantees left-to-right evaluation, so each deserialize_field
         // advances the cursor in field order; a parenthesised tuple ctor would not.
-        return std::tuple<Es...>{ deserialize_impl<Es>()... };
+        std::tuple<Es...> fields{ deserialize_field<I, Es...>(group, ok, arena)... };
+        if constexpr (not details::is_fixed_size_v<Es...>) {
+            if (not ok) {
+                _data = data;
+                _length = length;
+                return std::nullopt;
+            }
+        }
+        return fields;
+    }
+
+    template<endianness Wire>
+    template<std::size_t I, typename... Es, typename Arena>
+    inline internal::type_at_t<I, Es...> deserializer<Wire>::deserialize_field(std::uint64_t &group, bool &ok, Arena *arena) noexcept
+    {
+        using groups = details::bit_groups<Es...>;
+        using field = internal::type_at_t<I, Es...>;
+        if constexpr (utils::is_bounded_v<field>) {
+            // The upfront check covered only the minimum size; every later field keeps its share.
+            field value {};
+            if (ok) ok = deserialize_bounded(value, details::min_wire_size<I + 1, Es...>(), arena);
+            return value;
+        } else if constexpr (not groups::packed(I)) {
+            return deserialize_impl<internal::type_at_t<I, Es...>>();
+        } else {
+            if constexpr (groups::first(I) == I) {
+                constexpr std::size_t bytes = groups::group_size(I);
+                group = details::load_bit_group<Wire, bytes>(_data);
+                _data += bytes;
+                _length -= bytes;
+            }
+            return details::extract_bit_field<Wire, I, Es...>(group);
+        }
     }
 
     template<endianness Wire>
     template<typename T>
     inline T deserializer<Wire>::deserialize_impl() noexcept
     {
-        static_assert(std::is_trivially_copyable_v<T>, "deserialize_impl requires a trivially-copyable type");
-        if constexpr (std::is_floating_point_v<T>)
-            static_assert(std::numeric_limits<T>::is_iec559,
-                "[eser] floating-point deserialization requires an IEEE-754 (iec559) representation");
+        T value = details::deserialize_value<Wire, T>(_data);
+        _data += serialized_size_of<T>();
+        _length -= serialized_size_of<T>();
+        return value;
+    }
+
+    template<endianness Wire>
+    template<typename T, typename Arena>
+    inline bool deserializer<Wire>::deserialize_bounded(T &out, std::size_t reserve, Arena *arena) noexcept
+    {
+        using length_type = typename T::length_type;
+        using element = typename T::value_type;
+        static_assert(serialized_size_of<element>() == sizeof(element),
+            "[eser] bounded_vector elements must keep their in-memory size on the wire (no packed structs)");
+        constexpr std::size_t prefix = sizeof(length_type);
+        if (_length < prefix + reserve) return false;
+        const std::size_t count = details::deserialize_value<Wire, length_type>(_data);
+        // Compare by division so a hostile count cannot overflow `count * sizeof(element)`.
+        if (count > T::capacity() or count > (_length - prefix - reserve) / sizeof(element)) return false;
+        element *elements;
+        if constexpr (utils::is_arena_vector_v<T>) {
+            static_assert(not std::is_same_v<Arena, details::no_arena>,
+                "[eser] an arena_vector is decoded into an arena: call to<T>(arena)");
+            elements = nullptr;
+            if (count != 0) {
+                elements = static_cast<element *>(arena->allocate(count * sizeof(element), alignof(element)));
+                if (elements == nullptr) return false;
+            }
+            out = T(elements, count);
+        } else {
+            static_cast<void>(arena);
+            out.resize(count);
+            elements = out.data();
+        }
+        if constexpr (std::is_same_v<element, bool>) {
+            for (std::size_t i = 0; i < count; ++i)
+                elements[i] = details::deserialize_value<Wire, bool>(_data + prefix + i);
+        } else if (count != 0) {
+            details::deserialize_elements<Wire>(elements, _data + prefix, count);
+        }
+        const std::size_t consumed = prefix + count * sizeof(element);
+        _data += consumed;
+        _length -= consumed;
+        return true;
+    }
+
+    template<endianness Wire, typename T>
+    inline T field_view<Wire, T>::get() const noexcept
+    {
+        return details::deserialize_value<Wire, T>(_data);
+    }
+
+    template<endianness Wire, typename T>
+    constexpr const std::byte* field_view<Wire, T>::data() const noexcept
+    {
+        return _data;
+    }
+
+    template<endianness Wire, typename T>
+    constexpr std::size_t field_view<Wire, T>::size_bytes() noexcept
+    {
+        return serialized_size_of<T>();
+    }
+
+    template<endianness Wire, typename T>
+    template<typename U, std::enable_if_t<internal::is_std_array_v<U>, bool>>
+    constexpr std::size_t field_view<Wire, T>::size() noexcept
+    {
+        return std::tuple_size_v<T>;
+    }
+
+    template<endianness Wire, typename T>
+    template<typename U, std::enable_if_t<internal::is_std_array_v<U>, bool>>
+    inline auto field_view<Wire, T>::operator[](std::size_t index) const noexcept
+    {
+        using element = typename T::value_type;
+        assert(index < std::tuple_size_v<T> && "field_view index out of range");
+        const std::byte *element_data = _data + index * serialized_size_of<element>();
+        if constexpr (internal::is_std_array_v<element>)
+            return field_view<Wire, element>(element_data);
+        else
+            return details::deserialize_value<Wire, element>(element_data);
+    }
+
+    template<endianness Wire, typename T>
+    template<typename U, std::enable_if_t<internal::is_std_array_v<U>, bool>>
+    inline auto field_view<Wire, T>::at(std::size_t index) const noexcept
+    {
+        using result = decltype((*this)[index]);
+        if (index >= std::tuple_size_v<T>) return std::optional<result>{};
+        return std::optional<result>((*this)[index]);
+    }
+
+    template<endianness Wire, typename T>
+    constexpr field_view<Wire, T>::field_view(const std::byte *data) noexcept
+    : _data(data)
+    {
+    }
+
+    template<endianness Wire>
+    constexpr deserializer<Wire>::deserializer(const std::byte *data, std::size_t length)
+    : _data(data), _length(length)
+    {
+    }
+
+    template<endianness Wire, typename Source>
+    template<typename Tuple, std::enable_if_t<internal::is_tuple_v<Tuple>, bool>>
+    inline std::optional<Tuple> stream_deserializer<Wire, Source>::to() noexcept
+    {
+        const auto start = active_observer::start();
+        const std::size_t available = _source->available();
+        std::optional<Tuple> value = to_impl(internal::type_identity<Tuple>{});
+        details::report_decoded<Tuple>(start, available - _source->available());
+        return value;
+    }
+
+    template<endianness Wire, typename Source>
+    template<typename T, std::enable_if_t<
+        std::is_trivially_copyable_v<T> &&
+        !std::is_array_v<T> &&
+        !internal::is_tuple_v<T>, bool>
+    >
+    inline std::optional<T> stream_deserializer<Wire, Source>::to() noexcept
+    {
+        static_assert(not utils::is_bounded_v<T>, "[eser] bounded fields cannot be read from a stream source; copy the message into a buffer first");
+        const auto start = active_observer::start();
+        if (_source->available() < serialized_size_of<T>()){
+            details::report_decoded<T>(start, 0);
+            return std::nullopt;
+        }
+        const T value = deserialize_impl<T>();
+        details::report_decoded<T>(start, serialized_size_of<T>());
+        return value;
+    }
+
+    template<endianness Wire, typename Source>
+    template<typename T, std::enable_if_t<
+        std::is_array_v<T> &&
+        (std::extent_v<T> > 0) &&
+        std::is_trivially_copyable_v<T>, bool>
+    >
+    inline std::optional<internal::as_std_array_t<T>> stream_deserializer<Wire, Source>::to() noexcept
+    {
+        using array = internal::as_std_array_t<T>;
+        static_assert(sizeof(array) == sizeof(T), "[eser] std::array and C-array layouts differ on this toolchain");
+        return to<array>();
+    }
+
+    template<endianness Wire, typename Source>
+    template<typename T, std::enable_if_t<
+        std::is_trivially_copyable_v<T> &&
+        !std::is_array_v<T> &&
+        !internal::is_tuple_v<T>, bool>
+    >
+    inline bool stream_deserializer<Wire, Source>::to_range(T *out, std::size_t count) noexcept
+    {
+        static_assert(not utils::is_bounded_v<T>, "[eser] to_range needs fixed-size records; read bounded fields one by one");
+        constexpr std::size_t record_size = serialized_size_of<T>();
+        // Compare by division so `count * record_size` cannot overflow on a hostile count.
+        if (count > _source->available() / record_size) return false;
+        if constexpr (not std::is_same_v<T, bool>) {
+            const std::size_t total_bytes = count * record_size;
+            if (const std::byte *in = _source->contiguous(total_bytes)) {
+                details::deserialize_elements<Wire>(out, in, count);
+                _source->advance(total_bytes);
+                return true;
+            }
+        }
+        for (std::size_t i = 0; i < count; ++i) details::deserialize_value_from<Wire>(*_source, out[i]);
+        return true;
+    }
+
+    template<endianness Wire, typename Source>
+    inline std::size_t stream_deserializer<Wire, Source>::available() const noexcept
+    {
+        return _source->available();
+    }
+
+    template<endianness Wire, typename Source>
+    template<typename T>
+    inline T stream_deserializer<Wire, Source>::deserialize_impl() noexcept
+    {
         T value {};
+        details::deserialize_value_from<Wire>(*_source, value);
+        return value;
+    }
+
+    template<endianness Wire, typename Source>
+    template<typename... Es>
+    inline std::optional<std::tuple<Es...>> stream_deserializer<Wire, Source>::to_impl(internal::type_identity<std::tuple<Es...>>) noexcept
+    {
+        static_assert(sizeof...(Es) > 0, "Cannot deserialize an empty std::tuple<>; name at least one field");
+        static_assert(details::is_fixed_size_v<Es...>, "[eser] bounded fields cannot be read from a stream source; copy the message into a buffer first");
+        constexpr std::size_t bytes_required = details::tuple_wire_size<Es...>();
+        if (_source->available() < bytes_required) return std::nullopt;
+        return read_fields<Es...>(std::index_sequence_for<Es...>{});
+    }
+
+    template<endianness Wire, typename Source>
+    template<typename... Es, std::size_t... I>
+    inline std::tuple<Es...> stream_deserializer<Wire, Source>::read_fields(std::index_sequence<I...>) noexcept
+    {
+        std::uint64_t group = 0;
+        // Braced init guarantees left-to-right evaluation (see deserializer::to_impl).
+        return std::tuple<Es...>{ deserialize_field<I, Es...>(group)... };
+    }
+
+    template<endianness Wire, typename Source>
+    template<std::size_t I, typename... Es>
+    inline internal::type_at_t<I, Es...> stream_deserializer<Wire, Source>::deserialize_field(std::uint64_t &group) noexcept
+    {
+        using groups = details::bit_groups<Es...>;
+        if constexpr (not groups::packed(I)) {
+            return deserialize_impl<internal::type_at_t<I, Es...>>();
+        } else {
+            if constexpr (groups::first(I) == I) {
+                constexpr std::size_t bytes = groups::group_size(I);
+                if (const std::byte *in = _source->contiguous(bytes)) {
+                    group = details::load_bit_group<Wire, bytes>(in);
+                    _source->advance(bytes);
+                } else {
+                    std::byte scratch[bytes];
+                    _source->read(scratch, bytes);
+                    group = details::load_bit_group<Wire, bytes>(scratch);
+                }
+            }
+            return details::extract_bit_field<Wire, I, Es...>(group);
+        }
+    }
+
+    template<endianness Wire, typename Source>
+    constexpr stream_deserializer<Wire, Source>::stream_deserializer(Source &source) noexcept
+    : _source(&source)
+    {
+    }
+
+    template<endianness Wire>
+    template<typename Tuple, std::enable_if_t<internal::is_tuple_v<Tuple>, bool>>
+    inline Tuple unchecked_deserializer<Wire>::to() noexcept
+    {
+        return to_impl(internal::type_identity<Tuple>{});
+    }
+
+    template<endianness Wire>
+    template<typename T, std::enable_if_t<
+        std::is_trivially_copyable_v<T> &&
+        !std::is_array_v<T> &&
+        !internal::is_tuple_v<T>, bool>
+    >
+    inline T unchecked_deserializer<Wire>::to() noexcept
+    {
+        static_assert(not utils::is_bounded_v<T>, "[eser] a bounded field's length prefix must be validated; read it with deserializer::to<T>()");
+        expect(serialized_size_of<T>());
+        return deserialize_impl<T>();
+    }
+
+    template<endianness Wire>
+    template<typename T, std::enable_if_t<
+        std::is_array_v<T> &&
+        (std::extent_v<T> > 0) &&
+        std::is_trivially_copyable_v<T>, bool>
+    >
+    inline internal::as_std_array_t<T> unchecked_deserializer<Wire>::to() noexcept
+    {
+        return to<internal::as_std_array_t<T>>();
+    }
+
+    template<endianness Wire>
+    template<typename T, std::enable_if_t<
+        std::is_trivially_copyable_v<T> &&
+        !std::is_array_v<T> &&
+        !internal::is_tuple_v<T>, bool>
+    >
+    inline void unchecked_deserializer<Wire>::to_range(T *out, std::size_t count) noexcept
+    {
+        static_assert(not utils::is_bounded_v<T>, "[eser] to_range needs fixed-size records; read bounded fields one by one");
+        constexpr std::size_t record_size = serialized_size_of<T>();
+        expect(count * record_size);
         if constexpr (std::is_same_v<T, bool>) {
-            // Read through an unsigned char and normalize: a wire byte other than 0/1 must not be
-            // materialized as a bool object, because a bool with a non-0/1 representation is a trap
-            // value and reading it is undefined behavior. Any non-zero byte deserializes to `true`.
-            // (This covers standalone `to<bool>()` and `bool` tuple elements; a `bool` nested inside
-            // a struct or std::array is copied wholesale and is NOT normalized — see the class docs.)
-            unsigned char raw = 0;
-            std::memcpy(&raw, _data, sizeof(raw));
-            value = (raw != 0);
+            for (std::size_t i = 0; i < count; ++i) out[i] = deserialize_impl<T>();
         } else {
-            std::memcpy(&value, _data, sizeof(T));
+            details::deserialize_elements<Wire>(out, _data, count);
+            _data += count * record_size;
         }
-        _data += sizeof(T);
-        _length -= sizeof(T);
-        internal::apply_wire_endianness<Wire>(value); // convert from wire order to host order
+    }
+
+    template<endianness Wire>
+    template<typename T>
+    inline T unchecked_deserializer<Wire>::deserialize_impl() noexcept
+    {
+        T value = details::deserialize_value<Wire, T>(_data);
+        _data += serialized_size_of<T>();
         return value;
     }
 
     template<endianness Wire>
-    constexpr deserializer<Wire>::deserializer(const std::byte *data, std::size_t length)
-    : _data(data), _length(length)
+    template<typename... Es>
+    inline std::tuple<Es...> unchecked_deserializer<Wire>::to_impl(internal::type_identity<std::tuple<Es...>>) noexcept
+    {
+        static_assert(sizeof...(Es) > 0, "Cannot deserialize an empty std::tuple<>; name at least one field");
+        static_assert(details::is_fixed_size_v<Es...>, "[eser] a bounded field's length prefix must be validated; read it with deserializer::to<T>()");
+        expect(details::tuple_wire_size<Es...>());
+        return read_fields<Es...>(std::index_sequence_for<Es...>{});
+    }
+
+    template<endianness Wire>
+    template<typename... Es, std::size_t... I>
+    inline std::tuple<Es...> unchecked_deserializer<Wire>::read_fields(std::index_sequence<I...>) noexcept
+    {
+        std::uint64_t group = 0;
+        // Braced init guarantees left-to-right evaluation (see deserializer::to_impl).
+        return std::tuple<Es...>{ deserialize_field<I, Es...>(group)... };
+    }
+
+    template<endianness Wire>
+    template<std::size_t I, typename... Es>
+    inline internal::type_at_t<I, Es...> unchecked_deserializer<Wire>::deserialize_field(std::uint64_t &group) noexcept
     {
+        using groups = details::bit_groups<Es...>;
+        if constexpr (not groups::packed(I)) {
+            return deserialize_impl<internal::type_at_t<I, Es...>>();
+        } else {
+            if constexpr (groups::first(I) == I) {
+                constexpr std::size_t bytes = groups::group_size(I);
+                group = details::load_bit_group<Wire, bytes>(_data);
+                _data += bytes;
+            }
+            return details::extract_bit_field<Wire, I, Es...>(group);
+        }
+    }
+
+    template<endianness Wire>
+    constexpr void unchecked_deserializer<Wire>::expect(std::size_t bytes) const noexcept
+    {
+        assert(static_cast<std::size_t>(_end - _data) >= bytes && "Unchecked read past the validated length");
+        static_cast<void>(bytes);
+    }
+
+    template<endianness Wire>
+    constexpr unchecked_deserializer<Wire>::unchecked_deserializer(const std::byte *data, std::size_t length) noexcept
+    : _data(data), _end(data + length)
+    {
+    }
+
+    template<endianness Wire, typename Source, std::enable_if_t<is_source_v<Source>, bool>>
+    constexpr stream_deserializer<Wire, Source> deserialize(Source &source) noexcept
+    {
+        return stream_deserializer<Wire, Source>(source);
     }
 
     template<endianness Wire>
@@ -106,6 +799,13 @@ namespace eser::flat{
         assert(data != nullptr && "Data pointer is null");
         return deserializer<Wire>(data, length);
     }
+    template<endianness Wire>
+    constexpr unchecked_deserializer<Wire> deserialize(unchecked_t, const std::byte *data, std::size_t length) noexcept
+    {
+        assert(data != nullptr && "Data pointer is null");
+        return unchecked_deserializer<Wire>(data, length);
+    }
+
     template<endianness Wire>
     constexpr deserializer<Wire> deserialize(const std::uint8_t *data, std::size_t length)
     {
@@ -0,0 +1,180 @@
+/**
+* @file encoder.hpp
+*
+* @ingroup eser_flat
+*
+* @brief A persistent, reusable encoder bound once to a fixed set of lvalue fields.
+*
+* `serialize(a, b, c).to(buffer)` is a one-shot expression: it captures its arguments in a fresh
+* `serializer` every time it is written. In a hot loop that re-sends the same variables — a control
+* loop publishing its state every tick — `eser::flat::encoder` binds to those variables once and
+* re-encodes their *current* values on every `encode_into` call:
+*
+* ```cpp
+* std::uint32_t tick = 0;
+* float setpoint = 0.f, measured = 0.f;
+*
+* auto state = make_encoder<endianness::big>(tick, setpoint, measured);
+* std::byte frame[state.size()];
+*
+* for (;;) {
+*     ++tick; measured = read_sensor();
+*     state.encode_into(frame);        // size checked at compile time; no runtime branch
+*     send(frame);
+* }
+* ```
+*
+* The wire bytes are exactly those of `serialize<Wire>(fields...).to(...)`.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+* - 2026-10-14
+* -     Added `max_size()`; the runtime `encode_into` overloads check the exact size of the bound
+*       values, so a message may hold `utils::bounded_vector` / `utils::bounded_string` fields.
+*/
+#ifndef ESER_FLAT_ENCODER_HPP_
+#define ESER_FLAT_ENCODER_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include "../internal/byte.hpp"
+#include "../utils/endianness.hpp"
+#include "serializer.hpp"
+#include "size.hpp"
+
+namespace eser::flat{
+    using utils::endianness;
+
+    /**
+    * @class encoder
+    * @brief Re-encodes a bound set of lvalue fields into a buffer on demand.
+    *
+    * Holds a `const` reference to every bound field (no copies) and, unlike `serializer`, can be
+    * stored and called any number of times. The message size is a compile-time constant
+    * (@ref size), so encoding into a fixed-size array is checked by `static_assert` and compiles
+    * to the field writes alone.
+    *
+    * @tparam Wire The byte order written to the stream.
+    * @tparam T... The bound field types.
+    *
+    * @warning The encoder references the bound variables: it must not outlive any of them.
+    */
+    template<endianness Wire, typename... T>
+    class encoder{
+    public:
+        /**
+        * @brief The number of bytes every `encode_into` call writes.
+        * @return `serialized_size_of<T...>()`.
+        * @note Only for a fixed-size message; with bounded fields use @ref max_size.
+        */
+        [[nodiscard]] static constexpr std::size_t size() noexcept;
+
+        /**
+        * @brief The most bytes an `encode_into` call can write.
+        * @return `max_serialized_size_of<T...>()`; equal to @ref size for a fixed-size message.
+        */
+        [[nodiscard]] static constexpr std::size_t max_size() noexcept;
+
+        /**
+        * @brief Encode the current values of the bound fields into a buffer.
+        *
+        * @param buffer A pointer to a writable output byte stream as `std::byte*`.
+        * @param size The size of the output buffer in bytes.
+        * @return The number of bytes written, or `0` if the buffer is too small — nothing
+        *         is written in that case (and an `assert` fires in debug builds, as in `serializer`).
+        */
+        std::size_t encode_into(std::byte *buffer, std::size_t size) const noexcept;
+
+        /**
+        * @brief Encode the current values of the bound fields into a fixed-size byte array.
+        *
+        * The capacity check is a `static_assert`: an array smaller than `max_size()` does not
+        * compile, and no runtime size comparison is emitted.
+        *
+        * @tparam N The size of the output array in bytes; must be `>= max_size()`.
+        * @param buffer A fixed-size writable array of `std::byte` elements.
+        * @return The number of bytes written.
+        */
+        template<std::size_t N>
+        std::size_t encode_into(std::byte (&buffer)[N]) const noexcept;
+
+        /**
+        * @brief Encode the current values of the bound fields into a legacy `uint8_t` buffer.
+        *
+        * @param buffer A pointer to a legacy byte stream as `std::uint8_t*`.
+        * @param size The size of the output buffer in bytes.
+        * @return The number of bytes written, or `0` if the buffer is too small.
+        *
+        * @see encoder::encode_into(std::byte*, std::size_t)
+        */
+        std::size_t encode_into(std::uint8_t *buffer, std::size_t size) const noexcept;
+
+        /**
+        * @brief Encode the current values of the bound fields into a legacy fixed-size `uint8_t` array.
+        *
+        * @tparam N The size of the output array in bytes; must be `>= max_size()` (`static_assert`).
+        * @param buffer A fixed-size array of legacy `std::uint8_t` bytes.
+        * @return The number of bytes written.
+        *
+        * @see encoder::encode_into(std::byte (&)[N])
+        */
+        template<std::size_t N>
+        std::size_t encode_into(std::uint8_t (&buffer)[N]) const noexcept;
+
+        /**
+        * @brief Encode the current values of the bound fields into a sink (chunk list, ring, ...).
+        *
+        * @tparam Sink A type modelling the sink concept (`is_sink_v<Sink>`, see stream.hpp).
+        * @param sink The output sink; its cursor is advanced past the written bytes.
+        * @return The number of bytes written, or `0` if the sink has too little room.
+        *
+        * @see serializer::to(Sink&)
+        */
+        template<typename Sink, std::enable_if_t<is_sink_v<Sink>, bool> = true>
+        std::size_t encode_into(Sink &sink) const;
+
+    private:
+        std::tuple<const T&...> _fields; ///< The bound fields.
+
+        /**
+        * @brief Private constructor to enforce the use of `make_encoder`.
+        * @param fields The fields to bind.
+        */
+        constexpr explicit encoder(const T&... fields) noexcept;
+
+        template<endianness W, typename... U>
+        friend constexpr encoder<W, std::remove_reference_t<U>...> make_encoder(U&&... fields) noexcept;
+    };
+
+    /**
+    * @brief Factory function binding an `encoder` to the given lvalue fields.
+    *
+    * @tparam Wire The byte order to serialize with (default `endianness::little`).
+    * @tparam T... The deduced field types. Every argument must be an lvalue — the encoder keeps a
+    *              reference to it — so temporaries are rejected at compile time.
+    * @param fields The variables to bind.
+    * @return An `encoder` over the fields.
+    */
+    template<endianness Wire = endianness::little, typename... T>
+    constexpr encoder<Wire, std::remove_reference_t<T>...> make_encoder(T&&... fields) noexcept
+    {
+        static_assert(sizeof...(T) > 0, "At least one field must be bound");
+        static_assert((std::is_lvalue_reference_v<T> and ...),
+            "[eser] make_encoder binds to variables by reference; pass lvalues, not temporaries "
+            "(use serialize(...).to(...) for one-shot values)");
+        return encoder<Wire, std::remove_reference_t<T>...>(fields...);
+    }
+} // namespace eser::flat
+
+#include "encoder.tpp"
+#endif // ESER_FLAT_ENCODER_HPP_
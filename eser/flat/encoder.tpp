@@ -0,0 +1,86 @@
+/**
+* @file encoder.tpp
+*
+* @brief Definition of functionality in encoder.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_ENCODER_TPP_
+#define ESER_FLAT_ENCODER_TPP_
+#include "encoder.hpp"
+#include <cassert>
+
+namespace eser::flat{
+    template<endianness Wire, typename... T>
+    constexpr std::size_t encoder<Wire, T...>::size() noexcept
+    {
+        return serialized_size_of<T...>();
+    }
+
+    template<endianness Wire, typename... T>
+    constexpr std::size_t encoder<Wire, T...>::max_size() noexcept
+    {
+        return max_serialized_size_of<T...>();
+    }
+
+    template<endianness Wire, typename... T>
+    inline std::size_t encoder<Wire, T...>::encode_into(std::byte *buffer, std::size_t size) const noexcept
+    {
+        if (not details::fits(_fields, size)){
+            assert(false && "Buffer size is insufficient for serialization");
+            return 0;
+        }
+        return details::serialize_fields<Wire>(buffer, size, _fields);
+    }
+
+    template<endianness Wire, typename... T>
+    template<std::size_t N>
+    inline std::size_t encoder<Wire, T...>::encode_into(std::byte (&buffer)[N]) const noexcept
+    {
+        static_assert(N >= encoder::max_size(), "[eser] the output array is smaller than the encoded message");
+        return details::serialize_fields<Wire>(buffer, N, _fields);
+    }
+
+    template<endianness Wire, typename... T>
+    inline std::size_t encoder<Wire, T...>::encode_into(std::uint8_t *buffer, std::size_t size) const noexcept
+    {
+        return encode_into(static_cast<std::byte *>(static_cast<void *>(buffer)), size);
+    }
+
+    template<endianness Wire, typename... T>
+    template<std::size_t N>
+    inline std::size_t encoder<Wire, T...>::encode_into(std::uint8_t (&buffer)[N]) const noexcept
+    {
+        static_assert(N >= encoder::max_size(), "[eser] the output array is smaller than the encoded message");
+        return details::serialize_fields<Wire>(static_cast<std::byte *>(static_cast<void *>(buffer)), N, _fields);
+    }
+
+    template<endianness Wire, typename... T>
+    template<typename Sink, std::enable_if_t<is_sink_v<Sink>, bool>>
+    inline std::size_t encoder<Wire, T...>::encode_into(Sink &sink) const
+    {
+        if (not details::fits(_fields, sink.available())){
+            assert(false && "Sink has insufficient room for serialization");
+            return 0;
+        }
+        return details::serialize_fields_to<Wire>(sink, _fields);
+    }
+
+    template<endianness Wire, typename... T>
+    constexpr encoder<Wire, T...>::encoder(const T&... fields) noexcept
+    : _fields(fields...)
+    {
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_ENCODER_TPP_
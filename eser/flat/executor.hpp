@@ -0,0 +1,120 @@
+/**
+* @file executor.hpp
+*
+* @ingroup eser_flat
+*
+* @brief Executors for the parallel bulk overloads of `serialize_range(...).to` and
+*        `deserializer::to_range`.
+*
+* Every record of a fixed-size batch lands at `i * serialized_size_of<T>()`, so a batch splits into
+* independent parts that need no synchronization beyond the final join. The bulk overloads take
+* any executor with these two members, which makes a project's own thread pool pluggable:
+*
+* | Member | Meaning |
+* |---|---|
+* | `std::size_t concurrency() const` | how many parts are worth running at once |
+* | `void run(std::size_t parts, const Job &job)` | call `job(part)` for every `part < parts`, possibly in parallel, and return when all have returned |
+*
+* Two are provided:
+*
+* - @ref inline_executor runs the parts one after another on the calling thread; always available.
+* - @ref thread_executor runs them on `std::thread`s started for the call and joined before it
+*   returns. It exists only where the standard library has threads (`ESER_HAS_THREADS` is then
+*   defined to 1). Define `ESER_NO_THREADS` to leave it out regardless; nothing else in the
+*   library needs threads.
+*
+* ```cpp
+* thread_executor pool;                                   // std::thread::hardware_concurrency() workers
+* serialize_range(records, count).to(buffer, size, pool); // one memcpy below parallel_threshold
+* ```
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_EXECUTOR_HPP_
+#define ESER_FLAT_EXECUTOR_HPP_
+#include <cstddef>
+
+#if !defined(ESER_NO_THREADS)
+    #if defined(_GLIBCXX_HAS_GTHREADS) || (defined(_MSC_VER) && !defined(__clang__)) \
+        || (defined(_LIBCPP_VERSION) && !defined(_LIBCPP_HAS_NO_THREADS))
+        #define ESER_HAS_THREADS 1
+    #endif
+#endif
+
+#if defined(ESER_HAS_THREADS)
+    #include <thread>
+#endif
+
+namespace eser::flat{
+    /**
+    * @class inline_executor
+    * @brief Runs every part on the calling thread, in order.
+    */
+    class inline_executor{
+    public:
+        /**
+        * @brief Always 1: the bulk overloads then take their single-threaded path.
+        */
+        [[nodiscard]] static constexpr std::size_t concurrency() noexcept;
+
+        /**
+        * @brief Call `job(part)` for every `part < parts`, in order.
+        */
+        template<typename Job>
+        static void run(std::size_t parts, const Job &job);
+    };
+
+#if defined(ESER_HAS_THREADS)
+    /**
+    * @class thread_executor
+    * @brief Runs the parts on `std::thread`s started for each `run` and joined before it returns.
+    *
+    * The calling thread runs part 0 itself. Starting a thread costs tens of microseconds, which is
+    * what `parallel_threshold` is sized against; a long-lived pool plugged in through the same two
+    * members avoids it.
+    */
+    class thread_executor{
+    public:
+        static constexpr std::size_t max_threads = 64; ///< The most threads one `run` uses.
+
+        /**
+        * @brief An executor of `threads` threads, counting the caller's.
+        * @param threads The concurrency; `0` uses `std::thread::hardware_concurrency()`.
+        */
+        explicit thread_executor(std::size_t threads = 0) noexcept;
+
+        /**
+        * @brief The number of threads a `run` uses, at most `max_threads`.
+        */
+        [[nodiscard]] std::size_t concurrency() const noexcept;
+
+        /**
+        * @brief Call `job(part)` for every `part < parts`, spread over `concurrency()` threads.
+        *
+        * If a thread cannot be started (`std::system_error`), the parts meant for it run on the
+        * calling thread instead; every thread started is joined before `run` returns.
+        *
+        * @warning `job` must not throw: an exception escaping it, on a worker or on the calling
+        *          thread, terminates the program.
+        */
+        template<typename Job>
+        void run(std::size_t parts, const Job &job) const noexcept;
+
+    private:
+        std::size_t _threads; ///< See `concurrency()`.
+    };
+#endif
+} // namespace eser::flat
+
+#include "executor.tpp"
+#endif // ESER_FLAT_EXECUTOR_HPP_
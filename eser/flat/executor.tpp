@@ -0,0 +1,78 @@
+/**
+* @file executor.tpp
+*
+* @brief Definition of functionality in executor.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+* - 2026-10-14
+*       `thread_executor::run` runs the parts of threads that fail to start on the caller and
+*       joins every started thread; it is `noexcept`.
+*/
+#ifndef ESER_FLAT_EXECUTOR_TPP_
+#define ESER_FLAT_EXECUTOR_TPP_
+#include "executor.hpp"
+#include <algorithm>
+#if defined(ESER_HAS_THREADS)
+    #include <system_error>
+#endif
+
+namespace eser::flat{
+    constexpr std::size_t inline_executor::concurrency() noexcept
+    {
+        return 1;
+    }
+
+    template<typename Job>
+    inline void inline_executor::run(std::size_t parts, const Job &job)
+    {
+        for (std::size_t part = 0; part < parts; ++part) job(part);
+    }
+
+#if defined(ESER_HAS_THREADS)
+    inline thread_executor::thread_executor(std::size_t threads) noexcept
+    : _threads(std::min<std::size_t>(max_threads, threads != 0 ? threads : std::max(1u, std::thread::hardware_concurrency())))
+    {
+    }
+
+    inline std::size_t thread_executor::concurrency() const noexcept
+    {
+        return _threads;
+    }
+
+    template<typename Job>
+    inline void thread_executor::run(std::size_t parts, const Job &job) const noexcept
+    {
+        const std::size_t threads = std::min(parts, _threads);
+        // thread t runs parts t, t + threads, ...
+        const auto stripe = [&job, parts, threads](std::size_t first){
+            for (std::size_t part = first; part < parts; part += threads) job(part);
+        };
+        std::thread workers[max_threads];
+        std::size_t started = 1;
+#if defined(__cpp_exceptions)
+        try {
+#endif
+            for (; started < threads; ++started) workers[started] = std::thread(stripe, started);
+#if defined(__cpp_exceptions)
+        } catch (const std::system_error &) {
+            // out of threads: the stripes that did not start run below, on this thread
+        }
+#endif
+        stripe(0);
+        for (std::size_t t = started; t < threads; ++t) stripe(t);
+        for (std::size_t t = 1; t < started; ++t) workers[t].join();
+    }
+#endif
+} // namespace eser::flat
+
+#endif // ESER_FLAT_EXECUTOR_TPP_
@@ -0,0 +1,115 @@
+/**
+* @file fingerprint.hpp
+*
+* @ingroup eser_flat
+*
+* @brief A compile-time 32-bit fingerprint of a message's schema, for a one-compare version check.
+*
+* The flat format is tagless: a receiver built against a different field list decodes garbage
+* without noticing. `schema_fingerprint_v<Wire, T...>` hashes everything the wire depends on, from
+* the same traits `serialized_size_of` uses:
+*
+* - the byte order, the number of fields and their order;
+* - each field's kind (`bool`, unsigned / signed integer, `char`, floating point, enum, `bits`,
+*   `fixed_string`, bounded, array, described struct, raw struct) and its wire size;
+* - the parameters that change the wire: an enum's underlying type, a `bits` width, string and
+*   bounded capacities (hence the length prefix width), array extents, the members, offsets and
+*   layout of an `ESER_REFLECT` struct, the size and alignment of a raw struct.
+*
+* Names are not part of the wire and not part of the fingerprint: renaming a field or an enum
+* keeps it, retyping one changes it. The sender puts the 4 bytes in its envelope; the receiver
+* compares them with its own constant before decoding anything:
+*
+* ```cpp
+* using telemetry = std::tuple<std::uint32_t, float, float>;
+* constexpr std::uint32_t schema = schema_fingerprint_v<endianness::big, std::uint32_t, float, float>;
+*
+* serialize<endianness::big>(schema, t, lat, lon).to(packet);                        // sender
+*
+* auto d = deserialize<endianness::big>(packet, n);                                 // receiver
+* if (d.to<std::uint32_t>() != schema) return;     // another firmware's layout: drop it
+* auto m = d.to<telemetry>();
+* ```
+*
+* The hash is 32-bit FNV-1a over a canonical description, so it is identical across compilers and
+* hosts. Two different schemas collide with probability about 2^-32; it is a version check, not
+* an integrity check.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_FINGERPRINT_HPP_
+#define ESER_FLAT_FINGERPRINT_HPP_
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "../internal/byte.hpp"
+#include "../internal/traits.hpp"
+#include "../utils/endianness.hpp"
+#include "../utils/bits.hpp"
+#include "../utils/fixed_string.hpp"
+#include "../utils/bounded_vector.hpp"
+#include "../utils/reflect.hpp"
+#include "size.hpp"
+
+namespace eser::flat{
+    using utils::endianness;
+
+    /**
+    * @brief The schema fingerprint of the message `T...` on a `Wire`-ordered stream.
+    * @tparam Wire The byte order of the stream.
+    * @tparam T... The message's field types, in wire order (cv/ref qualifiers are ignored).
+    * @return The 32-bit FNV-1a hash of the message's canonical description.
+    */
+    template<endianness Wire, typename... T>
+    [[nodiscard]] constexpr std::uint32_t schema_fingerprint() noexcept;
+
+    /**
+    * @var schema_fingerprint_v
+    * @brief Convenience variable template for `schema_fingerprint<Wire, T...>()`.
+    */
+    template<endianness Wire, typename... T>
+    inline constexpr std::uint32_t schema_fingerprint_v = schema_fingerprint<Wire, T...>();
+
+    namespace details{
+        /**
+        * @brief Fold the 8 bytes of `value`, least significant first, into the FNV-1a state `hash`.
+        */
+        constexpr std::uint32_t fnv1a_mix(std::uint32_t hash, std::uint64_t value) noexcept;
+
+        /**
+        * @brief Fold the description of one field of type `T` into `hash`.
+        * @tparam T The field type (cv/ref qualifiers are ignored).
+        */
+        template<typename T>
+        constexpr std::uint32_t describe_field(std::uint32_t hash) noexcept;
+
+        /**
+        * @brief Fold the members of a described struct into `hash`: each member's offset and type.
+        * @tparam Reflection A `utils::reflection` specialization.
+        */
+        template<typename Reflection>
+        struct describe_members;
+
+        /**
+        * @brief Specialization of `describe_members` extracting the member list.
+        */
+        template<typename T, utils::wire_layout Layout, typename... Members>
+        struct describe_members<utils::reflection<T, Layout, Members...>>{
+            static constexpr std::uint32_t apply(std::uint32_t hash) noexcept;
+        };
+    } // namespace details
+} // namespace eser::flat
+
+#include "fingerprint.tpp"
+#endif // ESER_FLAT_FINGERPRINT_HPP_
@@ -0,0 +1,100 @@
+/**
+* @file fingerprint.tpp
+*
+* @brief Definition of functionality in fingerprint.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_FINGERPRINT_TPP_
+#define ESER_FLAT_FINGERPRINT_TPP_
+#include "fingerprint.hpp"
+
+namespace eser::flat{
+    namespace details{
+        /**
+        * @brief The kind codes of the canonical description; part of the wire contract, never renumber.
+        */
+        enum class field_kind : std::uint8_t{
+            boolean = 1, unsigned_integer, signed_integer, character, floating_point, enumeration,
+            bit_field, string, bounded, array, described, raw
+        };
+
+        constexpr std::uint32_t fnv1a_mix(std::uint32_t hash, std::uint64_t value) noexcept
+        {
+            for (std::size_t i = 0; i < 8; ++i) {
+                hash ^= static_cast<std::uint8_t>(value >> (8 * i));
+                hash *= 16777619u;
+            }
+            return hash;
+        }
+
+        template<typename T>
+        constexpr std::uint32_t describe_field(std::uint32_t hash) noexcept
+        {
+            using bare_t = std::remove_cv_t<std::remove_reference_t<T>>;
+            const auto kind = [&hash](field_kind k, std::size_t size){
+                return fnv1a_mix(fnv1a_mix(hash, static_cast<std::uint8_t>(k)), size);
+            };
+            if constexpr (std::is_same_v<bare_t, bool>) {
+                return kind(field_kind::boolean, 1);
+            } else if constexpr (std::is_same_v<bare_t, char>) {
+                return kind(field_kind::character, 1);
+            } else if constexpr (std::is_integral_v<bare_t>) {
+                return kind(std::is_signed_v<bare_t> ? field_kind::signed_integer : field_kind::unsigned_integer, sizeof(bare_t));
+            } else if constexpr (std::is_floating_point_v<bare_t>) {
+                return kind(field_kind::floating_point, sizeof(bare_t));
+            } else if constexpr (std::is_enum_v<bare_t>) {
+                return describe_field<std::underlying_type_t<bare_t>>(kind(field_kind::enumeration, sizeof(bare_t)));
+            } else if constexpr (utils::is_bits_v<bare_t>) {
+                return describe_field<typename bare_t::value_type>(fnv1a_mix(kind(field_kind::bit_field, sizeof(bare_t)), bare_t::width));
+            } else if constexpr (utils::is_fixed_string_v<bare_t>) {
+                return kind(field_kind::string, bare_t::capacity());
+            } else if constexpr (utils::is_bounded_v<bare_t>) {
+                // same description for every bounded type of one element type and capacity: same wire
+                return describe_field<typename bare_t::value_type>(
+                    fnv1a_mix(kind(field_kind::bounded, bare_t::capacity()), sizeof(typename bare_t::length_type)));
+            } else if constexpr (std::is_array_v<bare_t>) {
+                return describe_field<std::remove_extent_t<bare_t>>(kind(field_kind::array, std::extent_v<bare_t>));
+            } else if constexpr (internal::is_std_array_v<bare_t>) {
+                // a C-array and a std::array of the same shape have the same wire image
+                return describe_field<typename bare_t::value_type>(kind(field_kind::array, std::tuple_size_v<bare_t>));
+            } else if constexpr (utils::is_reflected_v<bare_t>) {
+                using reflection = utils::reflection_t<bare_t>;
+                const std::uint32_t head = fnv1a_mix(kind(field_kind::described, serialized_size_of<bare_t>()),
+                                                     static_cast<std::uint8_t>(reflection::layout));
+                return describe_members<reflection>::apply(fnv1a_mix(head, reflection::count));
+            } else {
+                return fnv1a_mix(kind(field_kind::raw, sizeof(bare_t)), alignof(bare_t));
+            }
+        }
+
+        template<typename T, utils::wire_layout Layout, typename... Members>
+        constexpr std::uint32_t describe_members<utils::reflection<T, Layout, Members...>>::apply(std::uint32_t hash) noexcept
+        {
+            ((hash = describe_field<typename Members::value_type>(fnv1a_mix(hash, Layout == utils::wire_layout::packed ? 0 : Members::offset))), ...);
+            return hash;
+        }
+    } // namespace details
+
+    template<endianness Wire, typename... T>
+    constexpr std::uint32_t schema_fingerprint() noexcept
+    {
+        std::uint32_t hash = 2166136261u;   // the FNV-1a offset basis
+        hash = details::fnv1a_mix(hash, static_cast<std::uint8_t>(Wire));
+        hash = details::fnv1a_mix(hash, sizeof...(T));
+        ((hash = details::describe_field<T>(hash)), ...);
+        return hash;
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_FINGERPRINT_TPP_
@@ -13,6 +13,21 @@
 * 
 * - @ref eser::flat::serializer "serializer" - Converts C++ objects and arrays into a raw byte stream.
 * - @ref eser::flat::deserializer "deserializer" - Reconstructs C++ objects and arrays from a byte stream.
+* - @ref eser::flat::layout "layout" - Compile-time field offsets for random-access reads and in-place patches.
+* - @ref eser::flat::convert_in_place "convert_in_place" - Byte-order conversion of a whole serialized message in place.
+* - @ref eser::flat::delta_encoder "delta_encoder" - Sends only the fields that changed since the previous frame.
+* - Schema fingerprints (fingerprint.hpp) - A `constexpr` 32-bit hash of a message's layout for one-compare version checks.
+* - @ref eser::flat::batch_writer "batch_writer" - Batches messages into I/O-owned buffers; `for_each_message` decodes them in place.
+* - @ref eser::flat::encoder "encoder" - A reusable encoder bound to variables, for re-sending them in hot loops.
+* - Sinks and sources (stream.hpp) - Serialize into and read from chunk lists and ring buffers.
+* - @ref eser::flat::frame "frame" - A sync / length / checksum envelope, checksummed in the same pass (checksum.hpp).
+* - @ref eser::flat::frame_parser "frame_parser" - Assembles frames from input that arrives in pieces.
+* - @ref eser::flat::message_set "message_set" - Dispatches id-prefixed messages through a compile-time jump table.
+* - @ref eser::flat::record_file "record_file" - A row or columnar record file, appended and read in place.
+* - @ref eser::flat::message_queue "message_queue" - Lock-free SPSC / MPSC queues serialized into in place.
+* - @ref eser::flat::buffer_pool "buffer_pool" - Cache-line aligned message buffers sized by a message set, with a lock-free freelist.
+* - Executors (executor.hpp) - Split large `serialize_range` / `to_range` batches across threads.
+* - The observer policy (observer.hpp) - Compile-time hooks for per-message byte, failure and latency metrics.
 *
 * This module is designed for:
 * 
@@ -81,10 +96,54 @@
 * - 2025-08-05
 *       License changed from CC BY-ND 4.0 to MIT.
 *       Library renamed from `ser` to `eser`
+* - 2026-10-14
+*       Added layout.hpp (`layout<T...>`).
+*       Added encoder.hpp (`encoder<Wire, T...>`, `make_encoder`).
+*       Added stream.hpp (sinks and sources over non-contiguous memory).
+* - 2026-10-14
+*       Added checksum.hpp (CRC policies, `checksum_sink` / `checksum_source`) and frame.hpp.
+* - 2026-10-14
+*       Added frame_parser.hpp.
+* - 2026-10-14
+*       Added message_set.hpp.
+* - 2026-10-14
+*       Added record_file.hpp.
+* - 2026-10-14
+*       Added message_queue.hpp.
+* - 2026-10-14
+*       Added executor.hpp.
+* - 2026-10-14
+*       Added observer.hpp.
+* - 2026-10-14
+*       Added convert.hpp.
+* - 2026-10-14
+*       Added delta.hpp.
+* - 2026-10-14
+*       Added fingerprint.hpp.
+* - 2026-10-14
+*       Added batch.hpp.
+* - 2026-10-14
+*       Added buffer_pool.hpp.
 */
 #ifndef ESER_FLAT_BINARY_HPP_
 #define ESER_FLAT_BINARY_HPP_
 #include "serializer.hpp"
 #include "deserializer.hpp"
 #include "size.hpp"
+#include "layout.hpp"
+#include "encoder.hpp"
+#include "stream.hpp"
+#include "checksum.hpp"
+#include "frame.hpp"
+#include "frame_parser.hpp"
+#include "message_set.hpp"
+#include "record_file.hpp"
+#include "message_queue.hpp"
+#include "executor.hpp"
+#include "observer.hpp"
+#include "convert.hpp"
+#include "delta.hpp"
+#include "fingerprint.hpp"
+#include "batch.hpp"
+#include "buffer_pool.hpp"
 #endif // ESER_FLAT_BINARY_HPP_
\ No newline at end of file
@@ -0,0 +1,217 @@
+/**
+* @file frame.hpp
+*
+* @ingroup eser_flat
+*
+* @brief Opt-in frame envelope: sync word, payload length, payload and checksum, written and
+*        verified without a second pass over the message.
+*
+* `frame<Checksum, Wire, Sync>` wraps a flat message in a small envelope, every field of which
+* follows `Wire`:
+*
+* | Field | Size | Content |
+* |---|---|---|
+* | sync | 2 | `Sync` |
+* | length | 2 | payload bytes (at most 65535) |
+* | payload | length | `serialize<Wire>(fields...)` |
+* | checksum | `Checksum::size` | `Checksum` over the length field and the payload |
+*
+* Writing goes through a @ref checksum_sink, so each field is checksummed just after it is written.
+* Reading a frame out of a buffer verifies the sync word, the length and the checksum before a
+* single field is decoded, and only then hands out a deserializer over the payload:
+*
+* ```cpp
+* using link = frame<crc32c, endianness::big>;
+*
+* std::byte tx[link::max_size_of<std::uint32_t, float, std::uint16_t>()];
+* std::size_t n = link::serialize(id, value, flags).to(tx);
+*
+* if (auto payload = link::open(rx, rx_length)) {          // nullopt on a bad sync, length or CRC
+*     auto fields = payload->to<std::tuple<std::uint32_t, float, std::uint16_t>>();
+* }
+* ```
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_FRAME_HPP_
+#define ESER_FLAT_FRAME_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include "../internal/byte.hpp"
+#include "../internal/traits.hpp"
+#include "../utils/endianness.hpp"
+#include "checksum.hpp"
+#include "serializer.hpp"
+#include "deserializer.hpp"
+#include "size.hpp"
+#include "stream.hpp"
+
+namespace eser::flat{
+    template<typename Frame, typename... T>
+    class frame_serializer;
+
+    /**
+    * @class frame
+    * @brief The framing policy: envelope layout, writer factory and verifying readers.
+    *
+    * All members are static; the class is never instantiated.
+    *
+    * @tparam Checksum The checksum policy (see checksum.hpp); @ref no_checksum omits the trailer.
+    * @tparam Wire The byte order of the envelope and the payload.
+    * @tparam Sync The 16-bit sync word that starts every frame.
+    */
+    template<typename Checksum = crc16_ccitt, endianness Wire = endianness::little, std::uint16_t Sync = 0xEB90>
+    class frame{
+    public:
+        using checksum_type = Checksum;                              ///< The checksum policy.
+        using checksum_value_type = typename Checksum::value_type;   ///< The checksum type.
+        using length_type = std::uint16_t;                           ///< The wire type of the length field.
+
+        static constexpr endianness wire = Wire;                     ///< The byte order.
+        static constexpr std::uint16_t sync = Sync;                  ///< The sync word.
+        static constexpr std::size_t header_size = 4;                ///< Sync word and length field.
+        static constexpr std::size_t trailer_size = Checksum::size;  ///< The checksum.
+        static constexpr std::size_t overhead = header_size + trailer_size; ///< Envelope bytes per frame.
+        static constexpr std::size_t max_payload = 0xFFFF;           ///< The longest payload.
+
+        /**
+        * @brief The largest frame a message of the given field types can produce.
+        * @tparam T... The field types.
+        * @return `overhead + max_serialized_size_of<T...>()`; exact for a fixed-size message.
+        */
+        template<typename... T>
+        [[nodiscard]] static constexpr std::size_t max_size_of() noexcept;
+
+        /**
+        * @brief Capture fields to write as one frame, like `flat::serialize`.
+        *
+        * @tparam T... The deduced field types (lvalues held by reference, rvalues by value).
+        * @param args The fields.
+        * @return A @ref frame_serializer; call one of its `to()` overloads right away.
+        */
+        template<typename... T>
+        [[nodiscard]] static constexpr frame_serializer<frame, T...> serialize(T &&...args);
+
+        /**
+        * @brief Verify the frame at the start of a buffer and hand out its payload.
+        *
+        * Checks, in order: that the buffer holds a whole envelope, the sync word, that the length
+        * field fits in the buffer, and the checksum. No field of the payload is decoded.
+        *
+        * @param data The first byte of the frame.
+        * @param length The bytes available at `data`; bytes after the frame are ignored.
+        * @return A deserializer over exactly the payload, or `std::nullopt` if any check fails.
+        */
+        [[nodiscard]] static std::optional<deserializer<Wire>> open(const std::byte *data, std::size_t length) noexcept;
+
+        /**
+        * @brief Verify the frame at the start of a legacy `std::uint8_t` buffer.
+        * @see open(const std::byte*, std::size_t)
+        */
+        [[nodiscard]] static std::optional<deserializer<Wire>> open(const std::uint8_t *data, std::size_t length) noexcept;
+
+        /**
+        * @brief The total size of the frame at the start of a buffer, from its header alone.
+        *
+        * @param data The first byte of the frame.
+        * @param length The bytes available at `data`.
+        * @return `overhead + ` the length field, or `std::nullopt` if fewer than `header_size` bytes
+        *         are available or the sync word does not match. The checksum is not verified.
+        */
+        [[nodiscard]] static std::optional<std::size_t> size_of(const std::byte *data, std::size_t length) noexcept;
+
+        /**
+        * @brief Read one frame from a source and decode its payload as `Tuple`, checksumming each
+        *        field as it is read.
+        *
+        * A source cannot be rewound, so the payload bytes are not checksummed ahead of time: they are
+        * fed to the checksum while the fields are decoded, and the decoded tuple is discarded unless
+        * the checksum matches. The length field must equal the tuple's wire size.
+        *
+        * @tparam Tuple A `std::tuple` of fixed-size fields.
+        * @tparam Source A type modelling the source concept (see stream.hpp).
+        * @param source The input source.
+        * @return The fields, or `std::nullopt`. If the source holds less than a whole frame of this
+        *         size nothing is consumed; after a bad sync word or length, the header is consumed;
+        *         after a checksum mismatch, the whole frame is.
+        */
+        template<typename Tuple, typename Source, std::enable_if_t<is_source_v<Source>, bool> = true>
+        [[nodiscard]] static std::optional<Tuple> read(Source &source) noexcept;
+
+        frame() = delete;
+    };
+
+    /**
+    * @class frame_serializer
+    * @brief Writes captured fields as one frame; created by `frame<...>::serialize`.
+    *
+    * Like `serializer`, every `to()` overload is rvalue-ref-qualified.
+    *
+    * @tparam Frame The `frame` specialization.
+    * @tparam T... The captured field types.
+    */
+    template<typename Frame, typename... T>
+    class frame_serializer{
+    public:
+        /**
+        * @brief Write the frame into a buffer.
+        *
+        * @param buffer The output buffer.
+        * @param size The size of `buffer` in bytes.
+        * @return The frame size, or `0` if the buffer is too small or the payload is longer than
+        *         `Frame::max_payload` (an `assert` fires in debug builds); nothing is written then.
+        */
+        std::size_t to(std::byte *buffer, std::size_t size) &&;
+
+        /**
+        * @brief Write the frame into a fixed-size array.
+        * @see to(std::byte*, std::size_t)
+        */
+        template<std::size_t N>
+        std::size_t to(std::byte (&buffer)[N]) &&;
+
+        /**
+        * @brief Write the frame into a legacy `std::uint8_t` buffer.
+        * @see to(std::byte*, std::size_t)
+        */
+        std::size_t to(std::uint8_t *buffer, std::size_t size) &&;
+
+        /**
+        * @brief Write the frame into a sink (chunk list, ring buffer, ...).
+        *
+        * @tparam Sink A type modelling the sink concept (`is_sink_v<Sink>`).
+        * @param sink The output sink.
+        * @return The frame size, or `0` if the sink has too little room or the payload is too long;
+        *         nothing is written then.
+        */
+        template<typename Sink, std::enable_if_t<is_sink_v<Sink>, bool> = true>
+        std::size_t to(Sink &sink) &&;
+
+    private:
+        std::size_t _payload_size;                     ///< `serialized_size` of the captured fields.
+        serializer<Frame::wire, T...> _payload;        ///< The captured fields.
+
+        /**
+        * @brief Capture the fields and measure the payload.
+        */
+        constexpr explicit frame_serializer(T &&...args);
+
+        friend Frame;
+    };
+} // namespace eser::flat
+
+#include "frame.tpp"
+#endif // ESER_FLAT_FRAME_HPP_
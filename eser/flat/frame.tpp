@@ -0,0 +1,160 @@
+/**
+* @file frame.tpp
+*
+* @brief Definition of functionality in frame.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+* - 2026-10-14
+*       The sync, length and checksum words bypass the observer; only the payload is reported.
+*/
+#ifndef ESER_FLAT_FRAME_TPP_
+#define ESER_FLAT_FRAME_TPP_
+#include "frame.hpp"
+#include <cassert>
+#include <utility>
+
+namespace eser::flat{
+    namespace details{
+        /**
+        * @brief The payload size of a frame decoded as `Tuple`.
+        */
+        template<typename Tuple>
+        struct frame_payload_size;
+
+        /**
+        * @brief Specialization of `frame_payload_size` unpacking the tuple's element types.
+        */
+        template<typename... Es>
+        struct frame_payload_size<std::tuple<Es...>>{
+            static constexpr std::size_t value = serialized_size_of<Es...>(); ///< The payload size.
+        };
+    } // namespace details
+
+    template<typename Checksum, endianness Wire, std::uint16_t Sync>
+    template<typename... T>
+    constexpr std::size_t frame<Checksum, Wire, Sync>::max_size_of() noexcept
+    {
+        return overhead + max_serialized_size_of<T...>();
+    }
+
+    template<typename Checksum, endianness Wire, std::uint16_t Sync>
+    template<typename... T>
+    constexpr frame_serializer<frame<Checksum, Wire, Sync>, T...> frame<Checksum, Wire, Sync>::serialize(T &&...args)
+    {
+        static_assert(sizeof...(T) > 0, "A frame needs at least one payload field");
+        return frame_serializer<frame, T...>(std::forward<T>(args)...);
+    }
+
+    template<typename Checksum, endianness Wire, std::uint16_t Sync>
+    inline std::optional<deserializer<Wire>> frame<Checksum, Wire, Sync>::open(const std::byte *data, std::size_t length) noexcept
+    {
+        const std::optional<std::size_t> total = size_of(data, length);
+        if (not total or *total > length) return std::nullopt;
+        const std::size_t payload = *total - overhead;
+        if constexpr (Checksum::size != 0) {
+            // length field and payload, in one pass, before any field is decoded
+            const auto expected = details::deserialize_value<Wire, checksum_value_type>(data + header_size + payload);
+            if (checksum_of<Checksum>(data + sizeof(std::uint16_t), sizeof(length_type) + payload) != expected)
+                return std::nullopt;
+        }
+        return flat::deserialize<Wire>(data + header_size, payload);
+    }
+
+    template<typename Checksum, endianness Wire, std::uint16_t Sync>
+    inline std::optional<deserializer<Wire>> frame<Checksum, Wire, Sync>::open(const std::uint8_t *data, std::size_t length) noexcept
+    {
+        return open(static_cast<const std::byte *>(static_cast<const void *>(data)), length);
+    }
+
+    template<typename Checksum, endianness Wire, std::uint16_t Sync>
+    inline std::optional<std::size_t> frame<Checksum, Wire, Sync>::size_of(const std::byte *data, std::size_t length) noexcept
+    {
+        if (length < header_size) return std::nullopt;
+        if (details::deserialize_value<Wire, std::uint16_t>(data) != Sync) return std::nullopt;
+        return overhead + details::deserialize_value<Wire, length_type>(data + sizeof(std::uint16_t));
+    }
+
+    template<typename Checksum, endianness Wire, std::uint16_t Sync>
+    template<typename Tuple, typename Source, std::enable_if_t<is_source_v<Source>, bool>>
+    inline std::optional<Tuple> frame<Checksum, Wire, Sync>::read(Source &source) noexcept
+    {
+        static_assert(internal::is_tuple_v<Tuple>, "frame::read decodes the payload as a std::tuple");
+        constexpr std::size_t payload = details::frame_payload_size<Tuple>::value;
+        static_assert(payload <= max_payload, "the payload does not fit the 16-bit length field of a frame");
+        if (source.available() < overhead + payload) return std::nullopt;
+
+        // The envelope words are read unobserved: only the payload is a message.
+        std::uint16_t word = 0;
+        details::deserialize_value_from<Wire>(source, word);
+        checksum_source<Checksum, Source> summed(source);
+        length_type announced = 0;
+        details::deserialize_value_from<Wire>(summed, announced);
+        if (word != Sync or announced != payload) return std::nullopt;
+
+        std::optional<Tuple> fields = flat::deserialize<Wire>(summed).template to<Tuple>();
+        if constexpr (Checksum::size != 0) {
+            checksum_value_type expected = 0;
+            details::deserialize_value_from<Wire>(source, expected);
+            if (expected != summed.value()) return std::nullopt;
+        }
+        return fields;
+    }
+
+    template<typename Frame, typename... T>
+    constexpr frame_serializer<Frame, T...>::frame_serializer(T &&...args)
+    : _payload_size(serialized_size(args...)), _payload(flat::serialize<Frame::wire>(std::forward<T>(args)...))
+    {
+    }
+
+    template<typename Frame, typename... T>
+    template<typename Sink, std::enable_if_t<is_sink_v<Sink>, bool>>
+    inline std::size_t frame_serializer<Frame, T...>::to(Sink &sink) &&
+    {
+        constexpr endianness Wire = Frame::wire;
+        const std::size_t total = Frame::overhead + _payload_size;
+        if (_payload_size > Frame::max_payload or total > sink.available()){
+            assert(false && "Sink has too little room for the frame, or the payload exceeds max_payload");
+            return 0;
+        }
+        // The envelope words are written unobserved: only the payload is a message.
+        details::serialize_value_to<Wire>(sink, std::uint16_t{Frame::sync});
+        checksum_sink<typename Frame::checksum_type, Sink> summed(sink);
+        details::serialize_value_to<Wire>(summed, static_cast<typename Frame::length_type>(_payload_size));
+        std::move(_payload).to(summed);
+        if constexpr (Frame::trailer_size != 0)
+            details::serialize_value_to<Wire>(sink, summed.value());
+        return total;
+    }
+
+    template<typename Frame, typename... T>
+    inline std::size_t frame_serializer<Frame, T...>::to(std::byte *buffer, std::size_t size) &&
+    {
+        span_sink out(buffer, size);
+        return std::move(*this).to(out);
+    }
+
+    template<typename Frame, typename... T>
+    template<std::size_t N>
+    inline std::size_t frame_serializer<Frame, T...>::to(std::byte (&buffer)[N]) &&
+    {
+        return std::move(*this).to(buffer, N);
+    }
+
+    template<typename Frame, typename... T>
+    inline std::size_t frame_serializer<Frame, T...>::to(std::uint8_t *buffer, std::size_t size) &&
+    {
+        return std::move(*this).to(static_cast<std::byte *>(static_cast<void *>(buffer)), size);
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_FRAME_TPP_
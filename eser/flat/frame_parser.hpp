@@ -0,0 +1,171 @@
+/**
+* @file frame_parser.hpp
+*
+* @ingroup eser_flat
+*
+* @brief Resumable parser that assembles `frame`s from bytes as they arrive.
+*
+* `deserializer::to` answers `std::nullopt` when a message is incomplete, and does not remember how
+* far it got. `frame_parser` is a small state machine for a byte stream (a UART ISR, an `epoll`
+* loop, a socket) that delivers 40 bytes now and 24 later. It keeps its state between `feed` calls,
+* copies each byte into its inline buffer exactly once, and updates the checksum as the bytes
+* arrive, so a completed frame is verified without another pass:
+*
+* ```cpp
+* using link = frame<crc16_ccitt, endianness::big>;
+* frame_parser<link, 256> parser;
+*
+* void on_receive(const std::byte *data, std::size_t n) {
+*     while (n != 0) {
+*         const std::size_t used = parser.feed(data, n);
+*         data += used, n -= used;
+*         if (auto m = parser.take<std::tuple<std::uint32_t, float>>()) handle(*m);
+*     }
+* }
+* ```
+*
+* ## Resynchronisation
+*
+* The parser hunts for the sync word, reads the length field, then collects the payload and the
+* checksum. A length above `MaxPayload` or a checksum mismatch drops the frame, and hunting resumes
+* with the next byte fed; bytes already consumed are never examined again. `discarded()` counts the
+* bytes dropped this way.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_FRAME_PARSER_HPP_
+#define ESER_FLAT_FRAME_PARSER_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include "../internal/byte.hpp"
+#include "deserializer.hpp"
+#include "frame.hpp"
+
+namespace eser::flat{
+    /**
+    * @class frame_parser
+    * @brief Assembles frames of one `frame` format from arbitrarily split input.
+    *
+    * @tparam Frame The `frame` specialization to parse.
+    * @tparam MaxPayload The longest payload accepted, in bytes; sizes the inline buffer.
+    *
+    * The parser holds one frame at a time. Once a frame is complete (`ready()`), `feed` consumes
+    * nothing until it is released with `take` or `release`, so the payload stays valid meanwhile.
+    */
+    template<typename Frame, std::size_t MaxPayload>
+    class frame_parser{
+        static_assert(MaxPayload > 0, "frame_parser MaxPayload must be strictly positive");
+        static_assert(MaxPayload <= Frame::max_payload, "frame_parser MaxPayload exceeds the frame length field");
+
+    public:
+        static constexpr endianness wire = Frame::wire;   ///< The byte order of the frames.
+
+        /**
+        * @brief A parser hunting for the first sync word.
+        */
+        constexpr frame_parser() noexcept;
+
+        /**
+        * @brief Consume input until a frame completes or the input runs out.
+        *
+        * @param data The next received bytes.
+        * @param n The number of bytes at `data`.
+        * @return The bytes consumed. Less than `n` when a frame completed part-way; feed the rest
+        *         after taking or releasing it. `0` while a completed frame is pending.
+        */
+        std::size_t feed(const std::byte *data, std::size_t n) noexcept;
+
+        /**
+        * @brief Consume input from a legacy `std::uint8_t` buffer.
+        * @see feed(const std::byte*, std::size_t)
+        */
+        std::size_t feed(const std::uint8_t *data, std::size_t n) noexcept;
+
+        /**
+        * @brief Whether a verified frame is waiting to be taken.
+        */
+        [[nodiscard]] constexpr bool ready() const noexcept;
+
+        /**
+        * @brief A deserializer over the payload of the pending frame.
+        * @return `std::nullopt` unless `ready()`.
+        * @warning The deserializer points into the parser and is invalidated by `release` / `take`.
+        */
+        [[nodiscard]] std::optional<deserializer<Frame::wire>> payload() const noexcept;
+
+        /**
+        * @brief Decode the pending frame as `Tuple` and release it.
+        *
+        * @tparam Tuple The message type, as for `deserializer::to`.
+        * @return The message, or `std::nullopt` if no frame is pending or the payload is too short
+        *         for `Tuple` (a pending frame is released either way).
+        */
+        template<typename Tuple>
+        [[nodiscard]] std::optional<Tuple> take() noexcept;
+
+        /**
+        * @brief Drop the pending frame, if any, and hunt for the next sync word.
+        */
+        void release() noexcept;
+
+        /**
+        * @brief Forget any partial frame and the `discarded()` count.
+        */
+        void reset() noexcept;
+
+        /**
+        * @brief Bytes dropped so far: noise before a sync word, and frames rejected for their
+        *        length or checksum.
+        */
+        [[nodiscard]] constexpr std::size_t discarded() const noexcept;
+
+    private:
+        /**
+        * @brief The parser states, in the order of the frame's fields.
+        */
+        enum class state : std::uint8_t { hunt, sync, length, body, ready };
+
+        using checksum = typename Frame::checksum_type;
+        using checksum_value = typename Frame::checksum_value_type;
+
+        static constexpr std::size_t sync_size = sizeof(std::uint16_t);
+        static constexpr std::size_t length_size = sizeof(typename Frame::length_type);
+
+        /**
+        * @brief The sync word's bytes in wire order.
+        */
+        static constexpr std::byte sync_byte(std::size_t i) noexcept;
+
+        /**
+        * @brief Check the completed frame's checksum; become `ready` or drop it.
+        */
+        void finish() noexcept;
+
+        /**
+        * @brief Drop the frame in progress (`bytes` long so far) and hunt again.
+        */
+        void drop(std::size_t bytes) noexcept;
+
+        std::byte _buffer[MaxPayload + Frame::trailer_size]; ///< Payload then checksum of the current frame.
+        std::byte _length_bytes[length_size];        ///< The length field, while it is being received.
+        std::size_t _length;                         ///< The payload length of the current frame.
+        std::size_t _received;                       ///< Bytes received of the current state's field.
+        std::size_t _discarded;                      ///< See `discarded()`.
+        checksum_value _crc;                         ///< Checksum register over length and payload.
+        state _state;                                ///< The field being received.
+    };
+} // namespace eser::flat
+
+#include "frame_parser.tpp"
+#endif // ESER_FLAT_FRAME_PARSER_HPP_
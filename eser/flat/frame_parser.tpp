@@ -0,0 +1,184 @@
+/**
+* @file frame_parser.tpp
+*
+* @brief Definition of functionality in frame_parser.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_FRAME_PARSER_TPP_
+#define ESER_FLAT_FRAME_PARSER_TPP_
+#include "frame_parser.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace eser::flat{
+    template<typename Frame, std::size_t MaxPayload>
+    constexpr frame_parser<Frame, MaxPayload>::frame_parser() noexcept
+    : _buffer{}, _length_bytes{}, _length(0), _received(0), _discarded(0), _crc(checksum::initial), _state(state::hunt)
+    {
+    }
+
+    template<typename Frame, std::size_t MaxPayload>
+    inline std::size_t frame_parser<Frame, MaxPayload>::feed(const std::byte *data, std::size_t n) noexcept
+    {
+        std::size_t i = 0;
+        while (i < n) {
+            switch (_state) {
+                case state::hunt: {
+                    // skip noise in bulk
+                    const void *hit = std::memchr(data + i, std::to_integer<int>(sync_byte(0)), n - i);
+                    if (hit == nullptr) {
+                        _discarded += n - i;
+                        return n;
+                    }
+                    const std::size_t at = static_cast<std::size_t>(static_cast<const std::byte *>(hit) - data);
+                    _discarded += at - i;
+                    i = at + 1;
+                    _state = state::sync;
+                    break;
+                }
+                case state::sync: {
+                    const std::byte b = data[i++];
+                    if (b == sync_byte(1)) {
+                        _received = 0;
+                        _state = state::length;
+                    } else if (b == sync_byte(0)) {
+                        _discarded += 1;   // the earlier byte was noise; this one may start the word
+                    } else {
+                        _discarded += sync_size;
+                        _state = state::hunt;
+                    }
+                    break;
+                }
+                case state::length: {
+                    _length_bytes[_received++] = data[i++];
+                    if (_received != length_size) break;
+                    _length = details::deserialize_value<wire, typename Frame::length_type>(_length_bytes);
+                    if (_length > MaxPayload) {
+                        drop(sync_size + length_size);
+                        break;
+                    }
+                    _crc = checksum::update(checksum::initial, _length_bytes, length_size);
+                    _received = 0;
+                    _state = state::body;
+                    if (_length + Frame::trailer_size == 0) {
+                        finish();
+                        return i;
+                    }
+                    break;
+                }
+                case state::body: {
+                    const std::size_t total = _length + Frame::trailer_size;
+                    const std::size_t count = std::min(n - i, total - _received);
+                    std::memcpy(_buffer + _received, data + i, count);
+                    if (_received < _length)
+                        _crc = checksum::update(_crc, _buffer + _received, std::min(count, _length - _received));
+                    _received += count;
+                    i += count;
+                    if (_received == total) {
+                        finish();
+                        if (_state == state::ready) return i;
+                    }
+                    break;
+                }
+                case state::ready:
+                    return i;
+            }
+        }
+        return i;
+    }
+
+    template<typename Frame, std::size_t MaxPayload>
+    inline std::size_t frame_parser<Frame, MaxPayload>::feed(const std::uint8_t *data, std::size_t n) noexcept
+    {
+        return feed(static_cast<const std::byte *>(static_cast<const void *>(data)), n);
+    }
+
+    template<typename Frame, std::size_t MaxPayload>
+    constexpr bool frame_parser<Frame, MaxPayload>::ready() const noexcept
+    {
+        return _state == state::ready;
+    }
+
+    template<typename Frame, std::size_t MaxPayload>
+    inline std::optional<deserializer<Frame::wire>> frame_parser<Frame, MaxPayload>::payload() const noexcept
+    {
+        if (_state != state::ready) return std::nullopt;
+        return flat::deserialize<wire>(_buffer, _length);
+    }
+
+    template<typename Frame, std::size_t MaxPayload>
+    template<typename Tuple>
+    inline std::optional<Tuple> frame_parser<Frame, MaxPayload>::take() noexcept
+    {
+        if (_state != state::ready) return std::nullopt;
+        std::optional<Tuple> message = flat::deserialize<wire>(_buffer, _length).template to<Tuple>();
+        release();
+        return message;
+    }
+
+    template<typename Frame, std::size_t MaxPayload>
+    inline void frame_parser<Frame, MaxPayload>::release() noexcept
+    {
+        if (_state != state::ready) return;
+        _received = 0;
+        _state = state::hunt;
+    }
+
+    template<typename Frame, std::size_t MaxPayload>
+    inline void frame_parser<Frame, MaxPayload>::reset() noexcept
+    {
+        _length = 0;
+        _received = 0;
+        _discarded = 0;
+        _crc = checksum::initial;
+        _state = state::hunt;
+    }
+
+    template<typename Frame, std::size_t MaxPayload>
+    constexpr std::size_t frame_parser<Frame, MaxPayload>::discarded() const noexcept
+    {
+        return _discarded;
+    }
+
+    template<typename Frame, std::size_t MaxPayload>
+    constexpr std::byte frame_parser<Frame, MaxPayload>::sync_byte(std::size_t i) noexcept
+    {
+        // the first wire byte is the low one on a little-endian wire, the high one on a big-endian wire
+        const bool high = (wire == endianness::big) == (i == 0);
+        return static_cast<std::byte>(high ? Frame::sync >> 8 : Frame::sync & 0xFFu);
+    }
+
+    template<typename Frame, std::size_t MaxPayload>
+    inline void frame_parser<Frame, MaxPayload>::finish() noexcept
+    {
+        if constexpr (Frame::trailer_size != 0) {
+            const auto expected = details::deserialize_value<wire, checksum_value>(_buffer + _length);
+            if (checksum::finalize(_crc) != expected) {
+                drop(Frame::overhead + _length);
+                return;
+            }
+        }
+        _state = state::ready;
+    }
+
+    template<typename Frame, std::size_t MaxPayload>
+    inline void frame_parser<Frame, MaxPayload>::drop(std::size_t bytes) noexcept
+    {
+        _discarded += bytes;
+        _received = 0;
+        _state = state::hunt;
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_FRAME_PARSER_TPP_
@@ -0,0 +1,147 @@
+/**
+* @file layout.hpp
+*
+* @ingroup eser_flat
+*
+* @brief Compile-time field offsets of a flat message, for random-access reads and in-place patches.
+*
+* The flat format is tagless and fixed-size, so the position of every field of a message
+* `T...` is a compile-time constant: field `I` starts at the sum of `serialized_size_of` of the
+* fields before it. `eser::flat::layout<T...>` exposes that table and uses it to decode or
+* re-encode a single field of an already-serialized buffer without touching the others:
+*
+* ```cpp
+* using header = layout<std::uint8_t, std::uint16_t, std::uint32_t>;   // type, length, sequence
+*
+* auto type = header::get<0>(packet);               // peek one byte
+* header::set<2, endianness::big>(packet, seq + 1); // patch the sequence number in place
+* ```
+*
+* The wire byte order only matters when a field is decoded or encoded, so it is a parameter of
+* `get` / `set`, not of the layout.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_LAYOUT_HPP_
+#define ESER_FLAT_LAYOUT_HPP_
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include "../internal/byte.hpp"
+#include "../internal/traits.hpp"
+#include "../utils/endianness.hpp"
+#include "size.hpp"
+
+namespace eser::flat{
+    using utils::endianness;
+
+    /**
+    * @class layout
+    * @brief The compile-time offset table of the flat message `T...`.
+    *
+    * A stateless type: every member is `static`. Offsets and sizes are `constexpr`; `get` and `set`
+    * read or write exactly one field at its offset.
+    *
+    * @tparam T... The message's field types, in wire order (as passed to `serialize(...)`).
+    *
+    * A bit group of consecutive `utils::bits` fields counts as one field of its packed size at the
+    * position of its first member; `get` / `set` cannot address the packed members themselves.
+    *
+    * @warning `get` / `set` do not bounds-check: the buffer must hold at least `size()` bytes (or
+    *          at least up to the end of the accessed field).
+    */
+    template<typename... T>
+    class layout{
+        static_assert(sizeof...(T) > 0, "A layout needs at least one field");
+        static_assert(details::is_fixed_size_v<T...>, "[eser] a layout needs fixed field offsets; bounded_vector / bounded_string fields have none");
+
+    public:
+        /**
+        * @brief The declared type of field `I` (cv/ref stripped; C-arrays kept as such).
+        * @tparam I The field index.
+        */
+        template<std::size_t I>
+        using field_t = std::remove_cv_t<std::remove_reference_t<internal::type_at_t<I, T...>>>;
+
+        /**
+        * @brief The value type `get<I>` returns and `set<I>` takes: `field_t<I>`, with C-arrays
+        *        mapped to the matching `std::array`.
+        * @tparam I The field index.
+        */
+        template<std::size_t I>
+        using value_t = internal::as_std_array_t<field_t<I>>;
+
+        /**
+        * @brief The number of fields.
+        * @return `sizeof...(T)`.
+        */
+        [[nodiscard]] static constexpr std::size_t field_count() noexcept;
+
+        /**
+        * @brief The total wire size of the message.
+        * @return `serialized_size_of<T...>()`.
+        */
+        [[nodiscard]] static constexpr std::size_t size() noexcept;
+
+        /**
+        * @brief The byte offset of field `I` from the start of the message.
+        * @tparam I The field index.
+        * @return The sum of the wire sizes of fields `0 .. I-1`.
+        */
+        template<std::size_t I>
+        [[nodiscard]] static constexpr std::size_t offset_of() noexcept;
+
+        /**
+        * @brief The wire size of field `I`.
+        * @tparam I The field index.
+        * @return `serialized_size_of<field_t<I>>()`.
+        */
+        template<std::size_t I>
+        [[nodiscard]] static constexpr std::size_t size_of() noexcept;
+
+        /**
+        * @brief Decode field `I` straight from a serialized message, skipping every other field.
+        *
+        * @tparam I The field index.
+        * @tparam Wire The byte order the message was written with (default `endianness::little`).
+        * @param data The first byte of the serialized message.
+        * @return The decoded field (a `bool` is normalized, like `to<bool>()`).
+        */
+        template<std::size_t I, endianness Wire = endianness::little>
+        [[nodiscard]] static value_t<I> get(const std::byte *data) noexcept;
+
+        /**
+        * @brief Re-encode field `I` of a serialized message in place, leaving every other byte as is.
+        *
+        * @tparam I The field index.
+        * @tparam Wire The byte order the message was written with (default `endianness::little`).
+        * @param data The first byte of the serialized message.
+        * @param value The new field value.
+        */
+        template<std::size_t I, endianness Wire = endianness::little>
+        static void set(std::byte *data, const value_t<I> &value) noexcept;
+
+    private:
+        /**
+        * @brief The wire size of every field, in order (a bit group is charged to its first field).
+        */
+        static constexpr std::array<std::size_t, sizeof...(T)> _sizes = [](){
+            std::array<std::size_t, sizeof...(T)> sizes{};
+            for (std::size_t i = 0; i < sizeof...(T); ++i) sizes[i] = details::bit_groups<T...>::wire_size(i);
+            return sizes;
+        }();
+    };
+} // namespace eser::flat
+
+#include "layout.tpp"
+#endif // ESER_FLAT_LAYOUT_HPP_
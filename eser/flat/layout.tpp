@@ -0,0 +1,77 @@
+/**
+* @file layout.tpp
+*
+* @brief Definition of functionality in layout.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+* - 2026-10-14
+* -     Bit groups of consecutive `utils::bits` fields are sized as one packed field.
+*/
+#ifndef ESER_FLAT_LAYOUT_TPP_
+#define ESER_FLAT_LAYOUT_TPP_
+#include "layout.hpp"
+#include "serializer.hpp"
+#include "deserializer.hpp"
+
+namespace eser::flat{
+    template<typename... T>
+    constexpr std::size_t layout<T...>::field_count() noexcept
+    {
+        return sizeof...(T);
+    }
+
+    template<typename... T>
+    constexpr std::size_t layout<T...>::size() noexcept
+    {
+        return serialized_size_of<T...>();
+    }
+
+    template<typename... T>
+    template<std::size_t I>
+    constexpr std::size_t layout<T...>::offset_of() noexcept
+    {
+        static_assert(I < sizeof...(T), "layout field index out of range");
+        std::size_t offset = 0;
+        for (std::size_t i = 0; i < I; ++i) offset += _sizes[i];
+        return offset;
+    }
+
+    template<typename... T>
+    template<std::size_t I>
+    constexpr std::size_t layout<T...>::size_of() noexcept
+    {
+        static_assert(I < sizeof...(T), "layout field index out of range");
+        return _sizes[I];
+    }
+
+    template<typename... T>
+    template<std::size_t I, endianness Wire>
+    inline typename layout<T...>::template value_t<I> layout<T...>::get(const std::byte *data) noexcept
+    {
+        static_assert(not details::bit_groups<T...>::packed(I), "layout::get cannot address a bit-packed field; read the message with deserialize()");
+        static_assert(sizeof(value_t<I>) == size_of<I>(), "layout::get requires a field whose wire size is its object size");
+        return details::deserialize_value<Wire, value_t<I>>(data + offset_of<I>());
+    }
+
+    template<typename... T>
+    template<std::size_t I, endianness Wire>
+    inline void layout<T...>::set(std::byte *data, const value_t<I> &value) noexcept
+    {
+        static_assert(not details::bit_groups<T...>::packed(I), "layout::set cannot address a bit-packed field; re-serialize the message");
+        std::byte *field = data + offset_of<I>();
+        std::size_t remaining = size_of<I>();
+        details::serialize_impl<Wire>(field, remaining, value);
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_LAYOUT_TPP_
@@ -0,0 +1,195 @@
+/**
+* @file message_queue.hpp
+*
+* @ingroup eser_flat
+*
+* @brief Bounded lock-free queues of serialized messages, written and read in place in their slots.
+*
+* Handing messages from producer threads to a network or logging thread usually means serializing
+* into a local buffer, taking a mutex and copying the bytes into a shared queue. `message_queue`
+* removes the copy and the mutex: a producer claims a slot, serializes straight into it and
+* publishes it; the consumer decodes straight out of the slot and releases it.
+*
+* ```cpp
+* using telemetry = std::tuple<std::uint32_t, float, float>;
+* static mpsc_queue<1024, std::uint32_t, float, float> queue;   // slots of serialized_size_of<...>()
+*
+* // any producer thread
+* if (not queue.try_push(serialize(t, lat, lon))) ++dropped;    // false when full
+*
+* // the consumer thread
+* while (auto m = queue.try_pop<telemetry>()) send(*m);
+* ```
+*
+* ## Variants
+*
+* - `queue_producers::single` (`spsc_queue`): one producer and one consumer thread. Each side owns
+*   one index and keeps a cached copy of the other's, so the shared cache lines are only touched
+*   when the cached view says the queue is full or empty.
+* - `queue_producers::multiple` (`mpsc_queue`): any number of producers and one consumer. Producers
+*   claim slots with a compare-and-swap on the write index; every slot carries a sequence number
+*   that says whose turn it is (D. Vyukov's bounded queue), so a slot being written never blocks
+*   slots claimed after it from being claimed, only from being read.
+*
+* Every index and every slot starts on its own 64-byte cache line, so threads on different cores
+* do not false-share. Nothing is allocated: the slots are a member array.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_MESSAGE_QUEUE_HPP_
+#define ESER_FLAT_MESSAGE_QUEUE_HPP_
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include "../internal/byte.hpp"
+#include "../internal/traits.hpp"
+#include "../utils/endianness.hpp"
+#include "deserializer.hpp"
+#include "serializer.hpp"
+#include "size.hpp"
+
+namespace eser::flat{
+    /**
+    * @enum queue_producers
+    * @brief How many threads may push into a @ref message_queue.
+    */
+    enum class queue_producers : std::uint8_t{
+        single,   ///< One producer thread (SPSC).
+        multiple  ///< Any number of producer threads (MPSC).
+    };
+
+    /**
+    * @class message_queue
+    * @brief A bounded, lock-free queue of `Capacity` slots of `SlotSize` bytes each.
+    *
+    * Exactly one thread may pop. With `queue_producers::single`, exactly one thread may push.
+    *
+    * @tparam Capacity The number of slots; a power of two.
+    * @tparam SlotSize The largest message, in bytes.
+    * @tparam Producers The producer variant.
+    */
+    template<std::size_t Capacity, std::size_t SlotSize, queue_producers Producers = queue_producers::single>
+    class message_queue{
+        static_assert(Capacity >= 2 and (Capacity & (Capacity - 1)) == 0, "message_queue Capacity must be a power of two, at least 2");
+        static_assert(SlotSize > 0, "message_queue SlotSize must be strictly positive");
+
+    public:
+        static constexpr std::size_t cache_line = 64;           ///< The alignment of indices and slots.
+        static constexpr std::size_t slot_size = SlotSize;      ///< The largest message, in bytes.
+        static constexpr queue_producers producers = Producers; ///< The producer variant.
+
+        /**
+        * @brief An empty queue.
+        */
+        message_queue() noexcept;
+
+        message_queue(const message_queue &) = delete;
+        message_queue &operator=(const message_queue &) = delete;
+
+        /**
+        * @brief The number of slots.
+        */
+        [[nodiscard]] static constexpr std::size_t capacity() noexcept;
+
+        /**
+        * @brief Serialize a message straight into the next free slot and publish it.
+        *
+        * ```cpp
+        * queue.try_push(serialize<endianness::big>(id, value));
+        * ```
+        *
+        * @param message The captured message, as returned by `serialize`.
+        * @return `false` if the queue is full (nothing is written), or if the message does not fit
+        *         in a slot (an `assert` fires in debug builds).
+        */
+        template<endianness Wire, typename... T>
+        bool try_push(serializer<Wire, T...> &&message);
+
+        /**
+        * @brief Let `write` fill the next free slot, then publish it.
+        *
+        * @tparam Writer Callable as `std::size_t(std::byte *slot, std::size_t slot_size)`, returning
+        *                the bytes written.
+        * @param write Called at most once, on the producer's thread, with the claimed slot.
+        * @return `false` if the queue is full (`write` is not called) or `write` returned 0. With
+        *         several producers a claimed slot cannot be given back: an empty slot is published
+        *         then, and the consumer skips it.
+        */
+        template<typename Writer>
+        bool try_write(Writer &&write);
+
+        /**
+        * @brief Let `read` see the oldest message in place, then release its slot.
+        *
+        * @tparam Reader Callable as `read(const std::byte *data, std::size_t size)`.
+        * @param read Called at most once, with the message's bytes; they are valid until it returns.
+        * @return `false` if no message is ready.
+        */
+        template<typename Reader>
+        bool try_pop(Reader &&read);
+
+        /**
+        * @brief Decode the oldest message as `Tuple` in place and release its slot.
+        *
+        * @tparam Tuple The message type, as for `deserializer::to`.
+        * @tparam Wire The byte order the message was serialized with.
+        * @return The message, or `std::nullopt` if none is ready or it is too short for `Tuple`
+        *         (its slot is released either way).
+        */
+        template<typename Tuple, endianness Wire = endianness::little>
+        [[nodiscard]] std::optional<Tuple> try_pop();
+
+        /**
+        * @brief Whether no message is ready. Exact on the consumer's thread when nothing is being
+        *        pushed; a snapshot otherwise.
+        */
+        [[nodiscard]] bool empty() const noexcept;
+
+    private:
+        /**
+        * @brief One message slot, on its own cache lines.
+        */
+        struct alignas(cache_line) slot{
+            std::atomic<std::size_t> sequence;  ///< The turn of the slot (multiple producers only).
+            std::size_t length;                 ///< The bytes written into `data`.
+            std::byte data[SlotSize];           ///< The serialized message.
+        };
+
+        /**
+        * @brief The slot a monotonically increasing index maps to.
+        */
+        slot &at(std::size_t index) noexcept;
+
+        alignas(cache_line) std::atomic<std::size_t> _tail; ///< The next index to push (shared by producers).
+        std::size_t _head_cache;                            ///< The producer's last view of `_head` (single producer only).
+        alignas(cache_line) std::atomic<std::size_t> _head; ///< The next index to pop (written by the consumer).
+        std::size_t _tail_cache;                            ///< The consumer's last view of `_tail` (single producer only).
+        slot _slots[Capacity];                              ///< The ring.
+    };
+
+    /**
+    * @brief A single-producer, single-consumer queue of `Capacity` messages with fields `T...`.
+    */
+    template<std::size_t Capacity, typename... T>
+    using spsc_queue = message_queue<Capacity, max_serialized_size_of<T...>(), queue_producers::single>;
+
+    /**
+    * @brief A multi-producer, single-consumer queue of `Capacity` messages with fields `T...`.
+    */
+    template<std::size_t Capacity, typename... T>
+    using mpsc_queue = message_queue<Capacity, max_serialized_size_of<T...>(), queue_producers::multiple>;
+} // namespace eser::flat
+
+#include "message_queue.tpp"
+#endif // ESER_FLAT_MESSAGE_QUEUE_HPP_
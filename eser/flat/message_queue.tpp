@@ -0,0 +1,145 @@
+/**
+* @file message_queue.tpp
+*
+* @brief Definition of functionality in message_queue.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_MESSAGE_QUEUE_TPP_
+#define ESER_FLAT_MESSAGE_QUEUE_TPP_
+#include "message_queue.hpp"
+#include <utility>
+
+namespace eser::flat{
+    template<std::size_t Capacity, std::size_t SlotSize, queue_producers Producers>
+    inline message_queue<Capacity, SlotSize, Producers>::message_queue() noexcept
+    : _tail(0), _head_cache(0), _head(0), _tail_cache(0)
+    {
+        for (std::size_t i = 0; i < Capacity; ++i) {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+            _slots[i].length = 0;
+        }
+    }
+
+    template<std::size_t Capacity, std::size_t SlotSize, queue_producers Producers>
+    constexpr std::size_t message_queue<Capacity, SlotSize, Producers>::capacity() noexcept
+    {
+        return Capacity;
+    }
+
+    template<std::size_t Capacity, std::size_t SlotSize, queue_producers Producers>
+    template<endianness Wire, typename... T>
+    inline bool message_queue<Capacity, SlotSize, Producers>::try_push(serializer<Wire, T...> &&message)
+    {
+        return try_write([&message](std::byte *data, std::size_t size){
+            return std::move(message).to(data, size);
+        });
+    }
+
+    template<std::size_t Capacity, std::size_t SlotSize, queue_producers Producers>
+    template<typename Writer>
+    inline bool message_queue<Capacity, SlotSize, Producers>::try_write(Writer &&write)
+    {
+        if constexpr (Producers == queue_producers::single) {
+            const std::size_t tail = _tail.load(std::memory_order_relaxed);
+            if (tail - _head_cache == Capacity) {
+                // looks full: refresh the cached head, the only read of the consumer's line
+                _head_cache = _head.load(std::memory_order_acquire);
+                if (tail - _head_cache == Capacity) return false;
+            }
+            slot &s = at(tail);
+            const std::size_t length = write(s.data, SlotSize);
+            if (length == 0) return false;
+            s.length = length;
+            _tail.store(tail + 1, std::memory_order_release);
+            return true;
+        } else {
+            std::size_t tail = _tail.load(std::memory_order_relaxed);
+            slot *s;
+            for (;;) {
+                s = &at(tail);
+                const std::size_t sequence = s->sequence.load(std::memory_order_acquire);
+                const auto turn = static_cast<std::ptrdiff_t>(sequence - tail);
+                if (turn == 0) {
+                    if (_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) break;
+                } else if (turn < 0) {
+                    return false;   // the slot still holds a message from the previous lap: full
+                } else {
+                    tail = _tail.load(std::memory_order_relaxed);
+                }
+            }
+            const std::size_t length = write(s->data, SlotSize);
+            s->length = length;
+            s->sequence.store(tail + 1, std::memory_order_release);
+            return length != 0;
+        }
+    }
+
+    template<std::size_t Capacity, std::size_t SlotSize, queue_producers Producers>
+    template<typename Reader>
+    inline bool message_queue<Capacity, SlotSize, Producers>::try_pop(Reader &&read)
+    {
+        if constexpr (Producers == queue_producers::single) {
+            const std::size_t head = _head.load(std::memory_order_relaxed);
+            if (head == _tail_cache) {
+                _tail_cache = _tail.load(std::memory_order_acquire);
+                if (head == _tail_cache) return false;
+            }
+            const slot &s = at(head);
+            read(static_cast<const std::byte *>(s.data), s.length);
+            _head.store(head + 1, std::memory_order_release);
+            return true;
+        } else {
+            for (;;) {
+                const std::size_t head = _head.load(std::memory_order_relaxed);
+                slot &s = at(head);
+                if (s.sequence.load(std::memory_order_acquire) != head + 1) return false;
+                const std::size_t length = s.length;
+                if (length != 0) read(static_cast<const std::byte *>(s.data), length);
+                // hand the slot to the producer of the next lap
+                s.sequence.store(head + Capacity, std::memory_order_release);
+                _head.store(head + 1, std::memory_order_relaxed);
+                if (length != 0) return true;
+            }
+        }
+    }
+
+    template<std::size_t Capacity, std::size_t SlotSize, queue_producers Producers>
+    template<typename Tuple, endianness Wire>
+    inline std::optional<Tuple> message_queue<Capacity, SlotSize, Producers>::try_pop()
+    {
+        std::optional<Tuple> message;
+        try_pop([&message](const std::byte *data, std::size_t size){
+            message = flat::deserialize<Wire>(data, size).template to<Tuple>();
+        });
+        return message;
+    }
+
+    template<std::size_t Capacity, std::size_t SlotSize, queue_producers Producers>
+    inline bool message_queue<Capacity, SlotSize, Producers>::empty() const noexcept
+    {
+        const std::size_t head = _head.load(std::memory_order_acquire);
+        if constexpr (Producers == queue_producers::single)
+            return head == _tail.load(std::memory_order_acquire);
+        else
+            return _slots[head & (Capacity - 1)].sequence.load(std::memory_order_acquire) != head + 1;
+    }
+
+    template<std::size_t Capacity, std::size_t SlotSize, queue_producers Producers>
+    inline typename message_queue<Capacity, SlotSize, Producers>::slot &message_queue<Capacity, SlotSize, Producers>::at(std::size_t index) noexcept
+    {
+        return _slots[index & (Capacity - 1)];
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_MESSAGE_QUEUE_TPP_
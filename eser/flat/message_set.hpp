@@ -0,0 +1,212 @@
+/**
+* @file message_set.hpp
+*
+* @ingroup eser_flat
+*
+* @brief Compile-time registry of message types keyed by an id prefix, dispatched through a dense
+*        jump table.
+*
+* A stream carrying several message types usually prefixes each message with an id. Instead of
+* reading the id and switching over dozens of `to<std::tuple<...>>()` calls, name the messages once:
+*
+* ```cpp
+* using ping      = message_type<0x01, std::uint32_t>;                 // sequence
+* using telemetry = message_type<0x02, std::uint32_t, float, float>;   // timestamp, lat, lon
+* using shutdown  = message_type<0x07>;                                // no payload
+* using protocol  = message_set<std::uint8_t, ping, telemetry, shutdown>;
+*
+* struct handler{
+*     void operator()(ping, std::uint32_t seq);
+*     void operator()(telemetry, std::uint32_t t, float lat, float lon);
+*     void operator()(shutdown);
+* };
+*
+* std::size_t used = protocol::dispatch(buffer, length, handler{});   // 0: unknown id or short buffer
+* ```
+*
+* The set builds one table per handler type at compile time, indexed by `id - min_id`. Each entry
+* holds the message size (from `serialized_size_of`) and a plain function pointer that decodes the
+* payload and calls the handler, so dispatch is one bounds check, one size check and one indirect
+* call: no heap, no virtual functions, no search.
+*
+* Writers need nothing new: `serialize<Wire>(std::uint8_t{ping::id}, seq)` produces a message the
+* set dispatches.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_MESSAGE_SET_HPP_
+#define ESER_FLAT_MESSAGE_SET_HPP_
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include "../internal/byte.hpp"
+#include "../utils/endianness.hpp"
+#include "deserializer.hpp"
+#include "size.hpp"
+
+namespace eser::flat{
+    namespace details{
+        /**
+        * @brief The wire size of a message with fields `T...`; 0 for a message without fields.
+        */
+        template<typename... T>
+        constexpr std::size_t message_payload_size() noexcept;
+    } // namespace details
+
+    /**
+    * @struct message_type
+    * @brief One entry of a @ref message_set: an id and the message's field types.
+    *
+    * Also the tag passed as the first argument to the handler, so that messages with the same
+    * field types stay distinguishable.
+    *
+    * @tparam Id The message id (an integer or enumerator, converted to the set's id type).
+    * @tparam T... The payload field types, in wire order; fixed-size only.
+    */
+    template<auto Id, typename... T>
+    struct message_type{
+        static_assert(details::is_fixed_size_v<T...>,
+            "[eser] message_set dispatch needs a fixed size per id; bounded_vector / bounded_string fields have none");
+
+        static constexpr auto id = Id;                                               ///< The message id.
+        static constexpr std::size_t size = details::message_payload_size<T...>();   ///< Payload bytes.
+        using tuple_type = std::tuple<T...>;                                         ///< The decoded payload.
+    };
+
+    /**
+    * @class message_set
+    * @brief Dispatches id-prefixed messages to a handler through a compile-time jump table.
+    *
+    * All members are static; the class is never instantiated.
+    *
+    * @tparam Id The wire type of the id prefix: an unsigned integer, or an enum with an unsigned
+    *            underlying type.
+    * @tparam Messages... The @ref message_type entries; ids must be unique and span at most
+    *                     `max_span` values.
+    */
+    template<typename Id, typename... Messages>
+    class message_set{
+    public:
+        using id_type = Id;                                          ///< The id prefix type.
+
+        static constexpr std::size_t max_span = 256;                 ///< The largest table (`max_id - min_id + 1`).
+
+    private:
+        using key_type = std::conditional_t<std::is_enum_v<Id>, std::underlying_type<Id>, std::common_type<Id>>;
+        using key_t = typename key_type::type;
+
+        static_assert(sizeof...(Messages) > 0, "A message_set needs at least one message");
+        static_assert(std::is_unsigned_v<key_t>, "message_set ids must be unsigned integers or enums with an unsigned underlying type");
+
+        /**
+        * @brief The numeric id of `Message`, as the set's id type.
+        */
+        template<typename Message>
+        static constexpr key_t key_of() noexcept;
+
+        /**
+        * @brief Whether every message id is distinct.
+        */
+        static constexpr bool unique_ids() noexcept;
+
+    public:
+        static constexpr id_type min_id = static_cast<id_type>(std::min({key_of<Messages>()...}));  ///< The smallest id.
+        static constexpr id_type max_id = static_cast<id_type>(std::max({key_of<Messages>()...}));  ///< The largest id.
+        static constexpr std::size_t max_size = sizeof(id_type) + std::max({Messages::size...});    ///< The longest message, id included.
+
+    private:
+        static constexpr std::size_t span = static_cast<std::size_t>(key_t(max_id) - key_t(min_id)) + 1;
+
+        static_assert(unique_ids(), "message_set ids must be unique");
+        static_assert(span <= max_span, "message_set ids are too sparse for a dense jump table");
+
+    public:
+        /**
+        * @brief Whether `id` names a message of the set.
+        */
+        [[nodiscard]] static constexpr bool contains(id_type id) noexcept;
+
+        /**
+        * @brief The wire size of the message `id`, id prefix included.
+        * @return The size, or `0` if the set has no such message.
+        */
+        [[nodiscard]] static constexpr std::size_t size_of(id_type id) noexcept;
+
+        /**
+        * @brief Decode the message at the start of a buffer and pass it to `handler`.
+        *
+        * Reads the id prefix, looks it up in the jump table, checks that the buffer holds the
+        * whole message, then calls `handler(Message{}, fields...)`.
+        *
+        * @tparam Wire The byte order of the id and the payload (default `endianness::little`).
+        * @tparam Handler A callable accepting every message of the set; its result is ignored.
+        * @param data The id prefix of the message.
+        * @param length The bytes available at `data`; bytes after the message are ignored.
+        * @param handler The handler.
+        * @return The bytes consumed (id and payload), or `0` if the buffer is shorter than the id or
+        *         the message, or the id is unknown; the handler is not called then.
+        */
+        template<endianness Wire = endianness::little, typename Handler>
+        static std::size_t dispatch(const std::byte *data, std::size_t length, Handler &&handler);
+
+        /**
+        * @brief Dispatch the message at the start of a legacy `std::uint8_t` buffer.
+        * @see dispatch(const std::byte*, std::size_t, Handler&&)
+        */
+        template<endianness Wire = endianness::little, typename Handler>
+        static std::size_t dispatch(const std::uint8_t *data, std::size_t length, Handler &&handler);
+
+        message_set() = delete;
+
+    private:
+        /**
+        * @brief One jump table slot: the whole message size and its decoder; both zero for an
+        *        unused id.
+        */
+        template<typename Handler>
+        struct entry{
+            std::size_t size;                                ///< Id and payload bytes.
+            void (*invoke)(const std::byte *, Handler &);    ///< Decodes the payload and calls the handler.
+        };
+
+        /**
+        * @brief Decode the payload of `Message` and call the handler with it.
+        */
+        template<endianness Wire, typename Message, typename Handler>
+        static void invoke(const std::byte *payload, Handler &handler);
+
+        /**
+        * @brief The slot of `id` in the jump table.
+        */
+        static constexpr std::size_t index_of(key_t id) noexcept;
+
+        /**
+        * @brief Build the jump table for one byte order and handler type.
+        */
+        template<endianness Wire, typename Handler>
+        static constexpr std::array<entry<Handler>, span> make_table() noexcept;
+
+        template<endianness Wire, typename Handler>
+        static constexpr std::array<entry<Handler>, span> table = make_table<Wire, Handler>();  ///< The jump table.
+
+        static constexpr std::array<std::size_t, span> make_sizes() noexcept;
+
+        static constexpr std::array<std::size_t, span> sizes = make_sizes();  ///< Message sizes by slot; 0 if unused.
+    };
+} // namespace eser::flat
+
+#include "message_set.tpp"
+#endif // ESER_FLAT_MESSAGE_SET_HPP_
@@ -0,0 +1,129 @@
+/**
+* @file message_set.tpp
+*
+* @brief Definition of functionality in message_set.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_MESSAGE_SET_TPP_
+#define ESER_FLAT_MESSAGE_SET_TPP_
+#include "message_set.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace eser::flat{
+    namespace details{
+        template<typename... T>
+        constexpr std::size_t message_payload_size() noexcept
+        {
+            if constexpr (sizeof...(T) == 0)
+                return 0;
+            else
+                return serialized_size_of<T...>();
+        }
+    } // namespace details
+
+    template<typename Id, typename... Messages>
+    template<typename Message>
+    constexpr typename message_set<Id, Messages...>::key_t message_set<Id, Messages...>::key_of() noexcept
+    {
+        static_assert(static_cast<decltype(Message::id)>(static_cast<Id>(Message::id)) == Message::id,
+            "message id does not fit the message_set id type");
+        return static_cast<key_t>(static_cast<Id>(Message::id));
+    }
+
+    template<typename Id, typename... Messages>
+    constexpr bool message_set<Id, Messages...>::unique_ids() noexcept
+    {
+        const key_t ids[] = {key_of<Messages>()...};
+        for (std::size_t i = 0; i < sizeof...(Messages); ++i)
+            for (std::size_t j = i + 1; j < sizeof...(Messages); ++j)
+                if (ids[i] == ids[j]) return false;
+        return true;
+    }
+
+    template<typename Id, typename... Messages>
+    constexpr std::size_t message_set<Id, Messages...>::index_of(key_t id) noexcept
+    {
+        return static_cast<std::size_t>(id - static_cast<key_t>(min_id));
+    }
+
+    template<typename Id, typename... Messages>
+    constexpr bool message_set<Id, Messages...>::contains(id_type id) noexcept
+    {
+        return size_of(id) != 0;
+    }
+
+    template<typename Id, typename... Messages>
+    constexpr std::size_t message_set<Id, Messages...>::size_of(id_type id) noexcept
+    {
+        const key_t key = static_cast<key_t>(id);
+        if (key < static_cast<key_t>(min_id) or key > static_cast<key_t>(max_id)) return 0;
+        return sizes[index_of(key)];
+    }
+
+    template<typename Id, typename... Messages>
+    template<endianness Wire, typename Handler>
+    inline std::size_t message_set<Id, Messages...>::dispatch(const std::byte *data, std::size_t length, Handler &&handler)
+    {
+        using handler_type = std::remove_reference_t<Handler>;
+        if (length < sizeof(id_type)) return 0;
+        const key_t key = static_cast<key_t>(details::deserialize_value<Wire, id_type>(data));
+        if (key < static_cast<key_t>(min_id) or key > static_cast<key_t>(max_id)) return 0;
+        const entry<handler_type> &slot = table<Wire, handler_type>[index_of(key)];
+        if (slot.invoke == nullptr or length < slot.size) return 0;
+        slot.invoke(data + sizeof(id_type), handler);
+        return slot.size;
+    }
+
+    template<typename Id, typename... Messages>
+    template<endianness Wire, typename Handler>
+    inline std::size_t message_set<Id, Messages...>::dispatch(const std::uint8_t *data, std::size_t length, Handler &&handler)
+    {
+        return dispatch<Wire>(static_cast<const std::byte *>(static_cast<const void *>(data)), length, std::forward<Handler>(handler));
+    }
+
+    template<typename Id, typename... Messages>
+    template<endianness Wire, typename Message, typename Handler>
+    inline void message_set<Id, Messages...>::invoke(const std::byte *payload, Handler &handler)
+    {
+        if constexpr (Message::size == 0) {
+            (void)payload;
+            handler(Message{});
+        } else {
+            // the size was checked against the table; the decode cannot fail
+            auto fields = flat::deserialize<Wire>(payload, Message::size).template to<typename Message::tuple_type>();
+            std::apply([&handler](auto &&...values) { handler(Message{}, std::move(values)...); }, std::move(*fields));
+        }
+    }
+
+    template<typename Id, typename... Messages>
+    template<endianness Wire, typename Handler>
+    constexpr std::array<typename message_set<Id, Messages...>::template entry<Handler>, message_set<Id, Messages...>::span>
+    message_set<Id, Messages...>::make_table() noexcept
+    {
+        std::array<entry<Handler>, span> slots{};
+        ((slots[index_of(key_of<Messages>())] = entry<Handler>{sizeof(id_type) + Messages::size, &invoke<Wire, Messages, Handler>}), ...);
+        return slots;
+    }
+
+    template<typename Id, typename... Messages>
+    constexpr std::array<std::size_t, message_set<Id, Messages...>::span> message_set<Id, Messages...>::make_sizes() noexcept
+    {
+        std::array<std::size_t, span> slots{};
+        ((slots[index_of(key_of<Messages>())] = sizeof(id_type) + Messages::size), ...);
+        return slots;
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_MESSAGE_SET_TPP_
@@ -0,0 +1,140 @@
+/**
+* @file observer.hpp
+*
+* @ingroup eser_flat
+*
+* @brief The observer policy: compile-time hooks that `serializer::to` and `deserializer::to`
+*        report every message to, for byte counters, failure counters and latency histograms.
+*
+* An observer is a type with these static members:
+*
+* | Member | Meaning |
+* |---|---|
+* | `stamp` | what `start()` returns, e.g. a cycle count; an empty struct costs nothing |
+* | `static stamp start()` | called when a `to` begins |
+* | `template<typename Message> static void encoded(const stamp &, std::size_t bytes)` | called when `serializer::to` returns `bytes` |
+* | `template<typename Message> static void decoded(const stamp &, std::size_t bytes)` | called when `deserializer::to` returns, having consumed `bytes` |
+*
+* `bytes` is 0 exactly when the call failed (`to` returned 0, or `std::nullopt`), so an observer
+* can count failures without the library branching for it. `Message` names the message the same
+* way on both sides: `serialize(a, b)` reports `std::tuple<A, B>`, the type it is read back as with
+* `to<std::tuple<A, B>>()`; `serialize(x)` and `to<X>()` both report `X` (a C-array reports the
+* matching `std::array`). Reads from a source (`stream_deserializer::to`) report like buffer reads,
+* and a `frame` reports only its payload: the envelope words are not messages.
+*
+* The observer is chosen once per program. By default it is @ref null_observer, whose hooks are
+* empty and inline: the generated code is the same as without hooks. Define `ESER_OBSERVER` to
+* another type, declared before the first eser include, to plug one in:
+*
+* ```cpp
+* // metrics.hpp, force-included (or included first) with -DESER_OBSERVER=metrics
+* struct metrics {
+*     using stamp = std::uint64_t;
+*     static stamp start() noexcept { return __rdtsc(); }
+*     template<typename Message> static void encoded(stamp t0, std::size_t bytes) noexcept {
+*         counters<Message>.bytes.fetch_add(bytes, std::memory_order_relaxed);
+*         counters<Message>.failures.fetch_add(bytes == 0, std::memory_order_relaxed);
+*         counters<Message>.cycles.record(__rdtsc() - t0);
+*     }
+*     template<typename Message> static void decoded(stamp t0, std::size_t bytes) noexcept;
+* };
+* ```
+*
+* `ESER_OBSERVER` must name the same type in every translation unit of a program: `to` is an
+* inline template, and two definitions of it that report to different observers break the
+* one-definition rule. Set it on the compiler command line.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_OBSERVER_HPP_
+#define ESER_FLAT_OBSERVER_HPP_
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include "../internal/traits.hpp"
+
+namespace eser::flat{
+    /**
+    * @struct null_observer
+    * @brief The default observer: every hook is empty, so observing costs nothing.
+    */
+    struct null_observer{
+        /**
+        * @brief An empty start stamp.
+        */
+        struct stamp{};
+
+        /**
+        * @brief Nothing to record at the start of a call.
+        */
+        static constexpr stamp start() noexcept;
+
+        /**
+        * @brief Ignores an encode.
+        */
+        template<typename Message>
+        static constexpr void encoded(const stamp &start, std::size_t bytes) noexcept;
+
+        /**
+        * @brief Ignores a decode.
+        */
+        template<typename Message>
+        static constexpr void decoded(const stamp &start, std::size_t bytes) noexcept;
+    };
+
+#if defined(ESER_OBSERVER)
+    using active_observer = ESER_OBSERVER;  ///< The observer `to` reports to (see `ESER_OBSERVER`).
+#else
+    using active_observer = null_observer;  ///< The observer `to` reports to (see `ESER_OBSERVER`).
+#endif
+
+    namespace details{
+        /**
+        * @brief The type a message of values `T...` is reported as: the value itself for one value,
+        *        a tuple of them otherwise; references and cv-qualifiers dropped, C-arrays as `std::array`.
+        */
+        template<typename... T>
+        struct observed_message{
+            using type = std::tuple<internal::as_std_array_t<std::remove_cv_t<std::remove_reference_t<T>>>...>; ///< The message type.
+        };
+
+        /**
+        * @brief Specialization of `observed_message` for a single value.
+        */
+        template<typename T>
+        struct observed_message<T>{
+            using type = internal::as_std_array_t<std::remove_cv_t<std::remove_reference_t<T>>>; ///< The message type.
+        };
+
+        /**
+        * @brief Helper alias for `observed_message<T...>::type`.
+        */
+        template<typename... T>
+        using observed_message_t = typename observed_message<T...>::type;
+
+        /**
+        * @brief Report an encode of `bytes` bytes (0 on failure) and pass `bytes` through.
+        */
+        template<typename Message, typename Stamp>
+        std::size_t report_encoded(const Stamp &start, std::size_t bytes) noexcept;
+
+        /**
+        * @brief Report a decode that consumed `bytes` bytes (0 on failure).
+        */
+        template<typename Message, typename Stamp>
+        void report_decoded(const Stamp &start, std::size_t bytes) noexcept;
+    } // namespace details
+} // namespace eser::flat
+
+#include "observer.tpp"
+#endif // ESER_FLAT_OBSERVER_HPP_
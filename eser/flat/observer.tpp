@@ -0,0 +1,54 @@
+/**
+* @file observer.tpp
+*
+* @brief Definition of functionality in observer.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_OBSERVER_TPP_
+#define ESER_FLAT_OBSERVER_TPP_
+#include "observer.hpp"
+
+namespace eser::flat{
+    constexpr null_observer::stamp null_observer::start() noexcept
+    {
+        return {};
+    }
+
+    template<typename Message>
+    constexpr void null_observer::encoded(const stamp &, std::size_t) noexcept
+    {
+    }
+
+    template<typename Message>
+    constexpr void null_observer::decoded(const stamp &, std::size_t) noexcept
+    {
+    }
+
+    namespace details{
+        template<typename Message, typename Stamp>
+        inline std::size_t report_encoded(const Stamp &start, std::size_t bytes) noexcept
+        {
+            active_observer::template encoded<Message>(start, bytes);
+            return bytes;
+        }
+
+        template<typename Message, typename Stamp>
+        inline void report_decoded(const Stamp &start, std::size_t bytes) noexcept
+        {
+            active_observer::template decoded<Message>(start, bytes);
+        }
+    } // namespace details
+} // namespace eser::flat
+
+#endif // ESER_FLAT_OBSERVER_TPP_
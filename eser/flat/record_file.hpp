@@ -0,0 +1,381 @@
+/**
+* @file record_file.hpp
+*
+* @ingroup eser_flat
+*
+* @brief A self-describing file format for many fixed-layout records, in row or column order,
+*        appended one record at a time and read in place from a memory mapping.
+*
+* `serialize(...).to()` lays records out one after another, so scanning one field across a million
+* records still pulls every byte of every record through the cache. `record_file` keeps the same
+* wire encoding but can also store the records column by column: every value of field 0, then every
+* value of field 1, and so on. A scan over one field is then one sequential pass over one contiguous
+* column, which the hardware prefetcher follows without help.
+*
+* ```cpp
+* using ticks = record_file<record_format::columns, endianness::little,
+*                           std::uint64_t, float, std::uint32_t>;   // timestamp, price, volume
+*
+* // write: size the file, map it, append
+* const std::size_t bytes = ticks::size_for(1'000'000);
+* ftruncate(fd, bytes);
+* auto *map = static_cast<std::byte *>(mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0));
+* auto writer = ticks::create(map, bytes, 1'000'000);
+* writer->append(t, price, volume);                                 // false once full
+*
+* // read: map it read-only and scan one column, zero-copy
+* auto reader = ticks::open(map, bytes);                            // nullopt on a foreign header
+* double total = 0;
+* for (float price : reader->column<1>()) total += price;
+* ```
+*
+* ## File layout
+*
+* | Offset | Size | Content |
+* |---|---|---|
+* | 0 | 4 | magic `"ESRF"` |
+* | 4 | 1 | format version (2) |
+* | 5 | 1 | `record_format` |
+* | 6 | 1 | wire `endianness` of the records |
+* | 7 | 1 | field count |
+* | 8 | 4 | record size in bytes (`serialized_size_of<T...>()`) |
+* | 12 | 4 | `schema_fingerprint_v<Wire, T...>` of the records |
+* | 16 | 8 | capacity, in records |
+* | 24 | 8 | count of records written |
+* | 64 | ... | the records |
+*
+* The header is always little-endian; the records follow `Wire`. Rows are `record_size` bytes
+* each, exactly what `serialize<Wire>(fields...)` writes. Each column is `capacity` values of one
+* field, and starts on a 64-byte boundary of the file, so a page-aligned mapping puts every column
+* on a cache-line boundary.
+*
+* The count is updated in the header after every append, so a reader of a file that is still being
+* written sees whole records only (on one thread; across processes the usual `msync` rules apply).
+* The caller owns the mapping: the classes here only ever see a pointer and a size.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+* - 2026-10-14
+* -     Version 2: the reserved header word holds the schema fingerprint, and `open` / `resume`
+*       reject a file written with another field list of the same size.
+*/
+#ifndef ESER_FLAT_RECORD_FILE_HPP_
+#define ESER_FLAT_RECORD_FILE_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <tuple>
+#include <utility>
+#include "../internal/byte.hpp"
+#include "../internal/traits.hpp"
+#include "../utils/endianness.hpp"
+#include "deserializer.hpp"
+#include "layout.hpp"
+#include "fingerprint.hpp"
+#include "serializer.hpp"
+#include "size.hpp"
+
+namespace eser::flat{
+    /**
+    * @enum record_format
+    * @brief The order in which a @ref record_file stores its records.
+    */
+    enum class record_format : std::uint8_t{
+        rows,    ///< One record after another, as `serialize` writes them.
+        columns  ///< One field after another, each a contiguous column.
+    };
+
+    template<typename File>
+    class record_writer;
+
+    template<typename File>
+    class record_reader;
+
+    /**
+    * @class column_view
+    * @brief A zero-copy, read-only view of one field across the records of a @ref record_file.
+    *
+    * Values are decoded (and byte-swapped when `Wire` differs from the host) on access, like
+    * @ref field_view. The stride between values is a compile-time constant: the field size in a
+    * columnar file, the record size in a row file.
+    *
+    * @tparam Wire The byte order of the records.
+    * @tparam V The field's value type.
+    * @tparam Stride The distance in bytes between consecutive values.
+    *
+    * @warning The view does not own the bytes: it must not outlive the mapping.
+    */
+    template<endianness Wire, typename V, std::size_t Stride>
+    class column_view{
+    public:
+        using value_type = V;                     ///< The decoded value type.
+        static constexpr std::size_t stride = Stride; ///< Bytes from one value to the next.
+
+        /**
+        * @class iterator
+        * @brief A forward iterator decoding one value per dereference.
+        */
+        class iterator{
+        public:
+            using iterator_category = std::forward_iterator_tag; ///< Iterator tag.
+            using value_type = V;                                ///< The decoded value type.
+            using difference_type = std::ptrdiff_t;              ///< Distance type.
+            using pointer = void;                                ///< Values are decoded, not referenced.
+            using reference = V;                                 ///< Dereferencing yields a value.
+
+            constexpr iterator() noexcept = default;
+            [[nodiscard]] V operator*() const noexcept;                   ///< Decode the current value.
+            constexpr iterator &operator++() noexcept;                    ///< Step to the next value.
+            constexpr iterator operator++(int) noexcept;                  ///< Step, returning the old position.
+            [[nodiscard]] constexpr bool operator==(const iterator &other) const noexcept; ///< Same position.
+            [[nodiscard]] constexpr bool operator!=(const iterator &other) const noexcept; ///< Different position.
+
+        private:
+            const std::byte *_data = nullptr; ///< The current value's wire bytes.
+
+            constexpr explicit iterator(const std::byte *data) noexcept;
+
+            friend class column_view;
+        };
+
+        /**
+        * @brief The number of values (records written).
+        */
+        [[nodiscard]] constexpr std::size_t size() const noexcept;
+
+        /**
+        * @brief Whether the view holds no values.
+        */
+        [[nodiscard]] constexpr bool empty() const noexcept;
+
+        /**
+        * @brief Decode value `index`.
+        * @param index The record index; must be `< size()` (checked by `assert` in debug builds).
+        */
+        [[nodiscard]] V operator[](std::size_t index) const noexcept;
+
+        /**
+        * @brief Bounds-checked access to value `index`.
+        * @return `std::nullopt` if `index >= size()`.
+        */
+        [[nodiscard]] std::optional<V> at(std::size_t index) const noexcept;
+
+        /**
+        * @brief The wire bytes of the first value, in place.
+        */
+        [[nodiscard]] constexpr const std::byte *data() const noexcept;
+
+        [[nodiscard]] constexpr iterator begin() const noexcept; ///< The first value.
+        [[nodiscard]] constexpr iterator end() const noexcept;   ///< One past the last value.
+
+    private:
+        const std::byte *_data; ///< The first value's wire bytes (not owned).
+        std::size_t _size;      ///< The number of values.
+
+        constexpr column_view(const std::byte *data, std::size_t size) noexcept;
+
+        template<typename File>
+        friend class record_reader;
+    };
+
+    /**
+    * @class record_file
+    * @brief The record file policy: layout arithmetic, and the factories for writers and readers.
+    *
+    * All members are static; the class is never instantiated.
+    *
+    * @tparam Format Row or column order.
+    * @tparam Wire The byte order of the records.
+    * @tparam T... The field types of one record, in order; fixed-size and not bit-packed.
+    */
+    template<record_format Format, endianness Wire, typename... T>
+    class record_file{
+        static_assert(sizeof...(T) > 0, "A record needs at least one field");
+        static_assert(sizeof...(T) <= 0xFF, "A record file holds at most 255 fields");
+        static_assert(details::is_fixed_size_v<T...>, "record_file fields must be fixed-size (no bounded<> fields)");
+        static_assert(not details::bit_groups<T...>::any(), "record_file fields cannot be bit-packed; columns are addressed per field");
+
+    public:
+        using layout_type = layout<T...>;                    ///< Offsets within one row.
+
+        template<std::size_t I>
+        using value_t = typename layout_type::template value_t<I>; ///< The value type of field `I`.
+
+        /**
+        * @brief The type of `column<I>()` on a reader of this file.
+        */
+        template<std::size_t I>
+        using column_t = column_view<Wire, value_t<I>,
+            Format == record_format::rows ? layout_type::size() : layout_type::template size_of<I>()>;
+
+        static constexpr record_format format = Format;         ///< The record order.
+        static constexpr endianness wire = Wire;                ///< The byte order of the records.
+        static constexpr std::uint32_t magic = 0x46525345u;     ///< `"ESRF"` read as a little-endian word.
+        static constexpr std::uint8_t version = 2;              ///< The header version written.
+        static constexpr std::uint32_t schema = schema_fingerprint_v<Wire, T...>; ///< The record schema's fingerprint.
+        static constexpr std::size_t header_size = 32;          ///< The bytes of the header proper.
+        static constexpr std::size_t data_offset = 64;          ///< Where the records start.
+        static constexpr std::size_t column_alignment = 64;     ///< The alignment of every column.
+        static constexpr std::size_t record_size = layout_type::size(); ///< The wire size of one record.
+
+        /**
+        * @brief The file size needed for `capacity` records.
+        */
+        [[nodiscard]] static constexpr std::size_t size_for(std::size_t capacity) noexcept;
+
+        /**
+        * @brief Where value `0` of field `I` lives, for a file of `capacity` records.
+        * @return The column start in a columnar file; the field offset within the first row otherwise.
+        */
+        template<std::size_t I>
+        [[nodiscard]] static constexpr std::size_t column_offset(std::size_t capacity) noexcept;
+
+        /**
+        * @brief Write a fresh header for `capacity` records and start appending.
+        *
+        * @param data The start of the (writable) mapping.
+        * @param size The bytes at `data`.
+        * @param capacity The records the file will hold.
+        * @return A writer, or `std::nullopt` if `size < size_for(capacity)`.
+        */
+        [[nodiscard]] static std::optional<record_writer<record_file>> create(std::byte *data, std::size_t size, std::size_t capacity) noexcept;
+
+        /**
+        * @brief Continue appending to a file written earlier.
+        * @return A writer positioned after the last record, or `std::nullopt` if `open` would fail.
+        */
+        [[nodiscard]] static std::optional<record_writer<record_file>> resume(std::byte *data, std::size_t size) noexcept;
+
+        /**
+        * @brief Validate the header and open the records for reading.
+        *
+        * Checks the magic, the version, that the format, wire order, field count, record size and
+        * schema fingerprint are those of this `record_file`, that the count does not exceed the capacity, and that `size`
+        * holds `size_for(capacity)` bytes.
+        *
+        * @param data The start of the mapping.
+        * @param size The bytes at `data`.
+        * @return A reader, or `std::nullopt` if any check fails.
+        */
+        [[nodiscard]] static std::optional<record_reader<record_file>> open(const std::byte *data, std::size_t size) noexcept;
+
+        record_file() = delete;
+
+    private:
+        /**
+        * @brief The header fields at offset 0, always little-endian.
+        */
+        using header = layout<std::uint32_t, std::uint8_t, std::uint8_t, std::uint8_t, std::uint8_t,
+                              std::uint32_t, std::uint32_t, std::uint64_t, std::uint64_t>;
+
+        enum header_field : std::size_t { h_magic, h_version, h_format, h_wire, h_fields, h_record_size, h_schema, h_capacity, h_count };
+
+        /**
+        * @brief The capacity of a valid file, or `std::nullopt`.
+        */
+        [[nodiscard]] static std::optional<std::size_t> validate(const std::byte *data, std::size_t size) noexcept;
+
+        template<typename File>
+        friend class record_writer;
+
+        template<typename File>
+        friend class record_reader;
+    };
+
+    /**
+    * @class record_writer
+    * @brief Appends records to a @ref record_file mapping; created by `create` or `resume`.
+    *
+    * @tparam File The `record_file` specialization.
+    */
+    template<typename File>
+    class record_writer{
+    public:
+        /**
+        * @brief Append one record.
+        *
+        * @param fields The field values, one per field type of `File`.
+        * @return `false` (and nothing is written) once the file holds `capacity()` records.
+        */
+        template<typename... U>
+        bool append(const U &...fields) noexcept;
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept;     ///< Records written.
+        [[nodiscard]] constexpr std::size_t capacity() const noexcept; ///< Records the file can hold.
+
+    private:
+        std::byte *_data;       ///< The start of the mapping (not owned).
+        std::size_t _capacity;  ///< See `capacity()`.
+        std::size_t _count;     ///< See `size()`.
+
+        constexpr record_writer(std::byte *data, std::size_t capacity, std::size_t count) noexcept;
+
+        /**
+        * @brief Write field `I` of record `_count` into its column.
+        */
+        template<std::size_t I, typename U>
+        void put(const U &field) noexcept;
+
+        template<std::size_t... I, typename... U>
+        void put_all(std::index_sequence<I...>, const U &...fields) noexcept;
+
+        friend File;
+    };
+
+    /**
+    * @class record_reader
+    * @brief Reads the records of a validated @ref record_file mapping in place; created by `open`.
+    *
+    * @tparam File The `record_file` specialization.
+    */
+    template<typename File>
+    class record_reader{
+    public:
+        [[nodiscard]] constexpr std::size_t size() const noexcept;     ///< Records in the file.
+        [[nodiscard]] constexpr std::size_t capacity() const noexcept; ///< Records the file can hold.
+
+        /**
+        * @brief A zero-copy view of field `I` across every record.
+        */
+        template<std::size_t I>
+        [[nodiscard]] typename File::template column_t<I> column() const noexcept;
+
+        /**
+        * @brief Decode field `I` of record `index`.
+        * @param index The record index; must be `< size()` (checked by `assert` in debug builds).
+        */
+        template<std::size_t I>
+        [[nodiscard]] typename File::template value_t<I> get(std::size_t index) const noexcept;
+
+        /**
+        * @brief Decode every field of record `index`.
+        * @return The record, or `std::nullopt` if `index >= size()`.
+        */
+        [[nodiscard]] auto row(std::size_t index) const noexcept;
+
+    private:
+        const std::byte *_data; ///< The start of the mapping (not owned).
+        std::size_t _capacity;  ///< See `capacity()`.
+        std::size_t _count;     ///< See `size()`.
+
+        constexpr record_reader(const std::byte *data, std::size_t capacity, std::size_t count) noexcept;
+
+        template<std::size_t... I>
+        auto row_of(std::size_t index, std::index_sequence<I...>) const noexcept;
+
+        friend File;
+    };
+} // namespace eser::flat
+
+#include "record_file.tpp"
+#endif // ESER_FLAT_RECORD_FILE_HPP_
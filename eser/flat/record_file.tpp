@@ -0,0 +1,289 @@
+/**
+* @file record_file.tpp
+*
+* @brief Definition of functionality in record_file.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+* - 2026-10-14
+* -     The header carries the schema fingerprint and `validate` compares it.
+*/
+#ifndef ESER_FLAT_RECORD_FILE_TPP_
+#define ESER_FLAT_RECORD_FILE_TPP_
+#include "record_file.hpp"
+#include <array>
+#include <cassert>
+
+namespace eser::flat{
+    template<endianness Wire, typename V, std::size_t Stride>
+    inline V column_view<Wire, V, Stride>::iterator::operator*() const noexcept
+    {
+        return details::deserialize_value<Wire, V>(_data);
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    constexpr typename column_view<Wire, V, Stride>::iterator &column_view<Wire, V, Stride>::iterator::operator++() noexcept
+    {
+        _data += Stride;
+        return *this;
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    constexpr typename column_view<Wire, V, Stride>::iterator column_view<Wire, V, Stride>::iterator::operator++(int) noexcept
+    {
+        iterator previous = *this;
+        _data += Stride;
+        return previous;
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    constexpr bool column_view<Wire, V, Stride>::iterator::operator==(const iterator &other) const noexcept
+    {
+        return _data == other._data;
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    constexpr bool column_view<Wire, V, Stride>::iterator::operator!=(const iterator &other) const noexcept
+    {
+        return _data != other._data;
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    constexpr column_view<Wire, V, Stride>::iterator::iterator(const std::byte *data) noexcept
+    : _data(data)
+    {
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    constexpr std::size_t column_view<Wire, V, Stride>::size() const noexcept
+    {
+        return _size;
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    constexpr bool column_view<Wire, V, Stride>::empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    inline V column_view<Wire, V, Stride>::operator[](std::size_t index) const noexcept
+    {
+        assert(index < _size && "column_view index out of range");
+        return details::deserialize_value<Wire, V>(_data + index * Stride);
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    inline std::optional<V> column_view<Wire, V, Stride>::at(std::size_t index) const noexcept
+    {
+        if (index >= _size) return std::nullopt;
+        return (*this)[index];
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    constexpr const std::byte *column_view<Wire, V, Stride>::data() const noexcept
+    {
+        return _data;
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    constexpr typename column_view<Wire, V, Stride>::iterator column_view<Wire, V, Stride>::begin() const noexcept
+    {
+        return iterator(_data);
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    constexpr typename column_view<Wire, V, Stride>::iterator column_view<Wire, V, Stride>::end() const noexcept
+    {
+        return iterator(_data + _size * Stride);
+    }
+
+    template<endianness Wire, typename V, std::size_t Stride>
+    constexpr column_view<Wire, V, Stride>::column_view(const std::byte *data, std::size_t size) noexcept
+    : _data(data), _size(size)
+    {
+    }
+
+    template<record_format Format, endianness Wire, typename... T>
+    constexpr std::size_t record_file<Format, Wire, T...>::size_for(std::size_t capacity) noexcept
+    {
+        if constexpr (Format == record_format::rows) return data_offset + capacity * record_size;
+        else return column_offset<sizeof...(T) - 1>(capacity) + capacity * layout_type::template size_of<sizeof...(T) - 1>();
+    }
+
+    template<record_format Format, endianness Wire, typename... T>
+    template<std::size_t I>
+    constexpr std::size_t record_file<Format, Wire, T...>::column_offset(std::size_t capacity) noexcept
+    {
+        static_assert(I < sizeof...(T), "record_file field index out of range");
+        if constexpr (Format == record_format::rows) {
+            return (void)capacity, data_offset + layout_type::template offset_of<I>();
+        } else {
+            constexpr std::array<std::size_t, sizeof...(T)> sizes = { serialized_size_of<T>()... };
+            std::size_t offset = data_offset;
+            for (std::size_t i = 0; i < I; ++i)
+                offset += (capacity * sizes[i] + column_alignment - 1) / column_alignment * column_alignment;
+            return offset;
+        }
+    }
+
+    template<record_format Format, endianness Wire, typename... T>
+    inline std::optional<record_writer<record_file<Format, Wire, T...>>> record_file<Format, Wire, T...>::create(std::byte *data, std::size_t size, std::size_t capacity) noexcept
+    {
+        // bound the capacity first so that size_for cannot overflow
+        if (size < data_offset or capacity > size / record_size or size < size_for(capacity)) return std::nullopt;
+        constexpr endianness H = endianness::little;
+        header::template set<h_magic, H>(data, magic);
+        header::template set<h_version, H>(data, version);
+        header::template set<h_format, H>(data, static_cast<std::uint8_t>(Format));
+        header::template set<h_wire, H>(data, static_cast<std::uint8_t>(Wire));
+        header::template set<h_fields, H>(data, static_cast<std::uint8_t>(sizeof...(T)));
+        header::template set<h_record_size, H>(data, static_cast<std::uint32_t>(record_size));
+        header::template set<h_schema, H>(data, schema);
+        header::template set<h_capacity, H>(data, capacity);
+        header::template set<h_count, H>(data, 0);
+        return record_writer<record_file>(data, capacity, 0);
+    }
+
+    template<record_format Format, endianness Wire, typename... T>
+    inline std::optional<record_writer<record_file<Format, Wire, T...>>> record_file<Format, Wire, T...>::resume(std::byte *data, std::size_t size) noexcept
+    {
+        const std::optional<std::size_t> capacity = validate(data, size);
+        if (not capacity) return std::nullopt;
+        return record_writer<record_file>(data, *capacity, header::template get<h_count>(data));
+    }
+
+    template<record_format Format, endianness Wire, typename... T>
+    inline std::optional<record_reader<record_file<Format, Wire, T...>>> record_file<Format, Wire, T...>::open(const std::byte *data, std::size_t size) noexcept
+    {
+        const std::optional<std::size_t> capacity = validate(data, size);
+        if (not capacity) return std::nullopt;
+        return record_reader<record_file>(data, *capacity, header::template get<h_count>(data));
+    }
+
+    template<record_format Format, endianness Wire, typename... T>
+    inline std::optional<std::size_t> record_file<Format, Wire, T...>::validate(const std::byte *data, std::size_t size) noexcept
+    {
+        static_assert(record_size <= 0xFFFFFFFFu, "the record size does not fit the 32-bit header field");
+        static_assert(header::size() == header_size, "the header layout does not match header_size");
+        if (size < data_offset) return std::nullopt;
+        if (header::template get<h_magic>(data) != magic
+            or header::template get<h_version>(data) != version
+            or header::template get<h_format>(data) != static_cast<std::uint8_t>(Format)
+            or header::template get<h_wire>(data) != static_cast<std::uint8_t>(Wire)
+            or header::template get<h_fields>(data) != sizeof...(T)
+            or header::template get<h_record_size>(data) != record_size
+            or header::template get<h_schema>(data) != schema) return std::nullopt;
+        const std::uint64_t capacity = header::template get<h_capacity>(data);
+        const std::uint64_t count = header::template get<h_count>(data);
+        if (count > capacity or capacity > size / record_size or size < size_for(capacity)) return std::nullopt;
+        return static_cast<std::size_t>(capacity);
+    }
+
+    template<typename File>
+    template<typename... U>
+    inline bool record_writer<File>::append(const U &...fields) noexcept
+    {
+        static_assert(sizeof...(U) == File::layout_type::field_count(), "record_writer::append takes one value per field");
+        if (_count == _capacity) return false;
+        put_all(std::make_index_sequence<sizeof...(U)>{}, fields...);
+        ++_count;
+        File::header::template set<File::h_count, endianness::little>(_data, _count);
+        return true;
+    }
+
+    template<typename File>
+    constexpr std::size_t record_writer<File>::size() const noexcept
+    {
+        return _count;
+    }
+
+    template<typename File>
+    constexpr std::size_t record_writer<File>::capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    template<typename File>
+    constexpr record_writer<File>::record_writer(std::byte *data, std::size_t capacity, std::size_t count) noexcept
+    : _data(data), _capacity(capacity), _count(count)
+    {
+    }
+
+    template<typename File>
+    template<std::size_t I, typename U>
+    inline void record_writer<File>::put(const U &field) noexcept
+    {
+        using column = typename File::template column_t<I>;
+        const typename File::template value_t<I> &value = field;
+        std::byte *at = _data + File::template column_offset<I>(_capacity) + _count * column::stride;
+        std::size_t remaining = File::layout_type::template size_of<I>();
+        details::serialize_impl<File::wire>(at, remaining, value);
+    }
+
+    template<typename File>
+    template<std::size_t... I, typename... U>
+    inline void record_writer<File>::put_all(std::index_sequence<I...>, const U &...fields) noexcept
+    {
+        (put<I>(fields), ...);
+    }
+
+    template<typename File>
+    constexpr std::size_t record_reader<File>::size() const noexcept
+    {
+        return _count;
+    }
+
+    template<typename File>
+    constexpr std::size_t record_reader<File>::capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    template<typename File>
+    template<std::size_t I>
+    inline typename File::template column_t<I> record_reader<File>::column() const noexcept
+    {
+        return typename File::template column_t<I>(_data + File::template column_offset<I>(_capacity), _count);
+    }
+
+    template<typename File>
+    template<std::size_t I>
+    inline typename File::template value_t<I> record_reader<File>::get(std::size_t index) const noexcept
+    {
+        return column<I>()[index];
+    }
+
+    template<typename File>
+    constexpr record_reader<File>::record_reader(const std::byte *data, std::size_t capacity, std::size_t count) noexcept
+    : _data(data), _capacity(capacity), _count(count)
+    {
+    }
+
+    template<typename File>
+    template<std::size_t... I>
+    inline auto record_reader<File>::row_of(std::size_t index, std::index_sequence<I...>) const noexcept
+    {
+        return std::tuple<typename File::template value_t<I>...>(get<I>(index)...);
+    }
+
+    template<typename File>
+    inline auto record_reader<File>::row(std::size_t index) const noexcept
+    {
+        using indices = std::make_index_sequence<File::layout_type::field_count()>;
+        using result = decltype(row_of(index, indices{}));
+        if (index >= _count) return std::optional<result>{};
+        return std::optional<result>(row_of(index, indices{}));
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_RECORD_FILE_TPP_
@@ -13,6 +13,7 @@
 * - `std::array`
 * - trivially copyable structs
 * - Null-terminated C strings
+* - Contiguous batches of identical records (`serialize_range`)
 *
 * The serialization process writes objects into a contiguous buffer of `std::byte` elements,
 * suitable for storage, network transmission, or embedded communication protocols.
@@ -71,6 +72,29 @@
 * - 2025-08-05
 *       License changed from CC BY-ND 4.0 to MIT.
 *       Library renamed from `ser` to `eser`
+* - 2026-10-14
+*       Added `range_serializer` / `serialize_range()`: a whole batch of identical records is
+*       bounds-checked once and, on a native wire, written with a single `memcpy`.
+* - 2026-10-14
+*       Added `to(Sink&)` to `serializer` and `range_serializer`: write into a chunk list, ring
+*       buffer or any other sink (see stream.hpp) without a staging copy.
+* - 2026-10-14
+*       Added `serializer::to_segments`: a `writev`-style `{pointer, length}` list that references
+*       large native-layout lvalue fields in place and only materializes the rest.
+* - 2026-10-14
+*       Consecutive `utils::bits` fields are bit-packed into one group (see utils/bits.hpp).
+* - 2026-10-14
+*       `utils::bounded_vector` / `utils::bounded_string` fields are written as a length prefix and
+*       the used elements; `to()` checks the exact size only when the buffer is below the maximum.
+* - 2026-10-14
+*       Added `serializer::to_array`: a `constexpr` encoding into `std::array`, for blobs built at
+*       compile time.
+* - 2026-10-14
+*       Added the executor overload of `range_serializer::to`, which splits a large batch across
+*       threads (see executor.hpp).
+* - 2026-10-14
+*       `serializer::to(buffer, size)` and `to(sink)` report each message, its size and failures
+*       to the observer policy (see observer.hpp); the default policy compiles to nothing.
 */
 #ifndef ESER_FLAT_SERIALIZER_HPP_
 #define ESER_FLAT_SERIALIZER_HPP_
@@ -85,6 +109,13 @@
 #include "../internal/byte.hpp"
 #include "../utils/endianness.hpp"
 #include "../internal/traits.hpp"
+#include "../utils/bits.hpp"
+#include "../utils/bounded_vector.hpp"
+#include "../utils/fixed_string.hpp"
+#include "../utils/reflect.hpp"
+#include "observer.hpp"
+#include "size.hpp"
+#include "stream.hpp"
 namespace eser::flat{
     using utils::endianness;
 
@@ -92,8 +123,9 @@ namespace eser::flat{
         /**
         * @brief Internal method to serialize a C-array.
         *
-        * Serializes the array element by element, so each element is endianness-converted on its
-        * own (a whole-array memcpy could not honor a non-native wire order).
+        * When no element needs converting to the `Wire` order the whole array is copied with one
+        * `memcpy`; an array of multi-byte scalars on a non-native wire is byte-swapped while it is
+        * copied; anything else is serialized element by element.
         *
         * @tparam Wire The byte order written to the stream.
         * @tparam Vector The C-array type to serialize.
@@ -108,8 +140,8 @@ namespace eser::flat{
         /**
         * @brief Internal method to serialize a `std::array`.
         *
-        * Serializes the array element by element, like the C-array overload, so each element is
-        * endianness-converted on its own.
+        * Uses the same compile-time kernel selection as the C-array overload: one `memcpy`, one
+        * fused swap-copy, or element by element.
         *
         * @tparam Wire The byte order written to the stream.
         * @tparam Array The `std::array` type to serialize.
@@ -159,8 +191,11 @@ namespace eser::flat{
         *
         * This method serializes a trivially copyable struct into the byte stream.
         *
-        * @tparam Wire The byte order written to the stream. A struct may only be serialized when
-        *              `Wire` equals the host byte order (raw bytes cannot be byte-swapped).
+        * @tparam Wire The byte order written to the stream. On a `Wire` that differs from the host
+        *              order the struct must be described with `ESER_REFLECT` (raw bytes cannot be
+        *              byte-swapped); its members are then converted one by one at their offsets.
+        *              A struct described with `ESER_REFLECT_PACKED` is written as its members, back
+        *              to back, whenever that differs from its object representation.
         * @tparam Struct The struct type to serialize.
         * @param buffer A pointer to the output byte stream.
         * @param size The remaining size of the output buffer.
@@ -173,10 +208,148 @@ namespace eser::flat{
         std::enable_if_t<
         std::is_class_v<Struct> and
         std::is_trivially_copyable_v<Struct> and
-        not internal::is_std_array_v<Struct>, bool
+        not internal::is_std_array_v<Struct> and
+        not utils::is_bits_v<Struct> and
+        not utils::is_bounded_v<Struct>, bool
         > = true
         >
         std::size_t serialize_impl(std::byte *&buffer, std::size_t &size, const Struct &str);
+
+        /**
+        * @brief Internal method to serialize a length-prefixed `bounded_vector` / `bounded_string`.
+        *
+        * Writes `size()` as a `length_type` in the `Wire` order, then the used elements with the
+        * same kernels as an array (one `memcpy`, one fused swap-copy, or element by element).
+        *
+        * @tparam Wire The byte order written to the stream.
+        * @tparam Bounded The bounded field type.
+        * @param buffer A pointer to the output byte stream.
+        * @param size The remaining size of the output buffer.
+        * @param field The field to serialize.
+        * @return The number of bytes written to the buffer.
+        */
+        template<endianness Wire, typename Bounded, std::enable_if_t<utils::is_bounded_v<Bounded>, bool> = true>
+        std::size_t serialize_impl(std::byte *&buffer, std::size_t &size, const Bounded &field);
+
+        /**
+        * @brief Internal method to serialize a lone `utils::bits` field.
+        *
+        * Writes the field's storage integer in the `Wire` order. A field next to another `bits`
+        * field never gets here: it is packed with its group by @ref serialize_bit_group.
+        *
+        * @tparam Wire The byte order written to the stream.
+        * @tparam N The field width in bits.
+        * @tparam V The field value type.
+        * @param buffer A pointer to the output byte stream.
+        * @param size The remaining size of the output buffer.
+        * @param field The field to serialize.
+        * @return The number of bytes written to the buffer.
+        */
+        template<endianness Wire, std::size_t N, typename V>
+        std::size_t serialize_impl(std::byte *&buffer, std::size_t &size, utils::bits<N, V> field);
+
+        /**
+        * @brief Pack the bit group that starts at field `First` into `group_size` bytes at `out`.
+        *
+        * Fields are laid out back to back, first field in the least-significant bits on a
+        * little-endian wire and in the most-significant bits on a big-endian one; padding is zero.
+        *
+        * @tparam Wire The byte order written to the stream.
+        * @tparam First The index of the group's first field.
+        * @tparam U... The field types of the message.
+        * @param out The group's first wire byte; the caller guarantees room for the whole group.
+        * @param fields The fields of the message.
+        */
+        template<endianness Wire, std::size_t First, typename... U>
+        void serialize_bit_group(std::byte *out, const std::tuple<U...> &fields) noexcept;
+
+        /**
+        * @brief The exact wire size of a tuple of fields: a constant for a fixed-size message,
+        *        otherwise `serialized_size` of the current values.
+        */
+        template<typename... U>
+        constexpr std::size_t fields_size(const std::tuple<U...> &fields) noexcept;
+
+        /**
+        * @brief Whether a tuple of fields fits in `size` bytes.
+        *
+        * A `constexpr` comparison for a fixed-size message. For a message with bounded fields the
+        * exact size is computed only when `size` is below `max_serialized_size_of`.
+        */
+        template<typename... U>
+        constexpr bool fits(const std::tuple<U...> &fields, std::size_t size) noexcept;
+
+        /**
+        * @brief Serialize every element of a tuple of fields back-to-back, in order.
+        *
+        * The body of `serializer::to` after its capacity check, shared with `encoder`. It performs
+        * no check of its own: the caller guarantees the fields fit (@ref fits).
+        * Each bit group is written once, at its first field.
+        *
+        * @tparam Wire The byte order written to the stream.
+        * @tparam U... The field types of the tuple (values or references).
+        * @param buffer A pointer to the output byte stream.
+        * @param size The size of the output buffer.
+        * @param fields The fields to serialize.
+        * @return The number of bytes written to the buffer.
+        */
+        template<endianness Wire, typename... U>
+        std::size_t serialize_fields(std::byte *buffer, std::size_t size, const std::tuple<U...> &fields);
+
+        /**
+        * @brief Serialize one value into a sink, splitting it only if it straddles a region boundary.
+        *
+        * If the sink's current region holds the whole value it is written in place by
+        * `serialize_impl`. Otherwise a value whose wire image is its object representation is
+        * copied straight from the object; an array is split element by element; anything else is
+        * encoded into a stack temporary of its own size and copied across the boundary.
+        *
+        * @tparam Wire The byte order written to the stream.
+        * @tparam Sink A type modelling the sink concept (see stream.hpp).
+        * @tparam T The value type.
+        * @param sink The output sink; the caller guarantees room for the value's serialized size.
+        * @param value The value to serialize.
+        * @return The number of bytes written to the sink.
+        */
+        template<endianness Wire, typename Sink, typename T>
+        std::size_t serialize_value_to(Sink &sink, const T &value);
+
+        /**
+        * @brief Serialize every element of a tuple of fields into a sink, in order.
+        *
+        * When the whole message fits in the sink's current region this is `serialize_fields` on
+        * that region; otherwise each field goes through @ref serialize_value_to. No capacity check.
+        *
+        * @tparam Wire The byte order written to the stream.
+        * @tparam Sink A type modelling the sink concept (see stream.hpp).
+        * @tparam U... The field types of the tuple (values or references).
+        * @param sink The output sink.
+        * @param fields The fields to serialize.
+        * @return The number of bytes written to the sink.
+        */
+        template<endianness Wire, typename Sink, typename... U>
+        std::size_t serialize_fields_to(Sink &sink, const std::tuple<U...> &fields);
+
+        /**
+        * @brief Encode one value into a `std::array` at offset `at`, in a way that is valid in a
+        *        constant expression.
+        *
+        * The `constexpr` counterpart of `serialize_impl`, used by `serializer::to_array`. Integers,
+        * `bool` and enums are split into bytes with shifts, so the result does not depend on the host
+        * byte order; floating-point values are bit-cast to the integer of their size first; arrays
+        * and `fixed_string`s go element by element; structs described with `ESER_REFLECT` member by
+        * member (padding stays zero). Any other struct is bit-cast whole, on a native wire only,
+        * and must have no padding (`std::has_unique_object_representations_v`).
+        *
+        * @tparam Wire The byte order written.
+        * @tparam N The size of the output array.
+        * @tparam V The value type.
+        * @param out The output array; the caller guarantees room at `at` for the value.
+        * @param at The offset of the value's first wire byte.
+        * @param value The value to encode.
+        */
+        template<endianness Wire, std::size_t N, typename V>
+        constexpr void serialize_constant(std::array<std::byte, N> &out, std::size_t at, const V &value) noexcept;
     }
     /**
     * @class serializer
@@ -198,6 +371,14 @@ namespace eser::flat{
     * @tparam T... The captured argument types (deduced by the `serialize()` factory; lvalues are
     *              held by reference).
     */
+    /**
+    * @brief The default minimum size of a field that `serializer::to_segments` references in place.
+    *
+    * Below it, a separate `{pointer, length}` entry costs more than copying the bytes (a DMA
+    * descriptor, an `iovec` walked by the kernel), so smaller fields are copied into scratch.
+    */
+    inline constexpr std::size_t segment_in_place_threshold = 64;
+
     template<endianness Wire, typename ...T>
     class serializer{
     public:
@@ -324,6 +505,87 @@ namespace eser::flat{
         template<size_t N>
         std::size_t to(std::uint8_t (&buffer)[N]) &&;
 
+        /**
+        * @brief Serialize multiple values into a sink (chunk list, ring buffer, ...).
+        *
+        * Writes the same bytes as `to(buffer, size)`, but into memory that need not be contiguous
+        * (see stream.hpp). When the message fits in the sink's current region it is written there
+        * directly; otherwise only the fields that straddle a region boundary are split.
+        *
+        * ```cpp
+        * chunk regions[] = { {dma_a, 6}, {dma_b, 64} };
+        * chunk_sink out(regions);
+        * std::size_t bytes_written = serialize(id, value).to(out);
+        * ```
+        *
+        * @tparam Sink A type modelling the sink concept (`is_sink_v<Sink>`).
+        * @param sink The output sink; its cursor is advanced past the written bytes.
+        * @return The number of bytes written, or `0` if the sink has less room than
+        *         `serialized_size_of<T...>()` — nothing is written in that case.
+        *
+        * @see serializer::to(std::byte*, std::size_t)
+        */
+        template<typename Sink, std::enable_if_t<is_sink_v<Sink>, bool> = true>
+        std::size_t to(Sink &sink) &&;
+
+        /**
+        * @brief Serialize into a list of `{pointer, length}` segments for `writev`, `sendmsg` or DMA.
+        *
+        * A field is **referenced in place** (its own bytes become a segment, nothing is copied) when:
+        * - it was passed as an lvalue (an rvalue lives in the temporary serializer and dies with it);
+        * - its wire image is its object representation (on this `Wire`, nothing needs swapping);
+        * - it is at least `MinInPlace` bytes.
+        *
+        * Every other field is serialized into `scratch`. Adjacent scratch fields share one segment.
+        * Concatenating the segments gives exactly the bytes `to(buffer, size)` would write.
+        *
+        * ```cpp
+        * const_chunk segments[4];
+        * std::byte scratch[16];
+        * std::size_t n = serialize(header, big_payload, crc).to_segments(segments, 4, scratch, sizeof(scratch));
+        * // segments: {scratch, sizeof(header)}, {&big_payload, sizeof(big_payload)}, {scratch + sizeof(header), 4}
+        * ```
+        *
+        * The worst case is one segment per field and `serialized_size_of<T...>()` bytes of scratch.
+        *
+        * @tparam MinInPlace The smallest field, in bytes, that is referenced rather than copied.
+        * @param segments Receives the segments, in wire order.
+        * @param capacity The number of entries `segments` can hold.
+        * @param scratch Storage for the copied fields; it must outlive the use of the segments.
+        * @param scratch_size The size of `scratch` in bytes.
+        * @return The number of segments written, or `0` if `capacity` or `scratch_size` is too small
+        *         (an `assert` fires in debug builds).
+        *
+        * @warning Segments point into the referenced variables and into `scratch`: consume them before
+        *          either is modified or goes out of scope.
+        */
+        template<std::size_t MinInPlace = segment_in_place_threshold>
+        std::size_t to_segments(const_chunk *segments, std::size_t capacity, std::byte *scratch, std::size_t scratch_size) &&;
+
+        /**
+        * @brief Serialize into a `std::array` of exactly the message size; usable in a constant
+        *        expression, so tables and calibration blobs can be encoded at compile time.
+        *
+        * ```cpp
+        * constexpr std::array<std::uint16_t, 4> gains = {1024, 1019, 1031, 998};
+        * constexpr auto blob = serialize<endianness::big>(std::uint8_t{2}, gains, 0.5f).to_array();
+        * // std::array<std::byte, 13>, in .rodata; no code runs at start-up
+        * ```
+        *
+        * The bytes are those `to(buffer, size)` writes, except that the padding of a struct
+        * described with `ESER_REFLECT` is always zero. The message must be fixed-size and contain no
+        * `utils::bits` fields. A struct without `ESER_REFLECT` must have no padding and no
+        * floating-point members (`std::has_unique_object_representations_v`); describe such a struct
+        * with `ESER_REFLECT` instead.
+        *
+        * @return The serialized message, `std::array<std::byte, serialized_size_of<T...>()>`.
+        *
+        * @note Floating-point fields, and structs not described with `ESER_REFLECT`, are encoded
+        *       through `__builtin_bit_cast`; where the compiler lacks it (`ESER_CONSTEXPR_BIT_CAST`
+        *       undefined; GCC < 11, Clang < 9, MSVC < 19.26) such messages encode at run time only.
+        */
+        [[nodiscard]] constexpr auto to_array() &&;
+
     private:
         std::tuple<T...> _args; ///< The captured values (lvalue arguments are held by reference).
 
@@ -373,6 +635,171 @@ namespace eser::flat{
         return serializer<Wire, T...>(std::forward<T>(args)...);
     }
     
+    /**
+    * @class range_serializer
+    * @brief Serializes a contiguous batch of identical records into a byte stream.
+    *
+    * Where `serialize(a, b, c)` captures a fixed set of fields, a `range_serializer` holds a
+    * non-owning view (`pointer`, `count`) over `count` records of one type `T` and writes them
+    * back-to-back, exactly as `count` calls to `serialize(record).to(...)` would — but with a
+    * single capacity check for `count * serialized_size_of<T>()` bytes. When no record needs
+    * byte-swapping on the `Wire` order (see `internal::needs_byte_swap_v`) and its wire image is its
+    * object representation, the whole batch collapses into one `memcpy`.
+    *
+    * Like `serializer`, its `to()` overloads are **rvalue-ref-qualified**: write
+    * `serialize_range(records).to(buffer)` as a single expression.
+    *
+    * @tparam Wire The byte order written to the stream.
+    * @tparam T The record type (scalar, enum, `std::array`, or trivially-copyable struct).
+    */
+    template<endianness Wire, typename T>
+    class range_serializer{
+    public:
+        /**
+        * @brief Serialize every record into a byte stream.
+        *
+        * @param buffer A pointer to a writable output byte stream as `std::byte*`.
+        * @param size The size of the output buffer in bytes.
+        * @return The number of bytes written (`count * serialized_size_of<T>()`), or `0` if the
+        *         buffer cannot hold the whole batch — nothing is written in that case.
+        *
+        * @note Like `serializer::to`, an undersized buffer also trips an `assert` in debug builds.
+        */
+        std::size_t to(std::byte *buffer, std::size_t size) &&;
+
+        /**
+        * @brief Serialize every record into a byte stream, splitting a large batch across threads.
+        *
+        * Record `i` always lands at `i * serialized_size_of<T>()`, so the batch is cut into parts of
+        * consecutive records that are written independently, with the same kernels as
+        * `to(buffer, size)`; the only synchronization is the executor's final join. A batch is split
+        * into `min(executor.concurrency(), bytes / Threshold)` parts: below `Threshold` bytes, or
+        * with an executor of concurrency 1, it is the single-threaded path.
+        *
+        * ```cpp
+        * thread_executor pool;
+        * serialize_range(checkpoint.data(), checkpoint.size()).to(mapped, mapped_size, pool);
+        * ```
+        *
+        * @tparam Threshold The smallest part, in bytes.
+        * @tparam Executor An executor (see executor.hpp): `concurrency()` and `run(parts, job)`.
+        * @param buffer A pointer to a writable output byte stream as `std::byte*`.
+        * @param size The size of the output buffer in bytes.
+        * @param executor Runs the parts; `run` must return only once every part has.
+        * @return The number of bytes written, or `0` if the buffer cannot hold the whole batch.
+        */
+        template<std::size_t Threshold = parallel_threshold, typename Executor>
+        std::size_t to(std::byte *buffer, std::size_t size, Executor &&executor) &&;
+
+        /**
+        * @brief Serialize every record into a fixed-size byte array.
+        *
+        * @tparam N The size of the output array in bytes.
+        * @param buffer A fixed-size writable array of `std::byte` elements.
+        * @return The number of bytes written, or `0` if the array is too small.
+        *
+        * @see range_serializer::to(std::byte*, std::size_t)
+        */
+        template<size_t N>
+        std::size_t to(std::byte (&buffer)[N]) &&;
+
+        /**
+        * @brief Serialize every record into a legacy `uint8_t` byte stream.
+        *
+        * @param buffer A pointer to a legacy byte stream as `std::uint8_t*`.
+        * @param size The size of the output buffer in bytes.
+        * @return The number of bytes written, or `0` if the buffer is too small.
+        *
+        * @see range_serializer::to(std::byte*, std::size_t)
+        */
+        std::size_t to(std::uint8_t *buffer, std::size_t size) &&;
+
+        /**
+        * @brief Serialize every record into a legacy fixed-size `uint8_t` buffer.
+        *
+        * @tparam N The size of the output array in bytes.
+        * @param buffer A fixed-size array of legacy `std::uint8_t` bytes.
+        * @return The number of bytes written, or `0` if the array is too small.
+        *
+        * @see range_serializer::to(std::byte (&)[N])
+        */
+        template<size_t N>
+        std::size_t to(std::uint8_t (&buffer)[N]) &&;
+
+        /**
+        * @brief Serialize every record into a sink (chunk list, ring buffer, ...).
+        *
+        * One capacity check for the batch. If the batch fits in the sink's current region it is
+        * written there with the same kernels as `to(buffer, size)`; otherwise record by record.
+        *
+        * @tparam Sink A type modelling the sink concept (`is_sink_v<Sink>`).
+        * @param sink The output sink; its cursor is advanced past the written bytes.
+        * @return The number of bytes written, or `0` if the sink has too little room.
+        *
+        * @see range_serializer::to(std::byte*, std::size_t)
+        */
+        template<typename Sink, std::enable_if_t<is_sink_v<Sink>, bool> = true>
+        std::size_t to(Sink &sink) &&;
+
+    private:
+        const T *_records;   ///< First record of the batch (not owned).
+        std::size_t _count;  ///< Number of records in the batch.
+
+        /**
+        * @brief Private constructor to enforce the use of `serialize_range`.
+        *
+        * @param records Pointer to the first record.
+        * @param count Number of records.
+        */
+        constexpr range_serializer(const T *records, std::size_t count);
+
+        template<endianness W, typename U>
+        friend constexpr range_serializer<W, U> serialize_range(const U *records, std::size_t count);
+    };
+
+    /**
+    * @brief Factory function to create a `range_serializer` over `count` records.
+    *
+    * @tparam Wire The byte order to serialize with (default `endianness::little`).
+    * @tparam T The record type.
+    * @param records Pointer to the first record; may be null only when `count == 0`.
+    * @param count Number of records to serialize.
+    * @return A `range_serializer` viewing the records (nothing is copied).
+    */
+    template<endianness Wire = endianness::little, typename T>
+    constexpr range_serializer<Wire, T> serialize_range(const T *records, std::size_t count)
+    {
+        static_assert(not std::is_array_v<T> and not internal::is_tuple_v<T>,
+            "[eser] serialize_range records must be single values; wrap C-arrays in std::array");
+        return range_serializer<Wire, T>(records, count);
+    }
+
+    /**
+    * @brief Factory function to create a `range_serializer` over a contiguous range of records.
+    *
+    * Accepts any range supporting `std::data` / `std::size`: a C-array, `std::array`,
+    * `std::vector`, or `std::span` (C++20).
+    *
+    * ```cpp
+    * sample frames[256] = { ... };
+    * std::size_t written = serialize_range<endianness::big>(frames).to(buffer, sizeof(buffer));
+    * ```
+    *
+    * @tparam Wire The byte order to serialize with (default `endianness::little`).
+    * @tparam Range The contiguous range type.
+    * @param records The records to serialize; must outlive the full expression.
+    * @return A `range_serializer` viewing the records (nothing is copied).
+    */
+    template<
+        endianness Wire = endianness::little,
+        typename Range,
+        std::enable_if_t<internal::is_contiguous_range_v<const Range>, bool> = true
+    >
+    constexpr auto serialize_range(const Range &records)
+    {
+        return serialize_range<Wire>(std::data(records), std::size(records));
+    }
+
 } // eser::flat
 
 #include "serializer.tpp"
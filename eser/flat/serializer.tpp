@@ -20,6 +20,37 @@
 * - 2026-06-24
 *       Added the `Wire` endianness policy: `serializer<Wire, T...>` byte-reverses scalars when
 *       `Wire` differs from the host order; structs are restricted to native-endian wires.
+* - 2026-10-14
+*       Added `range_serializer`: one capacity check per batch, one `memcpy` on a native wire.
+* - 2026-10-14
+*       Arrays of multi-byte scalars on a non-native wire are written with the vectorized
+*       `internal::byteswap_copy` kernel instead of per-element byte loops.
+* - 2026-10-14
+*       Array paths go through `details::serialize_elements`, which selects at compile time
+*       between one whole-block `memcpy` (no swap needed) and a fused swap-while-copying kernel.
+* - 2026-10-14
+*       Added the sink overloads of `to()` and `details::serialize_value_to` / `serialize_fields_to`.
+* - 2026-10-14
+*       Added `serializer::to_segments`.
+* - 2026-10-14
+*       Added bit-group packing of consecutive `utils::bits` fields; the field loops are indexed
+*       (`serialize_field`, `serialize_field_to`) so a group is written once, at its first field.
+* - 2026-10-14
+*       Added length-prefixed bounded fields and the `fits` / `fields_size` capacity checks.
+* - 2026-10-14
+*       Structs described with `ESER_REFLECT` cross a non-native wire member by member
+*       (`serialize_members`); they stay one `memcpy` whenever no member needs swapping.
+* - 2026-10-14
+*       Structs described with `ESER_REFLECT_PACKED` are written member by member, back to back.
+* - 2026-10-14
+*       Added `serializer::to_array` and `details::serialize_constant`.
+* - 2026-10-14
+*       Added the parallel `range_serializer::to(buffer, size, executor)`.
+* - 2026-10-14
+*       `serializer::to` reports every message to the active observer (see observer.hpp).
+* - 2026-10-14
+*       `to_array` rejects raw structs with padding at compile time (they cannot be bit-cast in a
+*       constant expression).
 */
 #ifndef ESER_FLAT_SERIALIZER_TPP_
 #define ESER_FLAT_SERIALIZER_TPP_
@@ -27,41 +58,74 @@
 #include "../internal/traits.hpp"
 #include "size.hpp"
 #include "../internal/endianness.hpp"
+#include "../internal/byteswap.hpp"
+#include "../internal/bit_cast.hpp"
+#include <algorithm>
+#include <iterator>
 #include <limits>
 namespace eser::flat{
     namespace details{
-        template <endianness Wire, typename Vector, std::enable_if_t<std::is_array_v<Vector>, bool>>
-        std::size_t serialize_impl(std::byte *&buffer, std::size_t &size, const Vector& vector)
+        /**
+        * @brief Write a contiguous run of `count` elements, choosing the copy kernel at compile time.
+        *
+        * - The wire image of `E` is its object representation (no swap needed, no size change):
+        *   the whole run is a single `memcpy`.
+        * - `E` is a multi-byte scalar or enum on a non-native wire: the run is swapped *while*
+        *   it is copied (@ref internal::byteswap_copy), so every byte is read and written once.
+        * - Otherwise (e.g. nested arrays that need swapping): element by element.
+        *
+        * Shared by the C-array and `std::array` overloads and by `range_serializer`.
+        *
+        * @tparam Wire The byte order written to the stream.
+        * @tparam E The element type.
+        * @param buffer A pointer to the output byte stream.
+        * @param size The remaining size of the output buffer.
+        * @param elements The first element of the run.
+        * @param count The number of elements.
+        * @return The number of bytes written to the buffer.
+        */
+        template<endianness Wire, typename E>
+        inline std::size_t serialize_elements(std::byte *&buffer, std::size_t &size, const E *elements, std::size_t count)
         {
-            using type = std::remove_extent_t<Vector>;
-            constexpr std::size_t N = std::extent_v<Vector>;
-            std::size_t total_bytes = 0;
-            for (std::size_t i = 0; i < N; ++i) {
-                std::size_t bytes = serialize_impl<Wire>(buffer, size, vector[i]);
+            using leaf = internal::array_leaf_t<E>;
+            if constexpr (std::is_floating_point_v<leaf>)
+                static_assert(std::numeric_limits<leaf>::is_iec559,
+                    "[eser] floating-point serialization requires an IEEE-754 (iec559) representation");
+            if constexpr (not internal::needs_byte_swap_v<Wire, E> and serialized_size_of<E>() == sizeof(E)) {
+                const std::size_t bytes = count * sizeof(E);
+                if (bytes != 0) std::memcpy(static_cast<void*>(buffer), elements, bytes);
+                buffer += bytes, size -= bytes;
+                return bytes;
+            } else if constexpr (internal::is_swapped_scalar_v<Wire, E>) {
+                const std::size_t bytes = count * sizeof(E);
+                internal::byteswap_copy<sizeof(E)>(buffer, elements, count);
+                buffer += bytes, size -= bytes;
+                return bytes;
+            } else {
+                std::size_t total_bytes = 0;
+                for (std::size_t i = 0; i < count; ++i) {
+                    std::size_t bytes = serialize_impl<Wire>(buffer, size, elements[i]);
 
-                if (bytes == 0 && sizeof(type) > 0){
-                    assert(false && "Buffer ran out during array element serialization");
-                    break;
+                    if (bytes == 0 && sizeof(E) > 0){
+                        assert(false && "Buffer ran out during array element serialization");
+                        break;
+                    }
+                    total_bytes += bytes;
                 }
-                total_bytes += bytes;
+                return total_bytes;
             }
-            return total_bytes;
+        }
+
+        template <endianness Wire, typename Vector, std::enable_if_t<std::is_array_v<Vector>, bool>>
+        std::size_t serialize_impl(std::byte *&buffer, std::size_t &size, const Vector& vector)
+        {
+            return serialize_elements<Wire>(buffer, size, vector, std::extent_v<Vector>);
         }
 
         template <endianness Wire, typename Array, std::enable_if_t<internal::is_std_array_v<Array>, bool>>
         std::size_t serialize_impl(std::byte *&buffer, std::size_t &size, const Array& array)
         {
-            std::size_t total_bytes = 0;
-            for (const auto& element : array) {
-                std::size_t bytes = serialize_impl<Wire>(buffer, size, element);
-
-                if (bytes == 0 && sizeof(typename Array::value_type) > 0){
-                    assert(false && "Buffer ran out during array element serialization");
-                    break;
-                }
-                total_bytes += bytes;
-            }
-            return total_bytes;
+            return serialize_elements<Wire>(buffer, size, array.data(), array.size());
         }
 
         template<endianness Wire, typename Scalar, std::enable_if_t<std::is_arithmetic_v<Scalar>, bool>>
@@ -84,25 +148,388 @@ namespace eser::flat{
             return serialize_impl<Wire>(buffer, size, static_cast<std::underlying_type_t<Enum>>(enum_member));
         }
 
+        /**
+        * @brief Write a described struct member by member, each at its offset and in the `Wire`
+        *        order; the padding (and any unlisted member) is written as zero.
+        *
+        * @tparam Wire The byte order written to the stream.
+        * @tparam Struct A struct described with `ESER_REFLECT`.
+        * @param out The first byte of the struct's `sizeof(Struct)`-byte wire image.
+        * @param str The struct.
+        */
+        template<endianness Wire, typename Struct>
+        inline void serialize_members(std::byte *out, const Struct &str)
+        {
+            using reflection = utils::reflection_t<Struct>;
+            if constexpr (not reflection::padding_free)
+                std::memset(static_cast<void*>(out), 0, sizeof(Struct));
+            reflection::for_each([out, &str](auto m){
+                using value_type = typename decltype(m)::value_type;
+                static_assert(serialized_size_of<value_type>() == sizeof(value_type),
+                    "[eser] a member of a described struct must keep its in-memory size on the wire");
+                std::byte *at = out + decltype(m)::offset;
+                std::size_t room = sizeof(value_type);
+                serialize_impl<Wire>(at, room, decltype(m)::get(str));
+            });
+        }
+
         template<
         endianness Wire,
         typename Struct,
         std::enable_if_t<
         std::is_class_v<Struct> and
         std::is_trivially_copyable_v<Struct> and
-        not internal::is_std_array_v<Struct>, bool
+        not internal::is_std_array_v<Struct> and
+        not utils::is_bits_v<Struct> and
+        not utils::is_bounded_v<Struct>, bool
         >
         >
         std::size_t serialize_impl(std::byte *&buffer, std::size_t &size, const Struct &str){
-            static_assert(Wire == internal::host_endianness or utils::is_endianness_neutral_v<Struct>,
+            static_assert(not internal::needs_byte_swap_v<Wire, Struct> or utils::is_reflected_v<Struct>,
                 "[eser] trivially-copyable structs are serialized as raw bytes and cannot be "
-                "byte-swapped; serialize with the native wire endianness, split the struct into "
-                "scalar fields, or specialize is_endianness_neutral if the type is byte-only");
-            constexpr std::size_t struct_size = sizeof(Struct);
+                "byte-swapped; describe the members with ESER_REFLECT (eser/utils/reflect.hpp), "
+                "serialize with the native wire endianness, split the struct into scalar fields, "
+                "or specialize is_endianness_neutral if the type is byte-only");
+            constexpr std::size_t struct_size = serialized_size_of<Struct>();
             //assert(struct_size <= size && "Buffer size is insufficient for the struct");
-            std::memcpy(static_cast<void*>(buffer), &str, struct_size);
-            buffer += struct_size, size -= struct_size;
-            return struct_size;
+            if constexpr (not internal::needs_byte_swap_v<Wire, Struct>) {
+                std::memcpy(static_cast<void*>(buffer), &str, struct_size);
+                buffer += struct_size, size -= struct_size;
+                return struct_size;
+            } else if constexpr (utils::is_packed_v<Struct>) {
+                // back to back: each member advances the cursor by its own wire size
+                utils::reflection_t<Struct>::for_each([&buffer, &size, &str](auto m){
+                    serialize_impl<Wire>(buffer, size, decltype(m)::get(str));
+                });
+                return struct_size;
+            } else {
+                serialize_members<Wire>(buffer, str);
+                buffer += struct_size, size -= struct_size;
+                return struct_size;
+            }
+        }
+
+        template<endianness Wire, typename Bounded, std::enable_if_t<utils::is_bounded_v<Bounded>, bool>>
+        std::size_t serialize_impl(std::byte *&buffer, std::size_t &size, const Bounded &field)
+        {
+            using length_type = typename Bounded::length_type;
+            static_assert(serialized_size_of<typename Bounded::value_type>() == sizeof(typename Bounded::value_type),
+                "[eser] bounded_vector elements must keep their in-memory size on the wire (no packed structs)");
+            const std::size_t prefix = serialize_impl<Wire>(buffer, size, static_cast<length_type>(field.size()));
+            return prefix + serialize_elements<Wire>(buffer, size, field.data(), field.size());
+        }
+
+        template<typename... U>
+        constexpr std::size_t fields_size(const std::tuple<U...> &fields) noexcept
+        {
+            if constexpr (is_fixed_size_v<U...>)
+                return (void)fields, serialized_size_of<U...>();
+            else
+                return std::apply([](const auto &...values){ return serialized_size(values...); }, fields);
+        }
+
+        template<typename... U>
+        constexpr bool fits(const std::tuple<U...> &fields, std::size_t size) noexcept
+        {
+            if constexpr (is_fixed_size_v<U...>)
+                return (void)fields, serialized_size_of<U...>() <= size;
+            else
+                return max_serialized_size_of<U...>() <= size or fields_size(fields) <= size;
+        }
+
+        template<endianness Wire, std::size_t N, typename V>
+        std::size_t serialize_impl(std::byte *&buffer, std::size_t &size, utils::bits<N, V> field)
+        {
+            return serialize_impl<Wire>(buffer, size, field.raw());
+        }
+
+        /**
+        * @brief OR the members `First + K...` of a bit group into one word, left-aligned to the
+        *        group's byte size on a big-endian wire.
+        */
+        template<endianness Wire, std::size_t First, typename... U, std::size_t... K>
+        inline std::uint64_t pack_bit_group(const std::tuple<U...> &fields, std::index_sequence<K...>) noexcept
+        {
+            using groups = bit_groups<U...>;
+            constexpr std::size_t span = groups::group_size(First) * 8;
+            std::uint64_t word = 0;
+            if constexpr (Wire == endianness::little)
+                ((word |= std::uint64_t{std::get<First + K>(fields).raw()} << groups::bit_offset(First + K)), ...);
+            else
+                ((word |= std::uint64_t{std::get<First + K>(fields).raw()} << (span - groups::bit_offset(First + K) - groups::widths[First + K])), ...);
+            return word;
+        }
+
+        template<endianness Wire, std::size_t First, typename... U>
+        inline void serialize_bit_group(std::byte *out, const std::tuple<U...> &fields) noexcept
+        {
+            using groups = bit_groups<U...>;
+            constexpr std::size_t bytes = groups::group_size(First);
+            const std::uint64_t word = pack_bit_group<Wire, First>(fields, std::make_index_sequence<groups::members(First)>{});
+            for (std::size_t b = 0; b < bytes; ++b) {
+                const std::size_t shift = Wire == endianness::little ? 8 * b : 8 * (bytes - 1 - b);
+                out[b] = static_cast<std::byte>(word >> shift);
+            }
+        }
+
+        /**
+        * @brief Serialize field `I` of a message: the whole group at a group's first field, nothing
+        *        at its other members, `serialize_impl` for any other field.
+        * @return The number of bytes written to the buffer.
+        */
+        template<endianness Wire, std::size_t I, typename... U>
+        inline std::size_t serialize_field(std::byte *&buffer, std::size_t &size, const std::tuple<U...> &fields)
+        {
+            using groups = bit_groups<U...>;
+            if constexpr (not groups::packed(I)) {
+                return serialize_impl<Wire>(buffer, size, std::get<I>(fields));
+            } else if constexpr (groups::first(I) == I) {
+                constexpr std::size_t bytes = groups::group_size(I);
+                serialize_bit_group<Wire, I>(buffer, fields);
+                buffer += bytes, size -= bytes;
+                return bytes;
+            } else {
+                return 0;
+            }
+        }
+
+        template<endianness Wire, typename... U, std::size_t... I>
+        inline std::size_t serialize_fields(std::byte *buffer, std::size_t size, const std::tuple<U...> &fields, std::index_sequence<I...>)
+        {
+            std::size_t total = 0;
+            // a comma fold, so the fields advance the cursor strictly in order
+            ((total += serialize_field<Wire, I>(buffer, size, fields)), ...);
+            return total;
+        }
+
+        template<endianness Wire, typename... U>
+        inline std::size_t serialize_fields(std::byte *buffer, std::size_t size, const std::tuple<U...> &fields)
+        {
+            return serialize_fields<Wire>(buffer, size, fields, std::index_sequence_for<U...>{});
+        }
+
+        template<endianness Wire, typename Sink, typename T>
+        inline std::size_t serialize_value_to(Sink &sink, const T &value)
+        {
+            if constexpr (utils::is_bounded_v<T>) {
+                // the prefix, then the used elements, each split only where it straddles a boundary
+                const std::size_t bytes = serialized_size(value);
+                if (std::byte *out = sink.contiguous(bytes)) {
+                    std::size_t room = bytes;
+                    serialize_impl<Wire>(out, room, value);
+                    sink.advance(bytes);
+                    return bytes;
+                }
+                serialize_value_to<Wire>(sink, static_cast<typename T::length_type>(value.size()));
+                for (const auto *element = value.data(); element != value.data() + value.size(); ++element)
+                    serialize_value_to<Wire>(sink, *element);
+                return bytes;
+            } else {
+                constexpr std::size_t bytes = serialized_size_of<T>();
+                if (std::byte *out = sink.contiguous(bytes)) {
+                    std::size_t room = bytes;
+                    serialize_impl<Wire>(out, room, value);
+                    sink.advance(bytes);
+                } else if constexpr (not internal::needs_byte_swap_v<Wire, T> and bytes == sizeof(T)) {
+                    // the wire image is the object itself: copy it across the boundary as is
+                    sink.write(static_cast<const std::byte *>(static_cast<const void *>(&value)), bytes);
+                } else if constexpr (std::is_array_v<T> or internal::is_std_array_v<T>) {
+                    for (const auto &element : value) serialize_value_to<Wire>(sink, element);
+                } else {
+                    std::byte scratch[bytes];
+                    std::byte *out = scratch;
+                    std::size_t room = bytes;
+                    serialize_impl<Wire>(out, room, value);
+                    sink.write(scratch, bytes);
+                }
+                return bytes;
+            }
+        }
+
+        /**
+        * @brief Serialize field `I` of a message into a sink; a bit group is packed into a stack
+        *        temporary at its first field and copied out in one write.
+        * @return The number of bytes written to the sink.
+        */
+        template<endianness Wire, std::size_t I, typename Sink, typename... U>
+        inline std::size_t serialize_field_to(Sink &sink, const std::tuple<U...> &fields)
+        {
+            using groups = bit_groups<U...>;
+            if constexpr (not groups::packed(I)) {
+                return serialize_value_to<Wire>(sink, std::get<I>(fields));
+            } else if constexpr (groups::first(I) == I) {
+                constexpr std::size_t bytes = groups::group_size(I);
+                std::byte scratch[bytes];
+                serialize_bit_group<Wire, I>(scratch, fields);
+                sink.write(scratch, bytes);
+                return bytes;
+            } else {
+                return 0;
+            }
+        }
+
+        template<endianness Wire, typename Sink, typename... U, std::size_t... I>
+        inline std::size_t serialize_fields_to(Sink &sink, const std::tuple<U...> &fields, std::index_sequence<I...>)
+        {
+            std::size_t total = 0;
+            ((total += serialize_field_to<Wire, I>(sink, fields)), ...);
+            return total;
+        }
+
+        template<endianness Wire, typename Sink, typename... U>
+        inline std::size_t serialize_fields_to(Sink &sink, const std::tuple<U...> &fields)
+        {
+            const std::size_t bytes = fields_size(fields);
+            if (std::byte *out = sink.contiguous(bytes)) {
+                serialize_fields<Wire>(out, bytes, fields);
+                sink.advance(bytes);
+                return bytes;
+            }
+            return serialize_fields_to<Wire>(sink, fields, std::index_sequence_for<U...>{});
+        }
+
+        /**
+        * @brief Whether `to_segments` references a captured field in place instead of copying it.
+        *
+        * @tparam Wire The byte order written to the stream.
+        * @tparam MinInPlace The size threshold in bytes.
+        * @tparam Field The captured type, as stored in the serializer (`U&` for an lvalue argument).
+        */
+        template<endianness Wire, std::size_t MinInPlace, typename Field>
+        inline constexpr bool is_segment_in_place_v = [](){
+            using bare_t = std::remove_cv_t<std::remove_reference_t<Field>>;
+            if constexpr (std::is_lvalue_reference_v<Field>)
+                return not utils::is_bits_v<bare_t> and
+                       not internal::needs_byte_swap_v<Wire, bare_t> and
+                       serialized_size_of<bare_t>() == sizeof(bare_t) and
+                       sizeof(bare_t) >= MinInPlace;
+            else
+                return false;
+        }();
+
+        /**
+        * @brief The scratch bytes and segment entries `to_segments` needs for a message.
+        *
+        * Each in-place field takes one entry; each run of consecutive copied fields takes one entry
+        * and its total size in scratch.
+        *
+        * @return `{scratch bytes, segment entries}`.
+        */
+        template<endianness Wire, std::size_t MinInPlace, typename... Field>
+        constexpr std::pair<std::size_t, std::size_t> segment_requirements() noexcept
+        {
+            constexpr bool in_place[] = { is_segment_in_place_v<Wire, MinInPlace, Field>... };
+            std::size_t bytes = 0, entries = 0;
+            for (std::size_t i = 0; i < sizeof...(Field); ++i) {
+                if (in_place[i]) ++entries;
+                else bytes += bit_groups<Field...>::wire_size(i), entries += (i == 0 or in_place[i - 1]);
+            }
+            return {bytes, entries};
+        }
+
+        /**
+        * @brief Append `{data, size}` to a segment list, merging it with the last one if adjacent.
+        * @return `false` if a new entry is needed and the list is full.
+        */
+        inline bool push_segment(const_chunk *segments, std::size_t capacity, std::size_t &count,
+            const std::byte *data, std::size_t size) noexcept
+        {
+            if (count != 0 and segments[count - 1].data + segments[count - 1].size == data) {
+                segments[count - 1].size += size;
+                return true;
+            }
+            if (count == capacity) return false;
+            segments[count++] = const_chunk{data, size};
+            return true;
+        }
+
+        /**
+        * @brief Emit every field of a message into a segment list: in-place fields by reference,
+        *        the rest (bit groups included) encoded into `cursor`, which advances through scratch.
+        */
+        template<endianness Wire, std::size_t MinInPlace, typename... U, std::size_t... I>
+        inline void segment_fields(const_chunk *segments, std::size_t capacity, std::size_t &count,
+            std::byte *&cursor, const std::tuple<U...> &fields, std::index_sequence<I...>)
+        {
+            ([&](auto index){
+                constexpr std::size_t i = decltype(index)::value;
+                constexpr std::size_t bytes = bit_groups<U...>::wire_size(i);
+                if constexpr (is_segment_in_place_v<Wire, MinInPlace, internal::type_at_t<i, U...>>) {
+                    push_segment(segments, capacity, count, static_cast<const std::byte *>(static_cast<const void *>(&std::get<i>(fields))), bytes);
+                } else if constexpr (bytes != 0) {
+                    const std::byte *start = cursor;
+                    std::size_t room = bytes;
+                    serialize_field<Wire, i>(cursor, room, fields);
+                    push_segment(segments, capacity, count, start, bytes);
+                }
+            }(std::integral_constant<std::size_t, I>{}), ...);
+        }
+
+        template<endianness Wire, std::size_t N, typename V>
+        constexpr void serialize_constant(std::array<std::byte, N> &out, std::size_t at, const V &value) noexcept
+        {
+            if constexpr (std::is_same_v<V, bool>) {
+                out[at] = std::byte{value ? std::uint8_t{1} : std::uint8_t{0}};
+            } else if constexpr (std::is_enum_v<V>) {
+                serialize_constant<Wire>(out, at, static_cast<std::underlying_type_t<V>>(value));
+            } else if constexpr (std::is_floating_point_v<V>) {
+                static_assert(std::numeric_limits<V>::is_iec559,
+                    "[eser] floating-point serialization requires an IEEE-754 (iec559) representation");
+                using bits_type = internal::uint_of_size_t<sizeof(V)>;
+                static_assert(not std::is_void_v<bits_type>, "[eser] to_array encodes 4- and 8-byte floating-point values only");
+                serialize_constant<Wire>(out, at, internal::bit_cast<bits_type>(value));
+            } else if constexpr (std::is_integral_v<V>) {
+                // by value, not by memory: the same bytes on any host
+                const auto bits = static_cast<std::make_unsigned_t<V>>(value);
+                for (std::size_t i = 0; i < sizeof(V); ++i) {
+                    const std::size_t shift = 8 * (Wire == endianness::little ? i : sizeof(V) - 1 - i);
+                    out[at + i] = static_cast<std::byte>(static_cast<std::uint8_t>(bits >> shift));
+                }
+            } else if constexpr (std::is_array_v<V> or internal::is_std_array_v<V>) {
+                using element = std::remove_cv_t<std::remove_reference_t<decltype(value[0])>>;
+                for (std::size_t i = 0; i < std::size(value); ++i)
+                    serialize_constant<Wire>(out, at + i * serialized_size_of<element>(), value[i]);
+            } else if constexpr (utils::is_fixed_string_v<V>) {
+                const char *chars = value.data();
+                for (std::size_t i = 0; i < V::capacity(); ++i)
+                    out[at + i] = static_cast<std::byte>(static_cast<unsigned char>(chars[i]));
+            } else if constexpr (utils::is_reflected_v<V>) {
+                if constexpr (utils::is_packed_v<V>) {
+                    std::size_t offset = at;
+                    utils::reflection_t<V>::for_each([&out, &offset, &value](auto m){
+                        using value_type = typename decltype(m)::value_type;
+                        serialize_constant<Wire>(out, offset, decltype(m)::get(value));
+                        offset += serialized_size_of<value_type>();
+                    });
+                } else {
+                    utils::reflection_t<V>::for_each([&out, at, &value](auto m){
+                        serialize_constant<Wire>(out, at + decltype(m)::offset, decltype(m)::get(value));
+                    });
+                }
+            } else {
+                static_assert(std::is_trivially_copyable_v<V> and not utils::is_bits_v<V> and not utils::is_bounded_v<V>,
+                    "[eser] to_array encodes scalars, enums, arrays, fixed_string and trivially-copyable structs");
+                static_assert(not internal::needs_byte_swap_v<Wire, V>,
+                    "[eser] trivially-copyable structs are serialized as raw bytes and cannot be "
+                    "byte-swapped; describe the members with ESER_REFLECT (eser/utils/reflect.hpp)");
+                // Padding bytes are indeterminate, so bit-casting them is not a constant expression.
+                static_assert(std::has_unique_object_representations_v<V>,
+                    "[eser] to_array bit-casts structs without ESER_REFLECT whole, which needs every byte to "
+                    "be a value byte; describe a struct with padding or floating-point members with ESER_REFLECT");
+                const auto image = internal::bit_cast<std::array<std::byte, sizeof(V)>>(value);
+                for (std::size_t i = 0; i < sizeof(V); ++i) out[at + i] = image[i];
+            }
+        }
+
+        /**
+        * @brief Encode every field of a tuple back to back with @ref serialize_constant.
+        */
+        template<endianness Wire, std::size_t N, typename... U, std::size_t... I>
+        constexpr void serialize_constant_fields(std::array<std::byte, N> &out, const std::tuple<U...> &fields, std::index_sequence<I...>) noexcept
+        {
+            constexpr std::size_t sizes[] = { serialized_size_of<U>()... };
+            std::size_t at = 0;
+            ((serialize_constant<Wire>(out, at, std::get<I>(fields)), at += sizes[I]), ...);
         }
     } // namespace details
 
@@ -110,14 +537,12 @@ namespace eser::flat{
     inline std::size_t serializer<Wire, T...>::to (std::byte *buffer, std::size_t size) &&
     {
         using namespace details;
-        constexpr std::size_t needed = serialized_size_of<T...>();
-        if (needed > size){
+        const auto start = active_observer::start();
+        if (not fits(_args, size)){
             assert(false && "Buffer size is insufficient for serialization");
-            return 0;
+            return report_encoded<observed_message_t<T...>>(start, 0);
         }
-        return std::apply([&](const auto &...args){
-            return (... + serialize_impl<Wire>(buffer, size, args));
-        }, _args);
+        return report_encoded<observed_message_t<T...>>(start, serialize_fields<Wire>(buffer, size, _args));
     }
 
     template <endianness Wire, typename... T>
@@ -139,11 +564,143 @@ namespace eser::flat{
         return std::move(*this).to(static_cast<std::byte *>(static_cast<void *>(buffer)), N);
     }
 
+    template <endianness Wire, typename... T>
+    template <typename Sink, std::enable_if_t<is_sink_v<Sink>, bool>>
+    inline std::size_t serializer<Wire, T...>::to(Sink &sink) &&
+    {
+        using namespace details;
+        const auto start = active_observer::start();
+        if (not fits(_args, sink.available())){
+            assert(false && "Sink has insufficient room for serialization");
+            return report_encoded<observed_message_t<T...>>(start, 0);
+        }
+        return report_encoded<observed_message_t<T...>>(start, serialize_fields_to<Wire>(sink, _args));
+    }
+
+    template <endianness Wire, typename... T>
+    template <std::size_t MinInPlace>
+    inline std::size_t serializer<Wire, T...>::to_segments(const_chunk *segments, std::size_t capacity,
+        std::byte *scratch, std::size_t scratch_size) &&
+    {
+        using namespace details;
+        static_assert(is_fixed_size_v<T...>,
+            "[eser] to_segments needs a fixed-size message; write bounded_vector / bounded_string "
+            "fields with to(buffer) or to(sink)");
+        constexpr auto requirements = segment_requirements<Wire, MinInPlace, T...>();
+        if (requirements.first > scratch_size or requirements.second > capacity){
+            assert(false && "Segment list or scratch buffer is insufficient for serialization");
+            return 0;
+        }
+        std::size_t count = 0;
+        std::byte *cursor = scratch;
+        segment_fields<Wire, MinInPlace>(segments, capacity, count, cursor, _args, std::index_sequence_for<T...>{});
+        return count;
+    }
+
+    template <endianness Wire, typename... T>
+    constexpr auto serializer<Wire, T...>::to_array() &&
+    {
+        using namespace details;
+        static_assert(is_fixed_size_v<T...>,
+            "[eser] to_array needs a fixed-size message; a bounded_vector / bounded_string field has no constant size");
+        static_assert(not bit_groups<T...>::any(), "[eser] to_array does not encode utils::bits fields");
+        std::array<std::byte, serialized_size_of<T...>()> out{};
+        serialize_constant_fields<Wire>(out, _args, std::index_sequence_for<T...>{});
+        return out;
+    }
+
     template <endianness Wire, typename... T>
     constexpr serializer<Wire, T...>::serializer(T&&... args)
     : _args(std::forward<T>(args)...)
     {
     }
+
+    template <endianness Wire, typename T>
+    inline std::size_t range_serializer<Wire, T>::to(std::byte *buffer, std::size_t size) &&
+    {
+        using namespace details;
+        constexpr std::size_t record_size = serialized_size_of<T>();
+        // Compare by division so `count * record_size` cannot overflow on a hostile count.
+        if (_count > size / record_size){
+            assert(false && "Buffer size is insufficient for range serialization");
+            return 0;
+        }
+        // A single memcpy when records need no conversion, one fused swap-copy for scalar records.
+        return serialize_elements<Wire>(buffer, size, _records, _count);
+    }
+
+    template <endianness Wire, typename T>
+    template <std::size_t Threshold, typename Executor>
+    inline std::size_t range_serializer<Wire, T>::to(std::byte *buffer, std::size_t size, Executor &&executor) &&
+    {
+        using namespace details;
+        constexpr std::size_t record_size = serialized_size_of<T>();
+        if (_count > size / record_size){
+            assert(false && "Buffer size is insufficient for range serialization");
+            return 0;
+        }
+        const std::size_t parts = batch_parts(_count, record_size, executor.concurrency(), Threshold);
+        if (parts <= 1) return serialize_elements<Wire>(buffer, size, _records, _count);
+
+        // each part owns a disjoint run of records and of output bytes
+        const std::size_t per_part = (_count + parts - 1) / parts;
+        executor.run(parts, [buffer, records = _records, count = _count, per_part](std::size_t part){
+            const std::size_t first = part * per_part;
+            if (first >= count) return;
+            const std::size_t n = std::min(per_part, count - first);
+            std::byte *out = buffer + first * record_size;
+            std::size_t room = n * record_size;
+            serialize_elements<Wire>(out, room, records + first, n);
+        });
+        return _count * record_size;
+    }
+
+    template <endianness Wire, typename T>
+    template <size_t N>
+    inline std::size_t range_serializer<Wire, T>::to(std::byte (&buffer)[N]) &&
+    {
+        return std::move(*this).to(buffer, N);
+    }
+
+    template <endianness Wire, typename T>
+    std::size_t range_serializer<Wire, T>::to(std::uint8_t *buffer, std::size_t size) &&
+    {
+        return std::move(*this).to(static_cast<std::byte *>(static_cast<void*>(buffer)), size);
+    }
+
+    template <endianness Wire, typename T>
+    template <size_t N>
+    std::size_t range_serializer<Wire, T>::to(std::uint8_t (&buffer)[N]) &&
+    {
+        return std::move(*this).to(static_cast<std::byte *>(static_cast<void *>(buffer)), N);
+    }
+
+    template <endianness Wire, typename T>
+    template <typename Sink, std::enable_if_t<is_sink_v<Sink>, bool>>
+    inline std::size_t range_serializer<Wire, T>::to(Sink &sink) &&
+    {
+        using namespace details;
+        constexpr std::size_t record_size = serialized_size_of<T>();
+        if (_count > sink.available() / record_size){
+            assert(false && "Sink has insufficient room for range serialization");
+            return 0;
+        }
+        const std::size_t bytes = _count * record_size;
+        if (std::byte *out = sink.contiguous(bytes)) {
+            std::size_t room = bytes;
+            serialize_elements<Wire>(out, room, _records, _count);
+            sink.advance(bytes);
+            return bytes;
+        }
+        for (std::size_t i = 0; i < _count; ++i) serialize_value_to<Wire>(sink, _records[i]);
+        return bytes;
+    }
+
+    template <endianness Wire, typename T>
+    constexpr range_serializer<Wire, T>::range_serializer(const T *records, std::size_t count)
+    : _records(records), _count(count)
+    {
+    }
 } // namespace eser::flat
     
 #endif // ESER_FLAT_SERIALIZER_TPP_
\ No newline at end of file
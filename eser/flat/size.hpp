@@ -24,12 +24,28 @@
 * - 2026-06-24
 * -     Moved out of the former `tools/utils.hpp` into `eser::flat` (flat/size.hpp);
 *       the computed size is specific to the flat format.
+* - 2026-10-14
+* -     Consecutive `utils::bits` fields are counted as one bit-packed group of
+*       `ceil(total bits / 8)` bytes (`details::bit_groups`).
+* - 2026-10-14
+* -     Added `max_serialized_size_of` and `serialized_size(values...)` for messages with
+*       length-prefixed `utils::bounded_vector` / `utils::bounded_string` fields.
+* - 2026-10-14
+* -     A struct described with `ESER_REFLECT_PACKED` counts its members only; arrays count
+*       their elements' wire size.
+* - 2026-10-14
+* -     Added `parallel_threshold` and `details::batch_parts` for the parallel bulk overloads.
 */
 #ifndef ESER_FLAT_SIZE_HPP_
 #define ESER_FLAT_SIZE_HPP_
 #include <type_traits>
 #include <cstddef>
+#include <array>
 #include "../internal/traits.hpp"
+#include "../utils/bits.hpp"
+#include "../utils/bounded_vector.hpp"
+#include "../utils/bounded_string.hpp"
+#include "../utils/reflect.hpp"
 
 namespace eser::flat
 {
@@ -43,7 +59,9 @@ namespace eser::flat
     * - Arithmetic types (e.g. int, float)
     * - Enums
     * - C-style arrays (e.g. int[4])
-    * - Trivially copyable structs/classes
+    * - Trivially copyable structs/classes (`sizeof`), or the sum of their members for a struct
+    *   described with `ESER_REFLECT_PACKED`
+    * - `utils::bits` on its own (its storage integer; see the variadic overload for packing)
     *
     * @tparam T The type whose serialized size is to be computed.
     * @return The size in bytes required to serialize T.
@@ -66,7 +84,23 @@ namespace eser::flat
             return sizeof(std::underlying_type_t<bare_t>);
         }
         else if constexpr (std::is_array_v<bare_t>) {
-            return sizeof(bare_t);
+            return std::extent_v<bare_t> * serialized_size_of<std::remove_extent_t<bare_t>>();
+        }
+        else if constexpr (internal::is_std_array_v<bare_t>) {
+            return std::tuple_size_v<bare_t> * serialized_size_of<typename bare_t::value_type>();
+        }
+        else if constexpr (utils::is_packed_v<bare_t>) {
+            std::size_t members = 0;
+            utils::reflection_t<bare_t>::for_each([&members](auto m){
+                members += serialized_size_of<typename decltype(m)::value_type>();
+            });
+            return members;
+        }
+        else if constexpr (utils::is_bounded_v<bare_t>) {
+            static_assert(internal::always_false_v<bare_t>,
+                "[eser] a bounded_vector / bounded_string field has no fixed wire size; size buffers "
+                "with max_serialized_size_of<T...>() or serialized_size(values...)");
+            return 0;
         }
         else if constexpr (std::is_class_v<bare_t> && std::is_trivially_copyable_v<bare_t>) {
             return sizeof(bare_t);
@@ -84,13 +118,219 @@ namespace eser::flat
         }
     }
 
+    /**
+    * @brief The largest number of bytes a value of type `T` can occupy on the wire.
+    *
+    * For a `utils::bounded_vector<E, N>` or `utils::bounded_string<N>` this is its length prefix
+    * plus `N` elements; for every other type it is `serialized_size_of<T>()`.
+    *
+    * @tparam T The type whose maximum serialized size is to be computed.
+    * @return The maximum size in bytes.
+    */
+    template<typename T>
+    constexpr std::size_t max_serialized_size_of()
+    {
+        using bare_t = std::remove_cv_t<std::remove_reference_t<T>>;
+        if constexpr (utils::is_bounded_v<bare_t>)
+            return sizeof(typename bare_t::length_type) + bare_t::capacity() * serialized_size_of<typename bare_t::value_type>();
+        else
+            return serialized_size_of<bare_t>();
+    }
+
+    namespace details{
+        /**
+        * @var is_fixed_size_v
+        * @brief Whether every field of `T...` has a fixed wire size (no bounded field).
+        */
+        template<typename... T>
+        inline constexpr bool is_fixed_size_v = (... and not utils::is_bounded_v<std::remove_cv_t<std::remove_reference_t<T>>>);
+
+        /**
+        * @brief The bytes a bounded field of type `T` leaves unused below its maximum; 0 for any
+        *        other field.
+        */
+        template<typename T>
+        constexpr std::size_t unused_bytes(const T &value) noexcept
+        {
+            if constexpr (utils::is_bounded_v<T>)
+                return (T::capacity() - value.size()) * serialized_size_of<typename T::value_type>();
+            else
+                return (void)value, 0;
+        }
+
+        /**
+        * @brief The element bytes a bounded field of type `T` can hold (0 for any other field):
+        *        the difference between its maximum and minimum wire size.
+        */
+        template<typename T>
+        constexpr std::size_t payload_capacity() noexcept
+        {
+            using bare_t = std::remove_cv_t<std::remove_reference_t<T>>;
+            if constexpr (utils::is_bounded_v<bare_t>)
+                return bare_t::capacity() * serialized_size_of<typename bare_t::value_type>();
+            else
+                return 0;
+        }
+
+        /**
+        * @brief The field width of `T` if it is a `utils::bits`, otherwise 0.
+        */
+        template<typename T>
+        constexpr std::size_t bit_width_of() noexcept
+        {
+            using bare_t = std::remove_cv_t<std::remove_reference_t<T>>;
+            if constexpr (utils::is_bits_v<bare_t>) return bare_t::width;
+            else return 0;
+        }
+
+        /**
+        * @brief The bit-group layout of the message `T...`.
+        *
+        * A maximal run of two or more consecutive `utils::bits` fields is one group: its fields
+        * are packed back to back and the group takes `ceil(total bits / 8)` bytes. Every index
+        * query is `constexpr`; a field outside a group reports its own `max_serialized_size_of`
+        * (which is its exact size unless it is a bounded field).
+        *
+        * @tparam T... The message's field types, in wire order (cv/ref qualifiers are ignored).
+        */
+        template<typename... T>
+        struct bit_groups{
+            /**
+            * @brief The width of every field in bits (0 for a field that is not `utils::bits`).
+            */
+            static constexpr std::array<std::size_t, sizeof...(T)> widths = { bit_width_of<T>()... };
+
+            /**
+            * @brief Whether any field of the message is bit-packed.
+            */
+            static constexpr bool any() noexcept
+            {
+                for (std::size_t i = 0; i < sizeof...(T); ++i) if (packed(i)) return true;
+                return false;
+            }
+
+            /**
+            * @brief Whether field `i` belongs to a group.
+            */
+            static constexpr bool packed(std::size_t i) noexcept
+            {
+                return widths[i] != 0 and
+                    ((i > 0 and widths[i - 1] != 0) or (i + 1 < sizeof...(T) and widths[i + 1] != 0));
+            }
+
+            /**
+            * @brief The index of the first field of the group field `i` belongs to.
+            */
+            static constexpr std::size_t first(std::size_t i) noexcept
+            {
+                while (i > 0 and widths[i - 1] != 0) --i;
+                return i;
+            }
+
+            /**
+            * @brief Whether field `i` is the last field of its group.
+            */
+            static constexpr bool last(std::size_t i) noexcept
+            {
+                return packed(i) and (i + 1 == sizeof...(T) or widths[i + 1] == 0);
+            }
+
+            /**
+            * @brief The bit offset of field `i` from the start of its group.
+            */
+            static constexpr std::size_t bit_offset(std::size_t i) noexcept
+            {
+                std::size_t offset = 0;
+                for (std::size_t k = first(i); k < i; ++k) offset += widths[k];
+                return offset;
+            }
+
+            /**
+            * @brief The total width in bits of the group field `i` belongs to.
+            */
+            static constexpr std::size_t group_bits(std::size_t i) noexcept
+            {
+                std::size_t total = 0;
+                for (std::size_t k = first(i); k < sizeof...(T) and widths[k] != 0; ++k) total += widths[k];
+                return total;
+            }
+
+            /**
+            * @brief The number of fields in the group field `i` belongs to.
+            */
+            static constexpr std::size_t members(std::size_t i) noexcept
+            {
+                std::size_t count = 0;
+                for (std::size_t k = first(i); k < sizeof...(T) and widths[k] != 0; ++k) ++count;
+                return count;
+            }
+
+            /**
+            * @brief The wire bytes of the group field `i` belongs to.
+            */
+            static constexpr std::size_t group_size(std::size_t i) noexcept
+            {
+                return (group_bits(i) + 7) / 8;
+            }
+
+            /**
+            * @brief The widest group of the message in bits (0 if nothing is packed).
+            */
+            static constexpr std::size_t widest() noexcept
+            {
+                std::size_t widest = 0;
+                for (std::size_t i = 0; i < sizeof...(T); ++i)
+                    if (packed(i) and group_bits(i) > widest) widest = group_bits(i);
+                return widest;
+            }
+
+            /**
+            * @brief The bytes field `i` adds to the message.
+            *
+            * The whole group is charged to its first field; the other members of a group add 0.
+            */
+            static constexpr std::size_t wire_size(std::size_t i) noexcept
+            {
+                constexpr std::array<std::size_t, sizeof...(T)> sizes = { max_serialized_size_of<T>()... };
+                if (not packed(i)) return sizes[i];
+                return first(i) == i ? group_size(i) : 0;
+            }
+
+            /**
+            * @brief The byte offset of field `i` (of its group, for a packed field) from the start.
+            */
+            static constexpr std::size_t offset(std::size_t i) noexcept
+            {
+                const std::size_t start = packed(i) ? first(i) : i;
+                std::size_t bytes = 0;
+                for (std::size_t k = 0; k < start; ++k) bytes += wire_size(k);
+                return bytes;
+            }
+
+            /**
+            * @brief The serialized size of the whole message.
+            */
+            static constexpr std::size_t size() noexcept
+            {
+                std::size_t bytes = 0;
+                for (std::size_t i = 0; i < sizeof...(T); ++i) bytes += wire_size(i);
+                return bytes;
+            }
+
+            static_assert(widest() <= 64,
+                "[eser] a group of consecutive bits<> fields may span at most 64 bits; "
+                "split it with a byte-aligned field");
+        };
+    } // namespace details
+
     /**
     * @brief Computes the total serialized size (in bytes) of multiple types.
     *
     * Computes, at compile time, how many bytes would be required
     * to serialize a sequence of types T... into a flat byte stream.
     *
-    * This function aggregates the individual sizes of each type.
+    * This function aggregates the individual sizes of each type. Two or more consecutive
+    * `utils::bits` fields count as one bit-packed group of `ceil(total bits / 8)` bytes.
     *
     * @tparam T... The types whose total serialized size is to be computed.
     * @return The total size in bytes required to serialize all types in T...
@@ -103,9 +343,81 @@ namespace eser::flat
     template<typename... T, std::enable_if_t<(sizeof...(T) > 1), bool> = true>
     constexpr std::size_t serialized_size_of()
     {
-        return (... + serialized_size_of<T>());
+        static_assert(details::is_fixed_size_v<T...>,
+            "[eser] a message with bounded_vector / bounded_string fields has no fixed wire size; "
+            "size buffers with max_serialized_size_of<T...>() or serialized_size(values...)");
+        if constexpr ((... or utils::is_bits_v<std::remove_cv_t<std::remove_reference_t<T>>>))
+            return details::bit_groups<T...>::size();
+        else
+            return (... + serialized_size_of<T>());
     }
 
+    /**
+    * @brief The largest number of bytes the message `T...` can occupy on the wire.
+    *
+    * Equal to `serialized_size_of<T...>()` for a fixed-size message; each bounded field counts
+    * with its full capacity. Use it to size a static buffer for any value of the message.
+    *
+    * @tparam T... The message's field types.
+    * @return The maximum size in bytes.
+    *
+    * @see max_serialized_size_of<T>()
+    */
+    template<typename... T, std::enable_if_t<(sizeof...(T) > 1), bool> = true>
+    constexpr std::size_t max_serialized_size_of()
+    {
+        if constexpr ((... or utils::is_bits_v<std::remove_cv_t<std::remove_reference_t<T>>>))
+            return details::bit_groups<T...>::size();
+        else
+            return (... + max_serialized_size_of<T>());
+    }
+
+    /**
+    * @brief The exact number of bytes the given values occupy on the wire.
+    *
+    * A bounded field counts its length prefix and its `size()` used elements; every other field
+    * counts its fixed size. For a fixed-size message this is `serialized_size_of<T...>()`.
+    *
+    * @tparam T... The deduced field types.
+    * @param values The values to measure.
+    * @return The size in bytes `serialize(values...).to(...)` writes.
+    */
+    template<typename... T>
+    constexpr std::size_t serialized_size(const T &...values) noexcept
+    {
+        static_assert(sizeof...(T) > 0, "serialized_size needs at least one value");
+        return max_serialized_size_of<T...>() - (std::size_t{0} + ... + details::unused_bytes(values));
+    }
+
+    /**
+    * @brief The default smallest share of a batch, in bytes, that the parallel bulk overloads hand
+    *        to one thread.
+    *
+    * Starting a thread and joining it costs about as much as copying a few hundred kilobytes, so
+    * a batch is split into at most `bytes / parallel_threshold` parts; below it the batch is one
+    * `memcpy` (or one swap kernel) on the calling thread.
+    */
+    inline constexpr std::size_t parallel_threshold = std::size_t{1} << 20;
+
+    namespace details{
+        /**
+        * @brief The number of parts a batch of `count` records is split into.
+        *
+        * @param count The number of records.
+        * @param record_size The wire size of one record.
+        * @param concurrency The executor's concurrency.
+        * @param threshold The smallest part, in bytes.
+        * @return `min(concurrency, count * record_size / threshold)`, and at least 1.
+        */
+        constexpr std::size_t batch_parts(std::size_t count, std::size_t record_size, std::size_t concurrency, std::size_t threshold) noexcept
+        {
+            // records per part, rounded up: dividing the count keeps count * record_size from overflowing
+            const std::size_t per_part = threshold / record_size + (threshold % record_size != 0);
+            const std::size_t by_size = per_part == 0 ? count : count / per_part;
+            const std::size_t parts = by_size < concurrency ? by_size : concurrency;
+            return parts == 0 ? 1 : parts;
+        }
+    } // namespace details
 } // namespace eser::flat
 
 #endif // ESER_FLAT_SIZE_HPP_
@@ -0,0 +1,338 @@
+/**
+* @file stream.hpp
+*
+* @ingroup eser_flat
+*
+* @brief Non-contiguous byte sinks and sources: chunk lists, ring buffers and plain spans.
+*
+* `serializer::to(buffer, size)` and `deserialize(data, length)` need one contiguous buffer. DMA
+* rings and scatter/gather I/O hand out several disjoint regions instead. The types in this file
+* present such memory as a **sink** (to serialize into) or a **source** (to deserialize from):
+*
+* | Sink | Source | Memory |
+* |---|---|---|
+* | `span_sink` | `span_source` | one contiguous buffer |
+* | `chunk_sink` | `chunk_source` | an `iovec`-like list of `chunk` / `const_chunk` regions |
+* | `ring_sink` | `ring_source` | a circular buffer that may wrap around its end |
+*
+* Pass a sink to `serialize(...).to(sink)` (or `serialize_range`, `encoder::encode_into`) and a
+* source to `deserialize(source)`. A field that lies entirely inside the current region is still
+* written or read in place with the direct `memcpy` / swap kernels; only a field that straddles a
+* region boundary is split, through a small stack temporary of its own size.
+*
+* ## The sink / source concept
+*
+* Any type with the following members can be used; `is_sink_v` / `is_source_v` check for them.
+*
+* | Sink member | Source member | Meaning |
+* |---|---|---|
+* | `std::size_t available() const` | same | bytes that can still be written / read |
+* | `std::byte* contiguous(std::size_t n)` | `const std::byte* contiguous(std::size_t n)` | the cursor, if the next `n` bytes are in one region; `nullptr` otherwise |
+* | `void advance(std::size_t n)` | same | move the cursor past `n` bytes obtained from `contiguous` |
+* | `void write(const std::byte* src, std::size_t n)` | `void read(std::byte* dst, std::size_t n)` | copy `n <= available()` bytes across regions |
+*
+* ```cpp
+* // A UART DMA ring: 9 bytes of free space left before the end of storage, the rest at the front.
+* ring_sink tx(dma_storage, sizeof(dma_storage), dma_head, dma_free);
+* serialize<endianness::big>(id, timestamp, samples).to(tx);
+* dma_head = tx.position();   // publish the new write index
+* ```
+*
+* @note The sinks and sources reference caller memory and do not own it.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_FLAT_STREAM_HPP_
+#define ESER_FLAT_STREAM_HPP_
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "../internal/byte.hpp"
+
+namespace eser::flat{
+    /**
+    * @struct chunk
+    * @brief One writable region of a scatter list (the equivalent of a POSIX `iovec`).
+    */
+    struct chunk{
+        std::byte *data;   ///< First byte of the region.
+        std::size_t size;  ///< Size of the region in bytes.
+    };
+
+    /**
+    * @struct const_chunk
+    * @brief One read-only region of a gather list.
+    */
+    struct const_chunk{
+        const std::byte *data; ///< First byte of the region.
+        std::size_t size;      ///< Size of the region in bytes.
+    };
+
+    /**
+    * @class span_sink
+    * @brief A sink over a single contiguous buffer.
+    *
+    * Mostly useful to write several messages back-to-back into one buffer: the sink keeps the
+    * cursor between `to(sink)` calls.
+    */
+    class span_sink{
+    public:
+        /**
+        * @brief Construct a sink over `size` bytes at `data`.
+        * @param data The output buffer.
+        * @param size The size of the output buffer in bytes.
+        */
+        constexpr span_sink(std::byte *data, std::size_t size) noexcept;
+
+        [[nodiscard]] constexpr std::size_t available() const noexcept;  ///< Bytes left to write.
+        [[nodiscard]] constexpr std::size_t written() const noexcept;    ///< Bytes written so far.
+        [[nodiscard]] std::byte *contiguous(std::size_t n) noexcept;     ///< Cursor if `n` bytes remain, else `nullptr`.
+        void advance(std::size_t n) noexcept;                            ///< Commit `n` bytes written in place.
+        void write(const std::byte *src, std::size_t n) noexcept;        ///< Copy `n <= available()` bytes.
+
+    private:
+        std::byte *_data;     ///< The output buffer.
+        std::size_t _size;    ///< The size of the output buffer.
+        std::size_t _offset;  ///< The number of bytes written.
+    };
+
+    /**
+    * @class chunk_sink
+    * @brief A sink over an ordered list of writable regions, filled front to back.
+    *
+    * Empty regions are skipped. The region list itself must outlive the sink.
+    */
+    class chunk_sink{
+    public:
+        /**
+        * @brief Construct a sink over `count` regions.
+        * @param chunks The regions, in output order.
+        * @param count The number of regions.
+        */
+        chunk_sink(const chunk *chunks, std::size_t count) noexcept;
+
+        /**
+        * @brief Construct a sink over a fixed array of regions.
+        * @tparam N The number of regions.
+        * @param chunks The regions, in output order.
+        */
+        template<std::size_t N>
+        explicit chunk_sink(const chunk (&chunks)[N]) noexcept;
+
+        [[nodiscard]] constexpr std::size_t available() const noexcept;  ///< Bytes left in all remaining regions.
+        [[nodiscard]] constexpr std::size_t written() const noexcept;    ///< Bytes written so far.
+        [[nodiscard]] std::byte *contiguous(std::size_t n) noexcept;     ///< Cursor if the current region holds `n` more bytes.
+        void advance(std::size_t n) noexcept;                            ///< Commit `n` bytes written in place.
+        void write(const std::byte *src, std::size_t n) noexcept;        ///< Copy `n <= available()` bytes across regions.
+
+    private:
+        const chunk *_chunks;     ///< The region list.
+        std::size_t _count;       ///< The number of regions.
+        std::size_t _index;       ///< The current region.
+        std::size_t _offset;      ///< The cursor inside the current region.
+        std::size_t _available;   ///< Bytes left in all remaining regions.
+        std::size_t _written;     ///< Bytes written so far.
+
+        void skip_full() noexcept;  ///< Move past exhausted or empty regions.
+    };
+
+    /**
+    * @class ring_sink
+    * @brief A sink over the free space of a circular buffer, wrapping from its end to its start.
+    *
+    * The sink is given the producer's write index and the number of free bytes; after writing,
+    * `position()` is the new write index to publish.
+    */
+    class ring_sink{
+    public:
+        /**
+        * @brief Construct a sink over the free space of a ring.
+        * @param storage The ring storage.
+        * @param capacity The size of the storage in bytes.
+        * @param head The write index (`< capacity`).
+        * @param free The number of free bytes starting at `head` (`<= capacity`).
+        */
+        constexpr ring_sink(std::byte *storage, std::size_t capacity, std::size_t head, std::size_t free) noexcept;
+
+        [[nodiscard]] constexpr std::size_t available() const noexcept;  ///< Free bytes left.
+        [[nodiscard]] constexpr std::size_t written() const noexcept;    ///< Bytes written so far.
+        [[nodiscard]] constexpr std::size_t position() const noexcept;   ///< The current write index.
+        [[nodiscard]] std::byte *contiguous(std::size_t n) noexcept;     ///< Cursor if `n` bytes fit before the wrap.
+        void advance(std::size_t n) noexcept;                            ///< Commit `n` bytes written in place.
+        void write(const std::byte *src, std::size_t n) noexcept;        ///< Copy `n <= available()` bytes, wrapping.
+
+    private:
+        std::byte *_storage;      ///< The ring storage.
+        std::size_t _capacity;    ///< The size of the storage.
+        std::size_t _head;        ///< The write index.
+        std::size_t _free;        ///< Free bytes left.
+        std::size_t _written;     ///< Bytes written so far.
+    };
+
+    /**
+    * @class span_source
+    * @brief A source over a single contiguous buffer.
+    */
+    class span_source{
+    public:
+        /**
+        * @brief Construct a source over `size` bytes at `data`.
+        * @param data The input buffer.
+        * @param size The number of readable bytes.
+        */
+        constexpr span_source(const std::byte *data, std::size_t size) noexcept;
+
+        [[nodiscard]] constexpr std::size_t available() const noexcept;      ///< Bytes left to read.
+        [[nodiscard]] constexpr std::size_t consumed() const noexcept;       ///< Bytes read so far.
+        [[nodiscard]] const std::byte *contiguous(std::size_t n) noexcept;   ///< Cursor if `n` bytes remain, else `nullptr`.
+        void advance(std::size_t n) noexcept;                                ///< Consume `n` bytes read in place.
+        void read(std::byte *dst, std::size_t n) noexcept;                   ///< Copy out `n <= available()` bytes.
+
+    private:
+        const std::byte *_data;   ///< The input buffer.
+        std::size_t _size;        ///< The number of readable bytes.
+        std::size_t _offset;      ///< The number of bytes read.
+    };
+
+    /**
+    * @class chunk_source
+    * @brief A source over an ordered list of read-only regions, consumed front to back.
+    *
+    * Empty regions are skipped. The region list itself must outlive the source.
+    */
+    class chunk_source{
+    public:
+        /**
+        * @brief Construct a source over `count` regions.
+        * @param chunks The regions, in stream order.
+        * @param count The number of regions.
+        */
+        chunk_source(const const_chunk *chunks, std::size_t count) noexcept;
+
+        /**
+        * @brief Construct a source over a fixed array of regions.
+        * @tparam N The number of regions.
+        * @param chunks The regions, in stream order.
+        */
+        template<std::size_t N>
+        explicit chunk_source(const const_chunk (&chunks)[N]) noexcept;
+
+        [[nodiscard]] constexpr std::size_t available() const noexcept;      ///< Bytes left in all remaining regions.
+        [[nodiscard]] constexpr std::size_t consumed() const noexcept;       ///< Bytes read so far.
+        [[nodiscard]] const std::byte *contiguous(std::size_t n) noexcept;   ///< Cursor if the current region holds `n` more bytes.
+        void advance(std::size_t n) noexcept;                                ///< Consume `n` bytes read in place.
+        void read(std::byte *dst, std::size_t n) noexcept;                   ///< Copy out `n <= available()` bytes across regions.
+
+    private:
+        const const_chunk *_chunks;   ///< The region list.
+        std::size_t _count;           ///< The number of regions.
+        std::size_t _index;           ///< The current region.
+        std::size_t _offset;          ///< The cursor inside the current region.
+        std::size_t _available;       ///< Bytes left in all remaining regions.
+        std::size_t _consumed;        ///< Bytes read so far.
+
+        void skip_empty() noexcept;   ///< Move past exhausted or empty regions.
+    };
+
+    /**
+    * @class ring_source
+    * @brief A source over the filled part of a circular buffer, wrapping from its end to its start.
+    *
+    * The source is given the consumer's read index and the number of buffered bytes; after
+    * reading, `position()` is the new read index to publish.
+    */
+    class ring_source{
+    public:
+        /**
+        * @brief Construct a source over the buffered bytes of a ring.
+        * @param storage The ring storage.
+        * @param capacity The size of the storage in bytes.
+        * @param tail The read index (`< capacity`).
+        * @param used The number of buffered bytes starting at `tail` (`<= capacity`).
+        */
+        constexpr ring_source(const std::byte *storage, std::size_t capacity, std::size_t tail, std::size_t used) noexcept;
+
+        [[nodiscard]] constexpr std::size_t available() const noexcept;      ///< Buffered bytes left.
+        [[nodiscard]] constexpr std::size_t consumed() const noexcept;       ///< Bytes read so far.
+        [[nodiscard]] constexpr std::size_t position() const noexcept;       ///< The current read index.
+        [[nodiscard]] const std::byte *contiguous(std::size_t n) noexcept;   ///< Cursor if `n` bytes lie before the wrap.
+        void advance(std::size_t n) noexcept;                                ///< Consume `n` bytes read in place.
+        void read(std::byte *dst, std::size_t n) noexcept;                   ///< Copy out `n <= available()` bytes, wrapping.
+
+    private:
+        const std::byte *_storage;    ///< The ring storage.
+        std::size_t _capacity;        ///< The size of the storage.
+        std::size_t _tail;            ///< The read index.
+        std::size_t _used;            ///< Buffered bytes left.
+        std::size_t _consumed;        ///< Bytes read so far.
+    };
+
+    /**
+    * @struct is_sink
+    * @brief Detects a type that models the sink concept (see the file documentation).
+    * @tparam T The type to inspect.
+    */
+    template<typename T, typename = void>
+    struct is_sink : std::false_type {};
+
+    /**
+    * @brief Specialization of `is_sink` for types with `available`, `contiguous`, `advance` and `write`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    struct is_sink<T, std::void_t<
+        decltype(static_cast<std::size_t>(std::declval<const T&>().available())),
+        decltype(static_cast<std::byte*>(std::declval<T&>().contiguous(std::size_t{}))),
+        decltype(std::declval<T&>().advance(std::size_t{})),
+        decltype(std::declval<T&>().write(std::declval<const std::byte*>(), std::size_t{}))
+    >> : std::true_type {};
+
+    /**
+    * @var is_sink_v
+    * @brief Convenience variable template for `is_sink<T>::value`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    inline constexpr bool is_sink_v = is_sink<T>::value;
+
+    /**
+    * @struct is_source
+    * @brief Detects a type that models the source concept (see the file documentation).
+    * @tparam T The type to inspect.
+    */
+    template<typename T, typename = void>
+    struct is_source : std::false_type {};
+
+    /**
+    * @brief Specialization of `is_source` for types with `available`, `contiguous`, `advance` and `read`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    struct is_source<T, std::void_t<
+        decltype(static_cast<std::size_t>(std::declval<const T&>().available())),
+        decltype(static_cast<const std::byte*>(std::declval<T&>().contiguous(std::size_t{}))),
+        decltype(std::declval<T&>().advance(std::size_t{})),
+        decltype(std::declval<T&>().read(std::declval<std::byte*>(), std::size_t{}))
+    >> : std::true_type {};
+
+    /**
+    * @var is_source_v
+    * @brief Convenience variable template for `is_source<T>::value`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    inline constexpr bool is_source_v = is_source<T>::value;
+} // namespace eser::flat
+
+#include "stream.tpp"
+#endif // ESER_FLAT_STREAM_HPP_
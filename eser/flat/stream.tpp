@@ -0,0 +1,287 @@
+/**
+* @file stream.tpp
+*
+* @brief Definition of functionality in stream.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+* - 2026-10-14
+*       `ring_sink::write` and `ring_source::read` wrap without `%`, so a zero-capacity ring is safe.
+*/
+#ifndef ESER_FLAT_STREAM_TPP_
+#define ESER_FLAT_STREAM_TPP_
+#include "stream.hpp"
+#include <cassert>
+#include <cstring>
+
+namespace eser::flat{
+    constexpr span_sink::span_sink(std::byte *data, std::size_t size) noexcept
+    : _data(data), _size(size), _offset(0)
+    {
+    }
+
+    constexpr std::size_t span_sink::available() const noexcept
+    {
+        return _size - _offset;
+    }
+
+    constexpr std::size_t span_sink::written() const noexcept
+    {
+        return _offset;
+    }
+
+    inline std::byte *span_sink::contiguous(std::size_t n) noexcept
+    {
+        return n <= available() ? _data + _offset : nullptr;
+    }
+
+    inline void span_sink::advance(std::size_t n) noexcept
+    {
+        assert(n <= available() && "span_sink advanced past its end");
+        _offset += n;
+    }
+
+    inline void span_sink::write(const std::byte *src, std::size_t n) noexcept
+    {
+        assert(n <= available() && "span_sink write past its end");
+        if (n != 0) std::memcpy(_data + _offset, src, n);
+        _offset += n;
+    }
+
+    inline chunk_sink::chunk_sink(const chunk *chunks, std::size_t count) noexcept
+    : _chunks(chunks), _count(count), _index(0), _offset(0), _available(0), _written(0)
+    {
+        for (std::size_t i = 0; i < count; ++i) _available += chunks[i].size;
+        skip_full();
+    }
+
+    template<std::size_t N>
+    inline chunk_sink::chunk_sink(const chunk (&chunks)[N]) noexcept
+    : chunk_sink(chunks, N)
+    {
+    }
+
+    constexpr std::size_t chunk_sink::available() const noexcept
+    {
+        return _available;
+    }
+
+    constexpr std::size_t chunk_sink::written() const noexcept
+    {
+        return _written;
+    }
+
+    inline std::byte *chunk_sink::contiguous(std::size_t n) noexcept
+    {
+        if (_index == _count) return nullptr;
+        return n <= _chunks[_index].size - _offset ? _chunks[_index].data + _offset : nullptr;
+    }
+
+    inline void chunk_sink::advance(std::size_t n) noexcept
+    {
+        assert(_index < _count ? n <= _chunks[_index].size - _offset : n == 0);
+        _offset += n, _available -= n, _written += n;
+        skip_full();
+    }
+
+    inline void chunk_sink::write(const std::byte *src, std::size_t n) noexcept
+    {
+        assert(n <= _available && "chunk_sink write past its end");
+        while (n != 0) {
+            const std::size_t room = _chunks[_index].size - _offset;
+            const std::size_t step = n < room ? n : room;
+            std::memcpy(_chunks[_index].data + _offset, src, step);
+            src += step, n -= step;
+            advance(step);
+        }
+    }
+
+    inline void chunk_sink::skip_full() noexcept
+    {
+        while (_index < _count and _offset == _chunks[_index].size) ++_index, _offset = 0;
+    }
+
+    constexpr ring_sink::ring_sink(std::byte *storage, std::size_t capacity, std::size_t head, std::size_t free) noexcept
+    : _storage(storage), _capacity(capacity), _head(head), _free(free), _written(0)
+    {
+    }
+
+    constexpr std::size_t ring_sink::available() const noexcept
+    {
+        return _free;
+    }
+
+    constexpr std::size_t ring_sink::written() const noexcept
+    {
+        return _written;
+    }
+
+    constexpr std::size_t ring_sink::position() const noexcept
+    {
+        return _head;
+    }
+
+    inline std::byte *ring_sink::contiguous(std::size_t n) noexcept
+    {
+        return n <= _free and n <= _capacity - _head ? _storage + _head : nullptr;
+    }
+
+    inline void ring_sink::advance(std::size_t n) noexcept
+    {
+        assert(n <= _free and n <= _capacity - _head && "ring_sink advanced past the wrap");
+        _head += n, _free -= n, _written += n;
+        if (_head == _capacity) _head = 0;
+    }
+
+    inline void ring_sink::write(const std::byte *src, std::size_t n) noexcept
+    {
+        assert(n <= _free && "ring_sink write past its free space");
+        const std::size_t before_wrap = _capacity - _head;
+        const std::size_t first = n < before_wrap ? n : before_wrap;
+        if (first != 0) std::memcpy(_storage + _head, src, first);
+        if (n != first) std::memcpy(_storage, src + first, n - first);
+        // wrap without `% _capacity`, which a zero-capacity ring would divide by
+        _head = n < before_wrap ? _head + n : n - before_wrap;
+        _free -= n, _written += n;
+    }
+
+    constexpr span_source::span_source(const std::byte *data, std::size_t size) noexcept
+    : _data(data), _size(size), _offset(0)
+    {
+    }
+
+    constexpr std::size_t span_source::available() const noexcept
+    {
+        return _size - _offset;
+    }
+
+    constexpr std::size_t span_source::consumed() const noexcept
+    {
+        return _offset;
+    }
+
+    inline const std::byte *span_source::contiguous(std::size_t n) noexcept
+    {
+        return n <= available() ? _data + _offset : nullptr;
+    }
+
+    inline void span_source::advance(std::size_t n) noexcept
+    {
+        assert(n <= available() && "span_source advanced past its end");
+        _offset += n;
+    }
+
+    inline void span_source::read(std::byte *dst, std::size_t n) noexcept
+    {
+        assert(n <= available() && "span_source read past its end");
+        if (n != 0) std::memcpy(dst, _data + _offset, n);
+        _offset += n;
+    }
+
+    inline chunk_source::chunk_source(const const_chunk *chunks, std::size_t count) noexcept
+    : _chunks(chunks), _count(count), _index(0), _offset(0), _available(0), _consumed(0)
+    {
+        for (std::size_t i = 0; i < count; ++i) _available += chunks[i].size;
+        skip_empty();
+    }
+
+    template<std::size_t N>
+    inline chunk_source::chunk_source(const const_chunk (&chunks)[N]) noexcept
+    : chunk_source(chunks, N)
+    {
+    }
+
+    constexpr std::size_t chunk_source::available() const noexcept
+    {
+        return _available;
+    }
+
+    constexpr std::size_t chunk_source::consumed() const noexcept
+    {
+        return _consumed;
+    }
+
+    inline const std::byte *chunk_source::contiguous(std::size_t n) noexcept
+    {
+        if (_index == _count) return nullptr;
+        return n <= _chunks[_index].size - _offset ? _chunks[_index].data + _offset : nullptr;
+    }
+
+    inline void chunk_source::advance(std::size_t n) noexcept
+    {
+        assert(_index < _count ? n <= _chunks[_index].size - _offset : n == 0);
+        _offset += n, _available -= n, _consumed += n;
+        skip_empty();
+    }
+
+    inline void chunk_source::read(std::byte *dst, std::size_t n) noexcept
+    {
+        assert(n <= _available && "chunk_source read past its end");
+        while (n != 0) {
+            const std::size_t left = _chunks[_index].size - _offset;
+            const std::size_t step = n < left ? n : left;
+            std::memcpy(dst, _chunks[_index].data + _offset, step);
+            dst += step, n -= step;
+            advance(step);
+        }
+    }
+
+    inline void chunk_source::skip_empty() noexcept
+    {
+        while (_index < _count and _offset == _chunks[_index].size) ++_index, _offset = 0;
+    }
+
+    constexpr ring_source::ring_source(const std::byte *storage, std::size_t capacity, std::size_t tail, std::size_t used) noexcept
+    : _storage(storage), _capacity(capacity), _tail(tail), _used(used), _consumed(0)
+    {
+    }
+
+    constexpr std::size_t ring_source::available() const noexcept
+    {
+        return _used;
+    }
+
+    constexpr std::size_t ring_source::consumed() const noexcept
+    {
+        return _consumed;
+    }
+
+    constexpr std::size_t ring_source::position() const noexcept
+    {
+        return _tail;
+    }
+
+    inline const std::byte *ring_source::contiguous(std::size_t n) noexcept
+    {
+        return n <= _used and n <= _capacity - _tail ? _storage + _tail : nullptr;
+    }
+
+    inline void ring_source::advance(std::size_t n) noexcept
+    {
+        assert(n <= _used and n <= _capacity - _tail && "ring_source advanced past the wrap");
+        _tail += n, _used -= n, _consumed += n;
+        if (_tail == _capacity) _tail = 0;
+    }
+
+    inline void ring_source::read(std::byte *dst, std::size_t n) noexcept
+    {
+        assert(n <= _used && "ring_source read past its buffered bytes");
+        const std::size_t before_wrap = _capacity - _tail;
+        const std::size_t first = n < before_wrap ? n : before_wrap;
+        if (first != 0) std::memcpy(dst, _storage + _tail, first);
+        if (n != first) std::memcpy(dst + first, _storage, n - first);
+        _tail = n < before_wrap ? _tail + n : n - before_wrap;   // no `% _capacity` (see ring_sink::write)
+        _used -= n, _consumed += n;
+    }
+} // namespace eser::flat
+
+#endif // ESER_FLAT_STREAM_TPP_
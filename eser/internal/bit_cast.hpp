@@ -0,0 +1,74 @@
+/**
+* @file bit_cast.hpp
+*
+* @brief Internal `bit_cast`: reinterpret an object representation, in constant expressions where
+*        the compiler allows it.
+*
+* @ingroup eser_internal
+*
+* @warning Implementation detail. Do not include directly or depend on `eser::internal`; it is not
+*          part of the public API and may change between releases.
+*
+* C++17 has no `std::bit_cast`, but GCC 11+, Clang 9+ and MSVC 19.26+ provide the builtin it is
+* implemented with (`__builtin_bit_cast`) in every language mode. Where it exists,
+* `ESER_CONSTEXPR_BIT_CAST` is defined to 1 and @ref bit_cast is `constexpr`; elsewhere it is a
+* `memcpy`, which works at run time only.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_INTERNAL_BIT_CAST_HPP_
+#define ESER_INTERNAL_BIT_CAST_HPP_
+#include <cstring>
+#include <type_traits>
+
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_bit_cast)
+        #define ESER_CONSTEXPR_BIT_CAST 1
+    #endif
+#endif
+#if !defined(ESER_CONSTEXPR_BIT_CAST) && defined(_MSC_VER) && _MSC_VER >= 1926
+    #define ESER_CONSTEXPR_BIT_CAST 1
+#endif
+
+namespace eser::internal{
+    /**
+    * @brief The value of type `To` with the object representation of `from`.
+    *
+    * @tparam To A trivially copyable type of the same size as `From`.
+    * @tparam From A trivially copyable type.
+    * @param from The value to reinterpret.
+    * @return The reinterpreted value; usable in constant expressions when
+    *         `ESER_CONSTEXPR_BIT_CAST` is defined.
+    */
+    template<typename To, typename From>
+#if defined(ESER_CONSTEXPR_BIT_CAST)
+    constexpr
+#else
+    inline
+#endif
+    To bit_cast(const From &from) noexcept
+    {
+        static_assert(sizeof(To) == sizeof(From), "bit_cast between types of different sizes");
+        static_assert(std::is_trivially_copyable_v<To> and std::is_trivially_copyable_v<From>,
+            "bit_cast requires trivially copyable types");
+#if defined(ESER_CONSTEXPR_BIT_CAST)
+        return __builtin_bit_cast(To, from);
+#else
+        To to;
+        std::memcpy(&to, &from, sizeof(To));
+        return to;
+#endif
+    }
+} // namespace eser::internal
+
+#endif // ESER_INTERNAL_BIT_CAST_HPP_
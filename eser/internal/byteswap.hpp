@@ -0,0 +1,260 @@
+/**
+* @file byteswap.hpp
+*
+* @brief Internal byte-swap kernels: single scalars and vectorized runs of equally-sized elements.
+*
+* @ingroup eser_internal
+*
+* @warning Implementation detail. Do not include directly or depend on `eser::internal`; it is not
+*          part of the public API and may change between releases.
+*
+* Two layers:
+*
+* - @ref byteswap reverses one 2-, 4- or 8-byte value with the compiler intrinsic
+*   (`__builtin_bswap*` on GCC/Clang, `_byteswap_*` on MSVC), falling back to shifts elsewhere.
+* - @ref byteswap_copy reverses every element of a run of `count` elements of `Size` bytes,
+*   16 or 32 bytes per step with the widest shuffle the target was compiled for — AVX2, SSSE3,
+*   SSE2 (x86-64 baseline) or NEON — and @ref byteswap for the tail. Without any of those ISAs
+*   (e.g. ESP32/Xtensa) it is a plain per-element loop over @ref byteswap.
+*
+* The ISA is chosen from the compiler's predefined macros (`__AVX2__`, `__SSSE3__`, `__SSE2__`,
+* `_M_X64`, `__ARM_NEON`), i.e. from the `-m`/`/arch:` flags of the build; there is no runtime
+* dispatch. Define `ESER_NO_SIMD` to force the portable loop.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_INTERNAL_BYTESWAP_HPP_
+#define ESER_INTERNAL_BYTESWAP_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <stdlib.h>   // _byteswap_ushort / _byteswap_ulong / _byteswap_uint64
+#endif
+
+#if !defined(ESER_NO_SIMD)
+    #if defined(__AVX2__)
+        #include <immintrin.h>
+        #define ESER_BYTESWAP_AVX2 1
+        #define ESER_BYTESWAP_SSSE3 1
+    #elif defined(__SSSE3__)
+        #include <tmmintrin.h>
+        #define ESER_BYTESWAP_SSSE3 1
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #include <emmintrin.h>
+        #define ESER_BYTESWAP_SSE2 1
+    #elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+        #include <arm_neon.h>
+        #define ESER_BYTESWAP_NEON 1
+    #endif
+#endif
+
+namespace eser::internal{
+    /**
+    * @brief The unsigned integer type of exactly `Size` bytes (`void` if there is none).
+    * @tparam Size The width in bytes.
+    */
+    template<std::size_t Size>
+    using uint_of_size_t =
+        std::conditional_t<Size == 1, std::uint8_t,
+        std::conditional_t<Size == 2, std::uint16_t,
+        std::conditional_t<Size == 4, std::uint32_t,
+        std::conditional_t<Size == 8, std::uint64_t, void>>>>;
+
+    /**
+    * @brief Reverse the bytes of a 16-bit value.
+    * @param value The value to swap.
+    * @return `value` with its two bytes exchanged.
+    */
+    inline std::uint16_t byteswap(std::uint16_t value) noexcept
+    {
+        #if defined(__GNUC__) || defined(__clang__)
+            return __builtin_bswap16(value);
+        #elif defined(_MSC_VER)
+            return _byteswap_ushort(value);
+        #else
+            return static_cast<std::uint16_t>((value << 8) | (value >> 8));
+        #endif
+    }
+
+    /**
+    * @brief Reverse the bytes of a 32-bit value.
+    * @param value The value to swap.
+    * @return `value` with its four bytes in reverse order.
+    */
+    inline std::uint32_t byteswap(std::uint32_t value) noexcept
+    {
+        #if defined(__GNUC__) || defined(__clang__)
+            return __builtin_bswap32(value);
+        #elif defined(_MSC_VER)
+            return _byteswap_ulong(value);
+        #else
+            return ((value & 0x000000FFu) << 24) | ((value & 0x0000FF00u) << 8) |
+                   ((value & 0x00FF0000u) >> 8)  | ((value & 0xFF000000u) >> 24);
+        #endif
+    }
+
+    /**
+    * @brief Reverse the bytes of a 64-bit value.
+    * @param value The value to swap.
+    * @return `value` with its eight bytes in reverse order.
+    */
+    inline std::uint64_t byteswap(std::uint64_t value) noexcept
+    {
+        #if defined(__GNUC__) || defined(__clang__)
+            return __builtin_bswap64(value);
+        #elif defined(_MSC_VER)
+            return _byteswap_uint64(value);
+        #else
+            return (static_cast<std::uint64_t>(byteswap(static_cast<std::uint32_t>(value))) << 32) |
+                   byteswap(static_cast<std::uint32_t>(value >> 32));
+        #endif
+    }
+
+    /**
+    * @brief Reverse the object representation of one `Size`-byte element from `src` into `dst`.
+    *
+    * `dst` and `src` may be the same address (an in-place swap) but must not otherwise overlap.
+    *
+    * @tparam Size The element width in bytes.
+    * @param dst Destination of the swapped element (any alignment).
+    * @param src Source element (any alignment).
+    */
+    template<std::size_t Size>
+    inline void byteswap_one(unsigned char *dst, const unsigned char *src) noexcept
+    {
+        using word = uint_of_size_t<Size>;
+        if constexpr (Size == 1) {
+            *dst = *src;
+        } else if constexpr (not std::is_void_v<word>) {
+            word value;
+            std::memcpy(&value, src, Size);
+            value = byteswap(value);
+            std::memcpy(dst, &value, Size);
+        } else {
+            // Odd widths (e.g. an 80-bit long double padded to 16): reverse through a temporary.
+            unsigned char tmp[Size];
+            for (std::size_t i = 0; i < Size; ++i) tmp[i] = src[Size - 1 - i];
+            std::memcpy(dst, tmp, Size);
+        }
+    }
+
+    namespace simd{
+        #if defined(ESER_BYTESWAP_SSSE3) || defined(ESER_BYTESWAP_AVX2)
+        /**
+        * @brief The `pshufb` control that reverses each `Size`-byte element of a 16-byte lane.
+        */
+        template<std::size_t Size>
+        inline __m128i reverse_mask() noexcept
+        {
+            if constexpr (Size == 2)
+                return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+            else if constexpr (Size == 4)
+                return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+            else
+                return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+        }
+        #endif
+
+        #if defined(ESER_BYTESWAP_SSE2)
+        /**
+        * @brief Reverse each `Size`-byte element of a 16-byte vector using SSE2 only (no `pshufb`):
+        *        shuffle 16-bit words into reverse order, then swap the two bytes of every word.
+        */
+        template<std::size_t Size>
+        inline __m128i reverse_sse2(__m128i v) noexcept
+        {
+            if constexpr (Size == 4) {
+                v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);   // (1,0,3,2) per half
+            } else if constexpr (Size == 8) {
+                v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x1B), 0x1B);   // (3,2,1,0) per half
+            }
+            return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        }
+        #endif
+
+        /**
+        * @brief Swap as many whole vectors of `Size`-byte elements as the target ISA allows.
+        *
+        * @tparam Size The element width in bytes (2, 4 or 8).
+        * @param dst Destination bytes (may equal `src`).
+        * @param src Source bytes.
+        * @param bytes The number of bytes available (a multiple of `Size`).
+        * @return The number of leading bytes processed; the caller finishes the tail.
+        */
+        template<std::size_t Size>
+        inline std::size_t byteswap_block(unsigned char *dst, const unsigned char *src, std::size_t bytes) noexcept
+        {
+            std::size_t done = 0;
+            #if defined(ESER_BYTESWAP_AVX2)
+                const __m256i mask256 = _mm256_broadcastsi128_si256(reverse_mask<Size>());
+                for (; done + 32 <= bytes; done += 32) {
+                    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + done));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + done), _mm256_shuffle_epi8(v, mask256));
+                }
+            #endif
+            #if defined(ESER_BYTESWAP_SSSE3)
+                const __m128i mask = reverse_mask<Size>();
+                for (; done + 16 <= bytes; done += 16) {
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + done));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + done), _mm_shuffle_epi8(v, mask));
+                }
+            #elif defined(ESER_BYTESWAP_SSE2)
+                for (; done + 16 <= bytes; done += 16) {
+                    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + done));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + done), reverse_sse2<Size>(v));
+                }
+            #elif defined(ESER_BYTESWAP_NEON)
+                for (; done + 16 <= bytes; done += 16) {
+                    const uint8x16_t v = vld1q_u8(src + done);
+                    if constexpr (Size == 2)      vst1q_u8(dst + done, vrev16q_u8(v));
+                    else if constexpr (Size == 4) vst1q_u8(dst + done, vrev32q_u8(v));
+                    else                          vst1q_u8(dst + done, vrev64q_u8(v));
+                }
+            #endif
+            (void)dst; (void)src; (void)bytes;
+            return done;
+        }
+    } // namespace simd
+
+    /**
+    * @brief Byte-reverse each of `count` consecutive `Size`-byte elements from `src` into `dst`.
+    *
+    * The vector kernels handle whole 16/32-byte blocks; the remaining elements go through
+    * @ref byteswap_one. Works for any element alignment. `dst == src` performs the swap in place;
+    * any other overlap is not allowed.
+    *
+    * @tparam Size The element width in bytes.
+    * @param dst Destination of the swapped elements.
+    * @param src Source elements.
+    * @param count The number of elements.
+    */
+    template<std::size_t Size>
+    inline void byteswap_copy(void *dst, const void *src, std::size_t count) noexcept
+    {
+        auto* out = static_cast<unsigned char*>(dst);
+        const auto* in = static_cast<const unsigned char*>(src);
+        const std::size_t bytes = count * Size;
+        std::size_t done = 0;
+        if constexpr (Size == 2 or Size == 4 or Size == 8) done = simd::byteswap_block<Size>(out, in, bytes);
+        if constexpr (Size == 1) {
+            if (out != in and bytes != 0) std::memcpy(out, in, bytes);
+        } else {
+            for (; done < bytes; done += Size) byteswap_one<Size>(out + done, in + done);
+        }
+    }
+} // namespace eser::internal
+
+#endif // ESER_INTERNAL_BYTESWAP_HPP_
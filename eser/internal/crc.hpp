@@ -0,0 +1,190 @@
+/**
+* @file crc.hpp
+*
+* @brief Internal CRC kernels: table-driven CRC-16/CCITT, CRC-32 and CRC-32C, with hardware paths.
+*
+* @ingroup eser_internal
+*
+* @warning Implementation detail. Do not include directly or depend on `eser::internal`; it is not
+*          part of the public API and may change between releases.
+*
+* Every kernel updates a raw CRC register over `n` bytes and leaves the initial value and the final
+* XOR to the caller (see flat/checksum.hpp), so a checksum can be fed field by field. The portable
+* path is one 256-entry table per polynomial, built at compile time. Where the target has a CRC
+* instruction it is used instead:
+*
+* | Kernel | Hardware path |
+* |---|---|
+* | @ref crc16_ccitt_update | ESP32 ROM (`esp_rom_crc16_be`) |
+* | @ref crc32_update | ARMv8 CRC (`__crc32d`), ESP32 ROM (`esp_rom_crc32_le`) |
+* | @ref crc32c_update | SSE4.2 (`_mm_crc32_u64`), ARMv8 CRC (`__crc32cd`) |
+*
+* Like byteswap.hpp, the path is chosen from the compiler's predefined macros (`__SSE4_2__`,
+* `__ARM_FEATURE_CRC32`, `ESP_PLATFORM`); there is no runtime dispatch. Define `ESER_NO_SIMD` to
+* force the tables.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_INTERNAL_CRC_HPP_
+#define ESER_INTERNAL_CRC_HPP_
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "byte.hpp"
+
+#if !defined(ESER_NO_SIMD)
+    #if defined(__SSE4_2__) || (defined(_MSC_VER) && defined(__AVX__))
+        #include <nmmintrin.h>
+        #define ESER_CRC_SSE42 1
+    #elif defined(__ARM_FEATURE_CRC32)
+        #include <arm_acle.h>
+        #define ESER_CRC_ARM 1
+    #elif defined(ESP_PLATFORM)
+        #include "esp_rom_crc.h"
+        #define ESER_CRC_ESP_ROM 1
+    #endif
+#endif
+
+namespace eser::internal{
+    /**
+    * @brief The 256-entry lookup table of a CRC polynomial, built at compile time.
+    *
+    * @tparam Word The register type (`std::uint16_t` or `std::uint32_t`).
+    * @tparam Poly The polynomial, in the bit order of the register.
+    * @tparam Reflected Whether the CRC shifts right (LSB-first, e.g. CRC-32) or left (CRC-16/CCITT).
+    */
+    template<typename Word, Word Poly, bool Reflected>
+    struct crc_table{
+        /**
+        * @brief Compute the table.
+        */
+        static constexpr std::array<Word, 256> make() noexcept
+        {
+            constexpr unsigned top = sizeof(Word) * 8 - 1;
+            std::array<Word, 256> table{};
+            for (unsigned i = 0; i < 256; ++i) {
+                Word crc = Reflected ? static_cast<Word>(i) : static_cast<Word>(static_cast<Word>(i) << (top - 7));
+                for (int bit = 0; bit < 8; ++bit) {
+                    if constexpr (Reflected)
+                        crc = static_cast<Word>((crc & 1u) ? (crc >> 1) ^ Poly : crc >> 1);
+                    else
+                        crc = static_cast<Word>(((crc >> top) & 1u) ? static_cast<Word>(crc << 1) ^ Poly : crc << 1);
+                }
+                table[i] = crc;
+            }
+            return table;
+        }
+
+        static constexpr std::array<Word, 256> value = make(); ///< The table.
+    };
+
+    /**
+    * @brief Feed `n` bytes through a reflected (LSB-first) 32-bit CRC table.
+    */
+    template<std::uint32_t Poly>
+    inline std::uint32_t crc32_table_update(std::uint32_t crc, const std::byte *data, std::size_t n) noexcept
+    {
+        constexpr const std::array<std::uint32_t, 256> &table = crc_table<std::uint32_t, Poly, true>::value;
+        for (std::size_t i = 0; i < n; ++i)
+            crc = (crc >> 8) ^ table[(crc ^ std::to_integer<std::uint32_t>(data[i])) & 0xFFu];
+        return crc;
+    }
+
+    /**
+    * @brief Update a CRC-16/CCITT register (polynomial 0x1021, MSB-first) over `n` bytes.
+    * @param crc The register.
+    * @param data The bytes.
+    * @param n The number of bytes.
+    * @return The updated register.
+    */
+    inline std::uint16_t crc16_ccitt_update(std::uint16_t crc, const std::byte *data, std::size_t n) noexcept
+    {
+        #if defined(ESER_CRC_ESP_ROM)
+            // The ROM routine complements the register on entry and on exit.
+            const auto *bytes = static_cast<const std::uint8_t *>(static_cast<const void *>(data));
+            return static_cast<std::uint16_t>(~esp_rom_crc16_be(static_cast<std::uint16_t>(~crc), bytes, static_cast<std::uint32_t>(n)));
+        #else
+            constexpr const std::array<std::uint16_t, 256> &table = crc_table<std::uint16_t, 0x1021u, false>::value;
+            for (std::size_t i = 0; i < n; ++i)
+                crc = static_cast<std::uint16_t>((crc << 8) ^ table[((crc >> 8) ^ std::to_integer<unsigned>(data[i])) & 0xFFu]);
+            return crc;
+        #endif
+    }
+
+    /**
+    * @brief Update a CRC-32 (IEEE 802.3, reflected polynomial 0xEDB88320) register over `n` bytes.
+    * @param crc The register.
+    * @param data The bytes.
+    * @param n The number of bytes.
+    * @return The updated register.
+    */
+    inline std::uint32_t crc32_update(std::uint32_t crc, const std::byte *data, std::size_t n) noexcept
+    {
+        #if defined(ESER_CRC_ARM)
+            for (; n >= 8; n -= 8, data += 8) {
+                std::uint64_t word;
+                std::memcpy(&word, data, 8);
+                crc = __crc32d(crc, word);
+            }
+            for (; n != 0; --n, ++data) crc = __crc32b(crc, std::to_integer<std::uint8_t>(*data));
+            return crc;
+        #elif defined(ESER_CRC_ESP_ROM)
+            const auto *bytes = static_cast<const std::uint8_t *>(static_cast<const void *>(data));
+            return ~esp_rom_crc32_le(~crc, bytes, static_cast<std::uint32_t>(n));
+        #else
+            return crc32_table_update<0xEDB88320u>(crc, data, n);
+        #endif
+    }
+
+    /**
+    * @brief Update a CRC-32C (Castagnoli, reflected polynomial 0x82F63B78) register over `n` bytes.
+    * @param crc The register.
+    * @param data The bytes.
+    * @param n The number of bytes.
+    * @return The updated register.
+    */
+    inline std::uint32_t crc32c_update(std::uint32_t crc, const std::byte *data, std::size_t n) noexcept
+    {
+        #if defined(ESER_CRC_SSE42)
+            #if defined(__x86_64__) || defined(_M_X64)
+                std::uint64_t wide = crc;
+                for (; n >= 8; n -= 8, data += 8) {
+                    std::uint64_t word;
+                    std::memcpy(&word, data, 8);
+                    wide = _mm_crc32_u64(wide, word);
+                }
+                crc = static_cast<std::uint32_t>(wide);
+            #endif
+            for (; n >= 4; n -= 4, data += 4) {
+                std::uint32_t word;
+                std::memcpy(&word, data, 4);
+                crc = _mm_crc32_u32(crc, word);
+            }
+            for (; n != 0; --n, ++data) crc = _mm_crc32_u8(crc, std::to_integer<std::uint8_t>(*data));
+            return crc;
+        #elif defined(ESER_CRC_ARM)
+            for (; n >= 8; n -= 8, data += 8) {
+                std::uint64_t word;
+                std::memcpy(&word, data, 8);
+                crc = __crc32cd(crc, word);
+            }
+            for (; n != 0; --n, ++data) crc = __crc32cb(crc, std::to_integer<std::uint8_t>(*data));
+            return crc;
+        #else
+            return crc32_table_update<0x82F63B78u>(crc, data, n);
+        #endif
+    }
+} // namespace eser::internal
+
+#endif // ESER_INTERNAL_CRC_HPP_
@@ -25,13 +25,25 @@
 * - 2026-06-24
 * -     Initial creation (split from eser/utils/endianness.hpp): host detection plus the
 *       `reverse_bytes` / `apply_wire_endianness` conversion helpers.
+* - 2026-10-14
+* -     Added `needs_byte_swap_v`, the compile-time test the bulk (range) paths use to collapse
+*       a whole batch into a single `memcpy`.
+* - 2026-10-14
+* -     `reverse_bytes` uses the byte-swap intrinsics and `apply_wire_endianness` swaps arrays of
+*       scalars with the vectorized @ref byteswap_copy kernel (both in byteswap.hpp).
+* - 2026-10-14
+* -     Added `has_integer_representation`: class types whose object is one unsigned integer
+*       (`utils::bits`) are swapped like the scalar they hold.
 */
 #ifndef ESER_INTERNAL_ENDIANNESS_HPP_
 #define ESER_INTERNAL_ENDIANNESS_HPP_
 #include <cstddef>
 #include <type_traits>
+#include <array>
 #include "traits.hpp"
+#include "byteswap.hpp"
 #include "../utils/endianness.hpp"
+#include "../utils/reflect.hpp"
 
 namespace eser::internal{
     using eser::utils::endianness;
@@ -63,11 +75,109 @@ namespace eser::internal{
         #error "[eser] cannot detect host endianness; define ESER_FORCE_ENDIANNESS_LITTLE or ESER_FORCE_ENDIANNESS_BIG"
     #endif
 
+    /**
+    * @struct has_integer_representation
+    * @brief Marks a class type whose object representation is a single unsigned integer.
+    *
+    * Such a type (e.g. `utils::bits`) crosses a non-native wire by reversing its bytes, exactly
+    * like the scalar it wraps, instead of being rejected like a general struct. The primary
+    * template is `false`; the wrapper's header specializes it.
+    *
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    struct has_integer_representation : std::false_type {};
+
+    /**
+    * @var has_integer_representation_v
+    * @brief Convenience variable template for `has_integer_representation<T>::value`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    inline constexpr bool has_integer_representation_v = has_integer_representation<T>::value;
+
+    /**
+    * @struct needs_byte_swap
+    * @brief Whether a value of type `T` must be byte-reversed to cross a `Wire`-ordered stream.
+    *
+    * `false` whenever the wire order matches the host, for endianness-neutral types, and for
+    * single-byte scalars/enums; otherwise `true` for multi-byte scalars/enums. Arrays (C and
+    * `std::array`) inherit the answer of their element type. Any other class type answers `true`:
+    * its raw bytes cannot be swapped, and the codec rejects it on a non-native wire.
+    *
+    * When this is `false`, the wire image of `T` is its object representation, so a contiguous
+    * run of such values can be copied with one `memcpy`.
+    *
+    * @tparam Wire The byte order of the serialized stream.
+    * @tparam T    The field type to inspect.
+    * @see needs_byte_swap_v
+    */
+    template<endianness Wire, typename T, typename = void>
+    struct needs_byte_swap : std::bool_constant<Wire != host_endianness and not is_endianness_neutral_v<T>> {};
+
+    /**
+    * @brief Scalars, enums and integer wrappers need swapping only when they span more than one byte.
+    */
+    template<endianness Wire, typename T>
+    struct needs_byte_swap<Wire, T, std::enable_if_t<std::is_arithmetic_v<T> or std::is_enum_v<T> or has_integer_representation_v<T>>>
+    : std::bool_constant<Wire != host_endianness and (sizeof(T) > 1) and not is_endianness_neutral_v<T>> {};
+
+    /**
+    * @brief A struct described with `ESER_REFLECT` needs swapping when one of its members does.
+    */
+    template<endianness Wire, typename T>
+    struct needs_byte_swap<Wire, T, std::enable_if_t<utils::is_reflected_v<T>>>
+    : needs_byte_swap<Wire, utils::reflection_t<T>> {};
+
+    /**
+    * @brief The member list of a described struct needs swapping when one of its members does. A
+    *        packed struct also needs converting whenever its packed image is not its object
+    *        representation (padding, or members listed out of order).
+    */
+    template<endianness Wire, typename T, utils::wire_layout Layout, typename... Members>
+    struct needs_byte_swap<Wire, utils::reflection<T, Layout, Members...>>
+    : std::bool_constant<
+        (Layout == utils::wire_layout::packed and not utils::reflection<T, Layout, Members...>::contiguous) or
+        (not is_endianness_neutral_v<T> and (... or needs_byte_swap<Wire, typename Members::value_type>::value))> {};
+
+    /**
+    * @brief A C-array needs swapping exactly when its element type does.
+    */
+    template<endianness Wire, typename T, std::size_t N>
+    struct needs_byte_swap<Wire, T[N]> : needs_byte_swap<Wire, T> {};
+
+    /**
+    * @brief A `std::array` needs swapping exactly when its element type does.
+    */
+    template<endianness Wire, typename T, std::size_t N>
+    struct needs_byte_swap<Wire, std::array<T, N>> : needs_byte_swap<Wire, T> {};
+
+    /**
+    * @var needs_byte_swap_v
+    * @brief Convenience variable template for `needs_byte_swap<Wire, T>::value`.
+    * @tparam Wire The byte order of the serialized stream.
+    * @tparam T    The field type to inspect.
+    */
+    template<endianness Wire, typename T>
+    inline constexpr bool needs_byte_swap_v = needs_byte_swap<Wire, T>::value;
+
+    /**
+    * @var is_swapped_scalar_v
+    * @brief Whether `T` is a multi-byte scalar or enum that must be byte-reversed on a `Wire`
+    *        stream — the element types a contiguous run of which @ref byteswap_copy can convert.
+    * @tparam Wire The byte order of the serialized stream.
+    * @tparam T    The element type to inspect.
+    */
+    template<endianness Wire, typename T>
+    inline constexpr bool is_swapped_scalar_v =
+        (std::is_arithmetic_v<T> or std::is_enum_v<T> or has_integer_representation_v<T>) and needs_byte_swap_v<Wire, T>;
+
     /**
     * @brief Reverse the object representation of `value` in place.
     *
     * Swaps the `sizeof(T)` bytes of `value` end-for-end, converting between little- and
-    * big-endian. A one-byte type is a no-op.
+    * big-endian, using the byte-swap intrinsic for 2/4/8-byte types (see byteswap.hpp).
+    * A one-byte type is a no-op.
     *
     * @tparam T A trivially-copyable type (scalar, enum, or floating-point).
     * @param value The value whose bytes are reversed in place.
@@ -80,12 +190,7 @@ namespace eser::internal{
     {
         static_assert(std::is_trivially_copyable_v<T>, "reverse_bytes requires a trivially-copyable type");
         auto* bytes = reinterpret_cast<unsigned char*>(&value);
-        for (std::size_t i = 0, j = sizeof(T) - 1; i < j; ++i, --j)
-        {
-            const unsigned char tmp = bytes[i];
-            bytes[i] = bytes[j];
-            bytes[j] = tmp;
-        }
+        byteswap_one<sizeof(T)>(bytes, bytes);
     }
 
     /**
@@ -93,8 +198,12 @@ namespace eser::internal{
     *
     * A no-op when `Wire == host_endianness`. Otherwise:
     * - endianness-neutral types (`is_endianness_neutral`, e.g. byte-string fields) pass through;
-    * - scalars, enums and floats are byte-reversed (@ref reverse_bytes);
-    * - `std::array` elements are converted individually;
+    * - scalars, enums, floats and integer wrappers (@ref has_integer_representation) are
+    *   byte-reversed (@ref reverse_bytes);
+    * - `std::array` elements are converted individually (arrays of scalars in one vectorized pass,
+    *   see @ref byteswap_copy);
+    * - C-arrays are converted element by element;
+    * - structs described with `ESER_REFLECT` are converted member by member, in place;
     * - other trivially-copyable structs are rejected (`static_assert`) — raw bytes carry no type
     *   information to swap, so a non-native wire order would corrupt their members.
     *
@@ -113,15 +222,40 @@ namespace eser::internal{
             }
             else if constexpr (is_std_array_v<T>)
             {
-                for (auto& element : value) apply_wire_endianness<Wire>(element);
+                using element = typename T::value_type;
+                if constexpr ((std::is_arithmetic_v<element> or std::is_enum_v<element>) and
+                              sizeof(T) == sizeof(element) * std::tuple_size_v<T>)
+                {
+                    // a packed run of scalars: swap the whole array with the vector kernel
+                    byteswap_copy<sizeof(element)>(value.data(), value.data(), value.size());
+                }
+                else
+                {
+                    for (auto& e : value) apply_wire_endianness<Wire>(e);
+                }
+            }
+            else if constexpr (std::is_array_v<T>)
+            {
+                for (auto& e : value) apply_wire_endianness<Wire>(e);
+            }
+            else if constexpr (has_integer_representation_v<T>)
+            {
+                reverse_bytes(value);
+            }
+            else if constexpr (utils::is_reflected_v<T>)
+            {
+                static_assert(not utils::is_packed_v<T>,
+                    "[eser] a packed struct's wire image differs from its object; it is converted "
+                    "member by member by the codec, not swapped in place");
+                utils::reflection_t<T>::for_each([&value](auto m){ apply_wire_endianness<Wire>(decltype(m)::get(value)); });
             }
             else
             {
                 static_assert(not std::is_class_v<T>,
                     "[eser] trivially-copyable structs are stored as raw bytes and cannot be "
-                    "byte-swapped for a non-native wire endianness; use a native-endianness codec, "
-                    "split the struct into scalar fields, or specialize is_endianness_neutral if the "
-                    "type is byte-only");
+                    "byte-swapped for a non-native wire endianness; describe the members with "
+                    "ESER_REFLECT (eser/utils/reflect.hpp), use a native-endianness codec, split the "
+                    "struct into scalar fields, or specialize is_endianness_neutral if the type is byte-only");
                 reverse_bytes(value);
             }
         }
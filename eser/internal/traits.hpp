@@ -25,6 +25,12 @@
 * -     Moved to `eser::internal` (eser/internal/traits.hpp). Removed dead `is_unique` and
 *       `underlying_v`; `is_endianness_neutral` (a public customization point) moved to
 *       `eser/utils/endianness.hpp`.
+* - 2026-10-14
+* -     Added `is_contiguous_range` (detects `std::data` / `std::size`) for the bulk range API,
+*       `array_leaf` (the innermost element type of a nested array) and `as_std_array`
+*       (C-array to `std::array` mapping for deserialization).
+* - 2026-10-14
+* -     Added `type_at` (pack indexing) for `flat::layout`.
 */
 #ifndef ESER_INTERNAL_TRAITS_HPP_
 #define ESER_INTERNAL_TRAITS_HPP_
@@ -33,6 +39,8 @@
 #include <tuple>       // For the std::tuple specialization of is_tuple
 #include <array>       // For the std::array specialization of is_std_array
 #include <cstddef>     // For std::size_t
+#include <iterator>    // For std::data / std::size (is_contiguous_range)
+#include <utility>     // For std::declval
 
 namespace eser::internal {
     /**
@@ -88,6 +96,131 @@ namespace eser::internal {
     inline constexpr bool is_std_array_v = is_std_array<T>::value;
 
 
+    /**
+    * @struct array_leaf
+    * @brief Strips every level of C-array / `std::array` nesting off `T`.
+    *
+    * `array_leaf<std::array<float[2], 3>>::type` is `float`; a non-array `T` is its own leaf.
+    *
+    * @tparam T The type to inspect.
+    * @see array_leaf_t
+    */
+    template <typename T>
+    struct array_leaf { using type = T; /**< The innermost element type. */ };
+
+    /**
+    * @brief Specialization of `array_leaf` for C-arrays.
+    */
+    template <typename T, std::size_t N>
+    struct array_leaf<T[N]> : array_leaf<T> {};
+
+    /**
+    * @brief Specialization of `array_leaf` for `std::array`.
+    */
+    template <typename T, std::size_t N>
+    struct array_leaf<std::array<T, N>> : array_leaf<T> {};
+
+    /**
+    * @brief Helper alias for `array_leaf<T>::type`.
+    * @tparam T The type to inspect.
+    */
+    template <typename T>
+    using array_leaf_t = typename array_leaf<T>::type;
+
+
+    /**
+    * @struct as_std_array
+    * @brief Maps a (possibly nested) C-array type to the equivalent `std::array`; other types map
+    *        to themselves.
+    *
+    * `as_std_array<int[2][3]>::type` is `std::array<std::array<int, 3>, 2>` — the value type the
+    * deserializer returns for a C-array, since a C-array cannot be returned (or held in a
+    * `std::optional`) by value. Both have the same wire bytes.
+    *
+    * @tparam T The type to map.
+    * @see as_std_array_t
+    */
+    template <typename T>
+    struct as_std_array { using type = T; /**< The mapped type. */ };
+
+    /**
+    * @brief Specialization of `as_std_array` for bounded C-arrays.
+    */
+    template <typename T, std::size_t N>
+    struct as_std_array<T[N]> { using type = std::array<typename as_std_array<T>::type, N>; /**< The mapped type. */ };
+
+    /**
+    * @brief Helper alias for `as_std_array<T>::type`.
+    * @tparam T The type to map.
+    */
+    template <typename T>
+    using as_std_array_t = typename as_std_array<T>::type;
+
+
+    /**
+    * @struct type_at
+    * @brief Names the `I`-th type of the pack `Ts...` (zero-based).
+    *
+    * @tparam I The index; must be `< sizeof...(Ts)`.
+    * @tparam Ts The type pack.
+    * @see type_at_t
+    */
+    template <std::size_t I, typename... Ts>
+    struct type_at;
+
+    /**
+    * @brief Recursive case of `type_at`: drop the head until the index reaches zero.
+    */
+    template <std::size_t I, typename T, typename... Ts>
+    struct type_at<I, T, Ts...> : type_at<I - 1, Ts...> {};
+
+    /**
+    * @brief Base case of `type_at`: index zero names the head of the pack.
+    */
+    template <typename T, typename... Ts>
+    struct type_at<0, T, Ts...> { using type = T; /**< The selected type. */ };
+
+    /**
+    * @brief Helper alias for `type_at<I, Ts...>::type`.
+    * @tparam I The index.
+    * @tparam Ts The type pack.
+    */
+    template <std::size_t I, typename... Ts>
+    using type_at_t = typename type_at<I, Ts...>::type;
+
+
+    /**
+    * @struct is_contiguous_range
+    * @brief Detects a contiguous range: a type for which `std::data(r)` and `std::size(r)` are valid.
+    *
+    * Matches C-arrays, `std::array`, `std::vector`, `std::span` (C++20) and any user container that
+    * exposes `data()` / `size()`.
+    *
+    * @tparam T The type to inspect.
+    * @see is_contiguous_range_v
+    */
+    template <typename T, typename = void>
+    struct is_contiguous_range : std::false_type {};
+
+    /**
+    * @brief Specialization of `is_contiguous_range` for types supporting `std::data` and `std::size`.
+    * @tparam T The type to inspect.
+    */
+    template <typename T>
+    struct is_contiguous_range<T, std::void_t<
+        decltype(std::data(std::declval<T&>())),
+        decltype(std::size(std::declval<T&>()))
+    >> : std::true_type {};
+
+    /**
+    * @var is_contiguous_range_v
+    * @brief Convenience variable template for `is_contiguous_range<T>::value`.
+    * @tparam T The type to inspect.
+    */
+    template <typename T>
+    inline constexpr bool is_contiguous_range_v = is_contiguous_range<T>::value;
+
+
     /**
     * @var always_false_v
     * @brief Template-dependent compile-time `false` for triggering a conditional `static_assert`.
@@ -0,0 +1,212 @@
+/**
+* @file arena.hpp
+*
+* @brief A bump allocator over caller memory, and `arena_vector`: a length-prefixed field whose
+*        elements are decoded into an arena instead of inline storage.
+*
+* @ingroup eser_utils
+*
+* A `bounded_vector<T, N>` is decoded into its own inline storage, so every decoded message costs
+* the full capacity `N` wherever it lives. `arena_vector<T, N>` has the same wire image (the
+* @ref bounded_length_t prefix and the used elements) but holds only a pointer and a size. The
+* deserializer places the elements in an arena the caller provides, taking only `size()` elements:
+*
+* ```cpp
+* std::byte scratch[4096];
+* utils::arena arena(scratch);
+*
+* for (auto &packet : batch) {
+*     auto m = flat::deserialize(packet.data, packet.size)
+*                  .to<std::tuple<std::uint32_t, utils::arena_vector<float, 1024>>>(arena);
+*     ...
+* }
+* arena.reset();   // one reset frees the whole batch
+* ```
+*
+* Any type with `void *allocate(std::size_t bytes, std::size_t alignment)` can serve as the arena.
+* `utils::arena` returns `nullptr` when it is exhausted, and the read then fails like a bad length
+* prefix. On hosted builds a `std::pmr::memory_resource` (e.g. `std::pmr::monotonic_buffer_resource`)
+* can be passed directly. Decoding is `noexcept`, so a resource that throws on exhaustion terminates:
+* give it an upstream sized for the batch, or `std::pmr::null_memory_resource()` only if it cannot run out.
+*
+* An `arena_vector` also serializes, from whatever memory it points at, so a decoded message can be
+* forwarded unchanged.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_UTILS_ARENA_HPP_
+#define ESER_UTILS_ARENA_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "bounded_vector.hpp"   // for bounded_length_t and is_bounded (specialized below)
+
+namespace eser::utils{
+    /**
+    * @class arena
+    * @brief A bump allocator over a caller-provided buffer: allocation is a pointer bump, and
+    *        `reset()` frees everything at once.
+    *
+    * Nothing is freed individually and nothing is ever taken from the heap. The arena does not
+    * own the buffer.
+    */
+    class arena{
+    public:
+        /**
+        * @brief An arena over `size` bytes at `buffer`.
+        */
+        constexpr arena(std::byte *buffer, std::size_t size) noexcept;
+
+        /**
+        * @brief An arena over a byte array.
+        */
+        template<std::size_t N>
+        constexpr explicit arena(std::byte (&buffer)[N]) noexcept;
+
+        arena(const arena &) = delete;
+        arena &operator=(const arena &) = delete;
+
+        /**
+        * @brief Take `bytes` bytes aligned to `alignment`.
+        * @param bytes The size of the block.
+        * @param alignment A power of two.
+        * @return The block, or `nullptr` (and no change) if the rest of the buffer is too small.
+        */
+        [[nodiscard]] void *allocate(std::size_t bytes, std::size_t alignment) noexcept;
+
+        /**
+        * @brief Free every block at once.
+        */
+        void reset() noexcept;
+
+        /**
+        * @brief The bytes taken so far, alignment padding included.
+        */
+        [[nodiscard]] constexpr std::size_t used() const noexcept;
+
+        /**
+        * @brief The size of the buffer.
+        */
+        [[nodiscard]] constexpr std::size_t capacity() const noexcept;
+
+    private:
+        std::byte *_buffer;   ///< The caller's buffer.
+        std::size_t _size;    ///< Its size.
+        std::size_t _used;    ///< The bytes taken since the last reset.
+    };
+
+    /**
+    * @class arena_vector
+    * @brief A sequence of at most `N` elements of `T` that live elsewhere, typically in an arena.
+    *
+    * On the wire it is exactly a `bounded_vector<T, N>`: a `length_type` prefix, then `size()`
+    * elements. It is decoded with `deserializer::to<T>(arena)` and points into the arena
+    * afterwards. It must not outlive the arena's next `reset()`.
+    *
+    * @tparam T The element type; trivially copyable, of fixed wire size.
+    * @tparam N The capacity, which bounds and validates the wire count. Must be strictly positive.
+    */
+    template<typename T, std::size_t N>
+    class arena_vector{
+        static_assert(N > 0, "arena_vector capacity N must be strictly positive");
+        static_assert(std::is_trivially_copyable_v<T>, "arena_vector elements must be trivially copyable");
+
+    public:
+        using value_type = T;                      ///< The element type.
+        using size_type = std::size_t;             ///< The size type.
+        using length_type = bounded_length_t<N>;   ///< The wire type of the length prefix.
+        using iterator = T*;                       ///< Mutable iterator.
+        using const_iterator = const T*;           ///< Read-only iterator.
+
+        /**
+        * @brief An empty vector.
+        */
+        constexpr arena_vector() noexcept;
+
+        /**
+        * @brief A vector over `count` elements at `first`, which it does not own.
+        * @pre `count <= N`. A larger count is flagged by `assert` and clamped to `N`.
+        */
+        constexpr arena_vector(T *first, size_type count) noexcept;
+
+        /**
+        * @brief The number of elements.
+        */
+        [[nodiscard]] constexpr size_type size() const noexcept;
+
+        /**
+        * @brief Whether the vector holds no element.
+        */
+        [[nodiscard]] constexpr bool empty() const noexcept;
+
+        /**
+        * @brief The capacity `N`.
+        */
+        [[nodiscard]] static constexpr size_type capacity() noexcept;
+
+        /**
+        * @brief Pointer to the first element; `nullptr` when empty.
+        */
+        [[nodiscard]] constexpr T* data() const noexcept;
+
+        /**
+        * @brief Element access; `index < size()` (checked by `assert`).
+        */
+        [[nodiscard]] constexpr T& operator[](size_type index) const noexcept;
+
+        [[nodiscard]] constexpr iterator begin() const noexcept;    ///< Iterator to the first element.
+        [[nodiscard]] constexpr iterator end() const noexcept;      ///< Iterator past the last element.
+
+    private:
+        T *_data;           ///< The elements (not owned).
+        size_type _size;    ///< The number of elements.
+    };
+
+    /**
+    * @brief The arena counterpart of `bounded_string<N>`: up to `N` characters, same wire image.
+    */
+    template<std::size_t N>
+    using arena_string = arena_vector<char, N>;
+
+    /**
+    * @brief Specialization of `is_bounded` for `arena_vector`: it is written like any bounded
+    *        field; it is read through an arena instead of `resize()`.
+    */
+    template<typename T, std::size_t N>
+    struct is_bounded<arena_vector<T, N>> : std::true_type {};
+
+    /**
+    * @struct is_arena_vector
+    * @brief Detects `arena_vector`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    struct is_arena_vector : std::false_type {};
+
+    /**
+    * @brief Specialization of `is_arena_vector` for `arena_vector`.
+    */
+    template<typename T, std::size_t N>
+    struct is_arena_vector<arena_vector<T, N>> : std::true_type {};
+
+    /**
+    * @var is_arena_vector_v
+    * @brief Convenience variable template for `is_arena_vector<T>::value`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    inline constexpr bool is_arena_vector_v = is_arena_vector<T>::value;
+} // namespace eser::utils
+
+#include "arena.tpp"
+#endif // ESER_UTILS_ARENA_HPP_
@@ -0,0 +1,120 @@
+/**
+* @file arena.tpp
+*
+* @brief Definition of functionality in arena.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_UTILS_ARENA_TPP_
+#define ESER_UTILS_ARENA_TPP_
+#include "arena.hpp"
+#include <cassert>
+
+namespace eser::utils{
+    constexpr arena::arena(std::byte *buffer, std::size_t size) noexcept
+    : _buffer(buffer), _size(size), _used(0)
+    {
+    }
+
+    template<std::size_t N>
+    constexpr arena::arena(std::byte (&buffer)[N]) noexcept
+    : arena(buffer, N)
+    {
+    }
+
+    inline void *arena::allocate(std::size_t bytes, std::size_t alignment) noexcept
+    {
+        assert(alignment != 0 and (alignment & (alignment - 1)) == 0 && "arena alignment must be a power of two");
+        const auto address = reinterpret_cast<std::uintptr_t>(_buffer + _used);
+        const std::size_t padding = static_cast<std::size_t>(-address & (alignment - 1));
+        // Compare against what is left so neither sum can overflow.
+        if (padding > _size - _used or bytes > _size - _used - padding) return nullptr;
+        std::byte *block = _buffer + _used + padding;
+        _used += padding + bytes;
+        return block;
+    }
+
+    inline void arena::reset() noexcept
+    {
+        _used = 0;
+    }
+
+    constexpr std::size_t arena::used() const noexcept
+    {
+        return _used;
+    }
+
+    constexpr std::size_t arena::capacity() const noexcept
+    {
+        return _size;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr arena_vector<T, N>::arena_vector() noexcept
+    : _data(nullptr), _size(0)
+    {
+    }
+
+    template<typename T, std::size_t N>
+    constexpr arena_vector<T, N>::arena_vector(T *first, size_type count) noexcept
+    : _data(first), _size(count)
+    {
+        assert(count <= N && "arena_vector count exceeds the capacity");
+        if (_size > N) _size = N;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr typename arena_vector<T, N>::size_type arena_vector<T, N>::size() const noexcept
+    {
+        return _size;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr bool arena_vector<T, N>::empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr typename arena_vector<T, N>::size_type arena_vector<T, N>::capacity() noexcept
+    {
+        return N;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr T *arena_vector<T, N>::data() const noexcept
+    {
+        return _data;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr T &arena_vector<T, N>::operator[](size_type index) const noexcept
+    {
+        assert(index < _size && "arena_vector index out of range");
+        return _data[index];
+    }
+
+    template<typename T, std::size_t N>
+    constexpr typename arena_vector<T, N>::iterator arena_vector<T, N>::begin() const noexcept
+    {
+        return _data;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr typename arena_vector<T, N>::iterator arena_vector<T, N>::end() const noexcept
+    {
+        return _data + _size;
+    }
+} // namespace eser::utils
+
+#endif // ESER_UTILS_ARENA_TPP_
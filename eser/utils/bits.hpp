@@ -0,0 +1,214 @@
+/**
+* @file bits.hpp
+*
+* @brief Narrow integer field of `N` bits, bit-packed with its neighbours on the wire.
+*
+* @ingroup eser_utils
+*
+* This header defines `eser::utils::bits`, a value of type `T` that uses only `N` bits. Two or
+* more consecutive `bits` fields of one message form a *bit group*, which the flat codec packs
+* tightly across byte boundaries. A 3-bit mode, a 12-bit ADC reading and a flag take 2 bytes
+* instead of 4:
+*
+* ```cpp
+* enum class mode : std::uint8_t { idle, sample, burst };
+*
+* utils::bits<3, mode> m = mode::burst;
+* utils::bits<12, std::uint16_t> adc = 0x7FF;
+* utils::bits<1, bool> armed = true;
+* std::uint32_t stamp = 1000;
+*
+* static_assert(flat::serialized_size_of<decltype(m), decltype(adc), decltype(armed), std::uint32_t>() == 2 + 4);
+* flat::serialize(m, adc, armed, stamp).to(buffer);
+* ```
+*
+* ## Wire format
+*
+* A group occupies `ceil(total bits / 8)` bytes and the message stays fixed-size; the next
+* non-`bits` field starts on a byte boundary. On a little-endian wire the first field takes the
+* least-significant bits of the first byte. On a big-endian wire it takes the most-significant bits
+* of the first byte (network bit order, as in an IPv4 header). The unused padding bits are zero.
+* A group may span at most 64 bits.
+*
+* A lone `bits` field, an array element, or a range record is not packed. It occupies its
+* storage integer (the smallest of 1, 2, 4 or 8 bytes that holds `N` bits) and is byte-swapped
+* like that integer.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_UTILS_BITS_HPP_
+#define ESER_UTILS_BITS_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include "../internal/endianness.hpp"   // for has_integer_representation (specialized below)
+
+namespace eser::utils{
+    namespace details{
+        /**
+        * @brief The integer type that carries the value bits of `T` (its underlying type for an enum).
+        */
+        template<typename T, bool = std::is_enum_v<T>>
+        struct bits_integer { using type = T; };
+
+        /**
+        * @brief Specialization of `bits_integer` for enums.
+        */
+        template<typename T>
+        struct bits_integer<T, true> { using type = std::underlying_type_t<T>; };
+
+        /**
+        * @brief The number of value bits of `T` (1 for `bool`, sign bit included for signed types).
+        */
+        template<typename T>
+        constexpr std::size_t value_digits() noexcept
+        {
+            if constexpr (std::is_same_v<T, bool>) return 1;
+            else return std::numeric_limits<std::make_unsigned_t<typename bits_integer<T>::type>>::digits;
+        }
+
+        /**
+        * @brief The smallest unsigned integer type of at least `N` bits.
+        */
+        template<std::size_t N>
+        using bits_storage_t =
+            std::conditional_t<(N <= 8),  std::uint8_t,
+            std::conditional_t<(N <= 16), std::uint16_t,
+            std::conditional_t<(N <= 32), std::uint32_t, std::uint64_t>>>;
+    }
+
+    /**
+    * @class bits
+    * @brief A value of type `T` that occupies `N` bits on the wire.
+    *
+    * @tparam N The field width in bits.
+    *           `1 <= N <= ` the width of `T`. `N` must be 1 for `bool`.
+    * @tparam T The value type: `bool`, an integer, or an enum. A signed type is sign-extended
+    *           when decoded.
+    *
+    * The object holds the `N`-bit pattern of the value in the smallest unsigned integer that fits
+    * (@ref storage_type). Bits above `N` are always zero. The type is trivially copyable and
+    * `sizeof(bits) == sizeof(storage_type)`, so on its own it travels through the codec like that
+    * integer. Packing starts when two or more `bits` fields are adjacent in one message.
+    *
+    * Comparison goes through the implicit conversion to `T`.
+    */
+    template<std::size_t N, typename T>
+    class bits{
+        static_assert(std::is_integral_v<T> or std::is_enum_v<T>, "bits<N, T> requires an integer, bool or enum T");
+        static_assert(N > 0, "bits<N, T> width N must be strictly positive");
+        static_assert(not std::is_same_v<T, bool> or N == 1, "bits<N, bool> must be exactly one bit wide");
+        static_assert(N <= details::value_digits<T>(), "bits<N, T> width N exceeds the width of T");
+
+    public:
+        /**
+        * @brief The unsigned integer that holds the `N`-bit pattern.
+        */
+        using storage_type = details::bits_storage_t<N>;
+
+        /**
+        * @brief The value type `T`.
+        */
+        using value_type = T;
+
+        /**
+        * @brief The field width in bits.
+        */
+        static constexpr std::size_t width = N;
+
+        /**
+        * @brief A field holding the value zero.
+        */
+        constexpr bits() noexcept;
+
+        /**
+        * @brief Construct from a value of `T`, keeping its low `N` bits.
+        *
+        * @param value The value to store.
+        *
+        * @pre `value` is representable in `N` bits: `0 .. 2^N - 1` for an unsigned `T`,
+        *      `-2^(N-1) .. 2^(N-1) - 1` for a signed one. A value out of range is flagged by
+        *      `assert` in debug builds and truncated to its low `N` bits under `NDEBUG`.
+        */
+        constexpr bits(T value) noexcept;
+
+        /**
+        * @brief The stored value, sign-extended for a signed `T`.
+        * @return The value as `T`.
+        */
+        [[nodiscard]] constexpr T value() const noexcept;
+
+        /**
+        * @brief Implicit conversion to `T`; same as @ref value.
+        */
+        constexpr operator T() const noexcept;
+
+        /**
+        * @brief The raw `N`-bit pattern, zero-extended.
+        * @return The pattern; bits above `N` are zero.
+        */
+        [[nodiscard]] constexpr storage_type raw() const noexcept;
+
+        /**
+        * @brief Build a field from a raw bit pattern, as read from the wire.
+        * @param pattern The pattern; bits above `N` are ignored.
+        * @return The field.
+        */
+        [[nodiscard]] static constexpr bits from_raw(storage_type pattern) noexcept;
+
+        /**
+        * @brief The mask of the `N` value bits of @ref storage_type.
+        * @return `2^N - 1`.
+        */
+        [[nodiscard]] static constexpr storage_type mask() noexcept;
+
+    private:
+        storage_type _raw; ///< The `N`-bit pattern; bits above `N` are zero unless read raw off the wire.
+    };
+
+    /**
+    * @struct is_bits
+    * @brief Detects whether a type is a `bits` specialization.
+    *
+    * @tparam T The type to inspect.
+    * @see is_bits_v
+    */
+    template<typename T>
+    struct is_bits : std::false_type {};
+
+    /**
+    * @brief Specialization of `is_bits` matching any `bits` instantiation.
+    */
+    template<std::size_t N, typename T>
+    struct is_bits<bits<N, T>> : std::true_type {};
+
+    /**
+    * @var is_bits_v
+    * @brief Convenience variable template for `is_bits<T>::value`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    inline constexpr bool is_bits_v = is_bits<T>::value;
+} // namespace eser::utils
+
+namespace eser::internal{
+    /**
+    * @brief A lone `bits` field is its storage integer, and is byte-swapped like one.
+    */
+    template<std::size_t N, typename T>
+    struct has_integer_representation<utils::bits<N, T>> : std::true_type {};
+} // namespace eser::internal
+
+#include "bits.tpp"
+#endif // ESER_UTILS_BITS_HPP_
@@ -0,0 +1,90 @@
+/**
+* @file bits.tpp
+*
+* @brief Definition of functionality in bits.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_UTILS_BITS_TPP_
+#define ESER_UTILS_BITS_TPP_
+#include "bits.hpp"
+#include <cassert>
+
+namespace eser::utils{
+    template<std::size_t N, typename T>
+    constexpr bits<N, T>::bits() noexcept
+    : _raw(0)
+    {
+    }
+
+    template<std::size_t N, typename T>
+    constexpr bits<N, T>::bits(T value) noexcept
+    : _raw(0)
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            _raw = value ? 1 : 0;
+        } else {
+            using integer = typename details::bits_integer<T>::type;
+            const auto number = static_cast<std::make_unsigned_t<integer>>(static_cast<integer>(value));
+            _raw = static_cast<storage_type>(number & mask());
+        }
+        assert(this->value() == value && "bits value does not fit in N bits");
+    }
+
+    template<std::size_t N, typename T>
+    constexpr T bits<N, T>::value() const noexcept
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            return raw() != 0;
+        } else {
+            using integer = typename details::bits_integer<T>::type;
+            using word = std::make_unsigned_t<integer>;
+            // widen first: T may be wider than the storage type
+            word pattern = static_cast<word>(raw());
+            if constexpr (std::is_signed_v<integer>) {
+                // sign-extend the N-bit two's-complement pattern at the width of T
+                if ((pattern >> (N - 1)) & 1u) pattern = static_cast<word>(pattern | static_cast<word>(~static_cast<word>(mask())));
+            }
+            return static_cast<T>(static_cast<integer>(pattern));
+        }
+    }
+
+    template<std::size_t N, typename T>
+    constexpr bits<N, T>::operator T() const noexcept
+    {
+        return value();
+    }
+
+    template<std::size_t N, typename T>
+    constexpr typename bits<N, T>::storage_type bits<N, T>::raw() const noexcept
+    {
+        // mask on read too: a lone field copied wholesale off the wire may carry stray high bits
+        return static_cast<storage_type>(_raw & mask());
+    }
+
+    template<std::size_t N, typename T>
+    constexpr bits<N, T> bits<N, T>::from_raw(storage_type pattern) noexcept
+    {
+        bits field;
+        field._raw = static_cast<storage_type>(pattern & mask());
+        return field;
+    }
+
+    template<std::size_t N, typename T>
+    constexpr typename bits<N, T>::storage_type bits<N, T>::mask() noexcept
+    {
+        return static_cast<storage_type>(static_cast<storage_type>(~storage_type{0}) >> (std::numeric_limits<storage_type>::digits - N));
+    }
+} // namespace eser::utils
+
+#endif // ESER_UTILS_BITS_TPP_
@@ -0,0 +1,139 @@
+/**
+* @file bounded_string.hpp
+*
+* @brief Length-prefixed counterpart of `fixed_string`: up to `N` characters, only the used ones on the wire.
+*
+* @ingroup eser_utils
+*
+* `eser::utils::bounded_string<N>` stores up to `N` characters inline, like `fixed_string<N>`, and
+* also keeps its length. The flat codec writes the length as a compact prefix
+* (@ref bounded_length_t) followed by `size()` characters, so `"ok"` in a 64-byte field costs
+* 3 bytes instead of 64. Use `fixed_string` when every message must have the same size, and
+* `bounded_string` when the strings are usually much shorter than the capacity.
+*
+* ```cpp
+* utils::bounded_string<64> name{"ok"};
+* std::size_t written = flat::serialize(name).to(buffer);                // 1 + 2
+* auto back = flat::deserialize(buffer, written).to<utils::bounded_string<64>>();
+* ```
+*
+* A `fixed_string` converts through its view: `bounded_string<16>{label.view()}`. The stored
+* characters carry no null terminator; use @ref bounded_string::view.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_UTILS_BOUNDED_STRING_HPP_
+#define ESER_UTILS_BOUNDED_STRING_HPP_
+#include <cstddef>
+#include <string_view>
+#include "bounded_vector.hpp"   // for bounded_length_t and is_bounded (specialized below)
+
+namespace eser::utils{
+    /**
+    * @class bounded_string
+    * @brief A string of at most `N` characters, stored inline with its length.
+    *
+    * @tparam N The capacity in characters. Must be strictly positive.
+    *
+    * The type is trivially copyable. Characters past `size()` are zero.
+    */
+    template<std::size_t N>
+    class bounded_string{
+        static_assert(N > 0, "bounded_string capacity N must be strictly positive");
+
+    public:
+        using value_type = char;                   ///< The character type.
+        using size_type = std::size_t;             ///< The size type.
+        using length_type = bounded_length_t<N>;   ///< The wire type of the length prefix.
+
+        /**
+        * @brief An empty string.
+        */
+        constexpr bounded_string() noexcept;
+
+        /**
+        * @brief Construct from a string view, copying up to `N` characters.
+        *
+        * @param source The characters to store. A `const char*` or string literal converts
+        *               implicitly (through `std::string_view`).
+        *
+        * @pre `source.size() <= N`. A longer source is flagged by `assert` in debug builds and
+        *      truncated to `N` under `NDEBUG`, like `fixed_string`.
+        */
+        constexpr bounded_string(std::string_view source) noexcept;
+
+        /**
+        * @brief The contents.
+        * @return A view over the `size()` stored characters.
+        * @warning The view points into this object and must not outlive it.
+        */
+        [[nodiscard]] constexpr std::string_view view() const noexcept;
+
+        /**
+        * @brief The number of characters, O(1).
+        */
+        [[nodiscard]] constexpr size_type size() const noexcept;
+
+        /**
+        * @brief Whether the string is empty.
+        */
+        [[nodiscard]] constexpr bool empty() const noexcept;
+
+        /**
+        * @brief The capacity `N`.
+        */
+        [[nodiscard]] static constexpr size_type capacity() noexcept;
+
+        /**
+        * @brief Pointer to the characters; not null-terminated.
+        */
+        [[nodiscard]] constexpr char* data() noexcept;
+
+        /**
+        * @brief Pointer to the characters (read-only); not null-terminated.
+        */
+        [[nodiscard]] constexpr const char* data() const noexcept;
+
+        /**
+        * @brief Change the length; new characters are `\0`.
+        * @param count The new length.
+        * @pre `count <= N`. A larger count is flagged by `assert` and clamped to `N`.
+        */
+        constexpr void resize(size_type count) noexcept;
+
+        /**
+        * @brief Equality by contents.
+        * @param other The string to compare against.
+        */
+        [[nodiscard]] constexpr bool operator==(const bounded_string &other) const noexcept;
+
+        /**
+        * @brief Inequality; the negation of `operator==`.
+        * @param other The string to compare against.
+        */
+        [[nodiscard]] constexpr bool operator!=(const bounded_string &other) const noexcept;
+
+    private:
+        length_type _size; ///< The number of used characters.
+        char _data[N];     ///< Inline character storage; bytes past `_size` are zero.
+    };
+
+    /**
+    * @brief Specialization of `is_bounded` for `bounded_string`.
+    */
+    template<std::size_t N>
+    struct is_bounded<bounded_string<N>> : std::true_type {};
+} // namespace eser::utils
+
+#include "bounded_string.tpp"
+#endif // ESER_UTILS_BOUNDED_STRING_HPP_
@@ -0,0 +1,83 @@
+/**
+* @file bounded_string.tpp
+*
+* @brief Definition of functionality in bounded_string.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_UTILS_BOUNDED_STRING_TPP_
+#define ESER_UTILS_BOUNDED_STRING_TPP_
+#include "bounded_string.hpp"
+#include <cassert>
+
+namespace eser::utils{
+    template<std::size_t N>
+    constexpr bounded_string<N>::bounded_string() noexcept
+    : _size(0), _data{}
+    {
+    }
+
+    template<std::size_t N>
+    constexpr bounded_string<N>::bounded_string(std::string_view source) noexcept
+    : _size(0), _data{}
+    {
+        assert(source.size() <= N && "bounded_string source exceeds the capacity");
+        const std::size_t count = source.size() < N ? source.size() : N;
+        for (std::size_t i = 0; i < count; ++i) _data[i] = source[i];
+        _size = static_cast<length_type>(count);
+    }
+
+    template<std::size_t N>
+    constexpr std::string_view bounded_string<N>::view() const noexcept
+    {
+        return std::string_view(_data, _size);
+    }
+
+    template<std::size_t N>
+    constexpr std::size_t bounded_string<N>::size() const noexcept { return _size; }
+
+    template<std::size_t N>
+    constexpr bool bounded_string<N>::empty() const noexcept { return _size == 0; }
+
+    template<std::size_t N>
+    constexpr std::size_t bounded_string<N>::capacity() noexcept { return N; }
+
+    template<std::size_t N>
+    constexpr char* bounded_string<N>::data() noexcept { return _data; }
+
+    template<std::size_t N>
+    constexpr const char* bounded_string<N>::data() const noexcept { return _data; }
+
+    template<std::size_t N>
+    constexpr void bounded_string<N>::resize(size_type count) noexcept
+    {
+        assert(count <= N && "bounded_string resized past its capacity");
+        if (count > N) count = N;
+        for (std::size_t i = count; i < _size; ++i) _data[i] = '\0';
+        _size = static_cast<length_type>(count);
+    }
+
+    template<std::size_t N>
+    constexpr bool bounded_string<N>::operator==(const bounded_string &other) const noexcept
+    {
+        return view() == other.view();
+    }
+
+    template<std::size_t N>
+    constexpr bool bounded_string<N>::operator!=(const bounded_string &other) const noexcept
+    {
+        return not (*this == other);
+    }
+} // namespace eser::utils
+
+#endif // ESER_UTILS_BOUNDED_STRING_TPP_
@@ -0,0 +1,215 @@
+/**
+* @file bounded_vector.hpp
+*
+* @brief Fixed-capacity sequence field whose wire image is a length prefix and the used elements.
+*
+* @ingroup eser_utils
+*
+* This header defines `eser::utils::bounded_vector`, an inline array of up to `N` elements of `T`
+* with a current size. It never allocates: the storage is part of the object. On the wire the
+* flat codec writes a compact length prefix (@ref bounded_length_t) followed by the `size()` used
+* elements only, so a 64-element payload that usually holds 5 costs 5 elements plus one byte:
+*
+* ```cpp
+* utils::bounded_vector<std::uint16_t, 64> samples{10, 20, 30};
+*
+* std::byte buffer[flat::max_serialized_size_of<decltype(samples)>()];   // 1 + 64 * 2
+* std::size_t written = flat::serialize(samples).to(buffer);             // 1 + 3 * 2
+* auto back = flat::deserialize(buffer, written).to<decltype(samples)>();
+* ```
+*
+* The message is no longer fixed-size, so `serialized_size_of` rejects it. Size buffers with the
+* compile-time bound `max_serialized_size_of`, or with the exact `serialized_size(values...)`.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_UTILS_BOUNDED_VECTOR_HPP_
+#define ESER_UTILS_BOUNDED_VECTOR_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+namespace eser::utils{
+    /**
+    * @brief The unsigned integer type of the length prefix of a bounded field of capacity `N`:
+    *        1 byte up to 255 elements, 2 bytes up to 65535, 4 bytes beyond.
+    * @tparam N The capacity.
+    */
+    template<std::size_t N>
+    using bounded_length_t =
+        std::conditional_t<(N <= 0xFFu), std::uint8_t,
+        std::conditional_t<(N <= 0xFFFFu), std::uint16_t, std::uint32_t>>;
+
+    /**
+    * @class bounded_vector
+    * @brief A sequence of at most `N` elements of `T`, stored inline.
+    *
+    * @tparam T The element type. Must be trivially copyable and have a fixed wire size (a scalar,
+    *           enum, `std::array`, `fixed_string`, struct, ...).
+    * @tparam N The capacity. Must be strictly positive.
+    *
+    * The type is trivially copyable. Elements past `size()` are value-initialized by every
+    * constructor, `clear` and `resize`, so two vectors with equal contents are equal byte for byte.
+    */
+    template<typename T, std::size_t N>
+    class bounded_vector{
+        static_assert(N > 0, "bounded_vector capacity N must be strictly positive");
+        static_assert(std::is_trivially_copyable_v<T>, "bounded_vector elements must be trivially copyable");
+
+    public:
+        using value_type = T;                      ///< The element type.
+        using size_type = std::size_t;             ///< The size type.
+        using length_type = bounded_length_t<N>;   ///< The wire type of the length prefix.
+        using iterator = T*;                       ///< Mutable iterator.
+        using const_iterator = const T*;           ///< Read-only iterator.
+
+        /**
+        * @brief An empty vector.
+        */
+        constexpr bounded_vector() noexcept;
+
+        /**
+        * @brief Construct from a list of elements.
+        *
+        * @param elements The elements, in order.
+        *
+        * @pre `elements.size() <= N`. Excess elements are flagged by `assert` in debug builds and
+        *      dropped under `NDEBUG`.
+        */
+        constexpr bounded_vector(std::initializer_list<T> elements) noexcept;
+
+        /**
+        * @brief Construct from `count` contiguous elements.
+        *
+        * @param first The first element.
+        * @param count The number of elements.
+        *
+        * @pre `count <= N`; see the `initializer_list` constructor.
+        */
+        constexpr bounded_vector(const T *first, size_type count) noexcept;
+
+        /**
+        * @brief Append one element.
+        * @param value The element.
+        * @return `false` (and no change) if the vector is full.
+        */
+        constexpr bool push_back(const T &value) noexcept;
+
+        /**
+        * @brief Remove the last element.
+        * @pre `not empty()` (checked by `assert`).
+        */
+        constexpr void pop_back() noexcept;
+
+        /**
+        * @brief Change the size; new elements are value-initialized.
+        * @param count The new size.
+        * @pre `count <= N`. A larger count is flagged by `assert` and clamped to `N`.
+        */
+        constexpr void resize(size_type count) noexcept;
+
+        /**
+        * @brief Remove every element.
+        */
+        constexpr void clear() noexcept;
+
+        /**
+        * @brief The number of elements.
+        */
+        [[nodiscard]] constexpr size_type size() const noexcept;
+
+        /**
+        * @brief Whether the vector holds no element.
+        */
+        [[nodiscard]] constexpr bool empty() const noexcept;
+
+        /**
+        * @brief The capacity `N`.
+        */
+        [[nodiscard]] static constexpr size_type capacity() noexcept;
+
+        /**
+        * @brief Pointer to the first element.
+        */
+        [[nodiscard]] constexpr T* data() noexcept;
+
+        /**
+        * @brief Pointer to the first element (read-only).
+        */
+        [[nodiscard]] constexpr const T* data() const noexcept;
+
+        /**
+        * @brief Element access; `index < size()` (checked by `assert`).
+        */
+        [[nodiscard]] constexpr T& operator[](size_type index) noexcept;
+
+        /**
+        * @brief Read-only element access; `index < size()` (checked by `assert`).
+        */
+        [[nodiscard]] constexpr const T& operator[](size_type index) const noexcept;
+
+        [[nodiscard]] constexpr iterator begin() noexcept;              ///< Iterator to the first element.
+        [[nodiscard]] constexpr iterator end() noexcept;                ///< Iterator past the last element.
+        [[nodiscard]] constexpr const_iterator begin() const noexcept;  ///< Iterator to the first element.
+        [[nodiscard]] constexpr const_iterator end() const noexcept;    ///< Iterator past the last element.
+
+        /**
+        * @brief Equality by size and elements.
+        * @param other The vector to compare against.
+        * @return `true` if both hold the same elements in the same order.
+        */
+        [[nodiscard]] constexpr bool operator==(const bounded_vector &other) const noexcept;
+
+        /**
+        * @brief Inequality; the negation of `operator==`.
+        * @param other The vector to compare against.
+        */
+        [[nodiscard]] constexpr bool operator!=(const bounded_vector &other) const noexcept;
+
+    private:
+        length_type _size; ///< The number of used elements.
+        T _data[N];        ///< Inline element storage; elements past `_size` are value-initialized.
+    };
+
+    /**
+    * @struct is_bounded
+    * @brief Detects the length-prefixed field types (`bounded_vector`, `bounded_string`).
+    *
+    * A bounded type exposes `value_type`, `length_type`, `size()`, `capacity()`, `data()` and
+    * `resize()`; the flat codec writes `size()` as a `length_type` prefix followed by the used
+    * elements.
+    *
+    * @tparam T The type to inspect.
+    * @see is_bounded_v
+    */
+    template<typename T>
+    struct is_bounded : std::false_type {};
+
+    /**
+    * @brief Specialization of `is_bounded` for `bounded_vector`.
+    */
+    template<typename T, std::size_t N>
+    struct is_bounded<bounded_vector<T, N>> : std::true_type {};
+
+    /**
+    * @var is_bounded_v
+    * @brief Convenience variable template for `is_bounded<T>::value`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    inline constexpr bool is_bounded_v = is_bounded<T>::value;
+} // namespace eser::utils
+
+#include "bounded_vector.tpp"
+#endif // ESER_UTILS_BOUNDED_VECTOR_HPP_
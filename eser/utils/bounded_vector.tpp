@@ -0,0 +1,133 @@
+/**
+* @file bounded_vector.tpp
+*
+* @brief Definition of functionality in bounded_vector.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_UTILS_BOUNDED_VECTOR_TPP_
+#define ESER_UTILS_BOUNDED_VECTOR_TPP_
+#include "bounded_vector.hpp"
+#include <cassert>
+
+namespace eser::utils{
+    template<typename T, std::size_t N>
+    constexpr bounded_vector<T, N>::bounded_vector() noexcept
+    : _size(0), _data{}
+    {
+    }
+
+    template<typename T, std::size_t N>
+    constexpr bounded_vector<T, N>::bounded_vector(std::initializer_list<T> elements) noexcept
+    : bounded_vector(elements.begin(), elements.size())
+    {
+    }
+
+    template<typename T, std::size_t N>
+    constexpr bounded_vector<T, N>::bounded_vector(const T *first, size_type count) noexcept
+    : _size(0), _data{}
+    {
+        assert(count <= N && "bounded_vector source exceeds the capacity");
+        if (count > N) count = N;
+        for (size_type i = 0; i < count; ++i) _data[i] = first[i];
+        _size = static_cast<length_type>(count);
+    }
+
+    template<typename T, std::size_t N>
+    constexpr bool bounded_vector<T, N>::push_back(const T &value) noexcept
+    {
+        if (_size == N) return false;
+        _data[_size++] = value;
+        return true;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr void bounded_vector<T, N>::pop_back() noexcept
+    {
+        assert(_size != 0 && "pop_back on an empty bounded_vector");
+        if (_size != 0) _data[--_size] = T{};
+    }
+
+    template<typename T, std::size_t N>
+    constexpr void bounded_vector<T, N>::resize(size_type count) noexcept
+    {
+        assert(count <= N && "bounded_vector resized past its capacity");
+        if (count > N) count = N;
+        for (size_type i = count; i < _size; ++i) _data[i] = T{};
+        _size = static_cast<length_type>(count);
+    }
+
+    template<typename T, std::size_t N>
+    constexpr void bounded_vector<T, N>::clear() noexcept
+    {
+        resize(0);
+    }
+
+    template<typename T, std::size_t N>
+    constexpr std::size_t bounded_vector<T, N>::size() const noexcept { return _size; }
+
+    template<typename T, std::size_t N>
+    constexpr bool bounded_vector<T, N>::empty() const noexcept { return _size == 0; }
+
+    template<typename T, std::size_t N>
+    constexpr std::size_t bounded_vector<T, N>::capacity() noexcept { return N; }
+
+    template<typename T, std::size_t N>
+    constexpr T* bounded_vector<T, N>::data() noexcept { return _data; }
+
+    template<typename T, std::size_t N>
+    constexpr const T* bounded_vector<T, N>::data() const noexcept { return _data; }
+
+    template<typename T, std::size_t N>
+    constexpr T& bounded_vector<T, N>::operator[](size_type index) noexcept
+    {
+        assert(index < _size && "bounded_vector index out of range");
+        return _data[index];
+    }
+
+    template<typename T, std::size_t N>
+    constexpr const T& bounded_vector<T, N>::operator[](size_type index) const noexcept
+    {
+        assert(index < _size && "bounded_vector index out of range");
+        return _data[index];
+    }
+
+    template<typename T, std::size_t N>
+    constexpr T* bounded_vector<T, N>::begin() noexcept { return _data; }
+
+    template<typename T, std::size_t N>
+    constexpr T* bounded_vector<T, N>::end() noexcept { return _data + _size; }
+
+    template<typename T, std::size_t N>
+    constexpr const T* bounded_vector<T, N>::begin() const noexcept { return _data; }
+
+    template<typename T, std::size_t N>
+    constexpr const T* bounded_vector<T, N>::end() const noexcept { return _data + _size; }
+
+    template<typename T, std::size_t N>
+    constexpr bool bounded_vector<T, N>::operator==(const bounded_vector &other) const noexcept
+    {
+        if (_size != other._size) return false;
+        for (size_type i = 0; i < _size; ++i)
+            if (not (_data[i] == other._data[i])) return false;
+        return true;
+    }
+
+    template<typename T, std::size_t N>
+    constexpr bool bounded_vector<T, N>::operator!=(const bounded_vector &other) const noexcept
+    {
+        return not (*this == other);
+    }
+} // namespace eser::utils
+
+#endif // ESER_UTILS_BOUNDED_VECTOR_TPP_
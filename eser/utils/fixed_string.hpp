@@ -30,11 +30,14 @@
 * @par Changelog
 * - 2026-06-24
 * -     Initial creation.
+* - 2026-10-14
+*       Added `is_fixed_string` / `is_fixed_string_v`.
 */
 #ifndef ESER_UTILS_FIXED_STRING_HPP_
 #define ESER_UTILS_FIXED_STRING_HPP_
 #include <cstddef>
 #include <string_view>
+#include <type_traits>
 #include "endianness.hpp"   // for is_endianness_neutral (specialized below)
 
 namespace eser::utils{
@@ -171,6 +174,30 @@ namespace eser::utils{
     */
     template<std::size_t N>
     struct is_endianness_neutral<fixed_string<N>> : std::true_type {};
+
+    /**
+    * @struct is_fixed_string
+    * @brief Detects whether a type is a `fixed_string` specialization.
+    *
+    * @tparam T The type to inspect.
+    * @see is_fixed_string_v
+    */
+    template<typename T>
+    struct is_fixed_string : std::false_type {};
+
+    /**
+    * @brief Specialization of `is_fixed_string` matching any `fixed_string` instantiation.
+    */
+    template<std::size_t N>
+    struct is_fixed_string<fixed_string<N>> : std::true_type {};
+
+    /**
+    * @var is_fixed_string_v
+    * @brief Convenience variable template for `is_fixed_string<T>::value`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    inline constexpr bool is_fixed_string_v = is_fixed_string<T>::value;
 } // namespace eser::utils
 
 #include "fixed_string.tpp"
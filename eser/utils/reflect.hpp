@@ -0,0 +1,282 @@
+/**
+* @file reflect.hpp
+*
+* @brief Member descriptions for trivially-copyable structs (`ESER_REFLECT`), so the codec can
+*        reach their fields.
+*
+* @ingroup eser_utils
+*
+* The flat codec writes a trivially-copyable struct as its object representation. On a wire of the
+* host's byte order that is one `memcpy`, but on the other byte order the raw bytes cannot be
+* swapped: nothing says where one member ends and the next begins. `ESER_REFLECT` lists the
+* members, next to the struct:
+*
+* ```cpp
+* struct sample{
+*     std::uint8_t  channel;
+*     std::uint32_t value;      // 3 bytes of padding before it
+*     std::int16_t  offset;
+* };
+* ESER_REFLECT(sample, channel, value, offset);
+*
+* flat::serialize<endianness::big>(s).to(buffer);   // each member byte-swapped at its offset
+* ```
+*
+* A described struct keeps its wire image: `sizeof(sample)` bytes, each member at its offset. On a
+* non-native wire every member is converted on its own (nested described structs and arrays
+* recursively) and the padding is written as zero instead of being copied. On a native wire, or when
+* no member needs swapping, the struct is still one `memcpy`.
+*
+* ## Packed layout
+*
+* `ESER_REFLECT_PACKED` describes the members the same way but drops the padding from the wire: the
+* members are written back to back, in the listed order, and `serialized_size_of` reports their sum.
+* A `{uint8_t; uint32_t; uint8_t}` struct takes 6 bytes instead of 12. When the listed members
+* already tile the struct in declaration order with nothing to swap, the packed image is the object
+* representation and the struct is still one `memcpy`.
+*
+* ```cpp
+* struct record{ std::uint8_t kind; std::uint32_t stamp; std::uint8_t level; };
+* ESER_REFLECT_PACKED(record, kind, stamp, level);
+* static_assert(flat::serialized_size_of<record>() == 6);
+* ```
+*
+* Both macros go at namespace scope, in the namespace of the struct (they declare a function found
+* by argument-dependent lookup), and take up to 32 members. The struct must be standard-layout and
+* trivially copyable. List every member: with `ESER_REFLECT` unlisted ones are written as zero on a
+* non-native wire, with `ESER_REFLECT_PACKED` they are never written.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+* - 2026-10-14
+* -     Added `wire_layout`, `ESER_REFLECT_PACKED` and `is_packed_v`.
+*/
+#ifndef ESER_UTILS_REFLECT_HPP_
+#define ESER_UTILS_REFLECT_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace eser::utils{
+    namespace details{
+        /**
+        * @brief The class and member types of a pointer to data member.
+        */
+        template<typename Pointer>
+        struct member_pointer;
+
+        /**
+        * @brief Specialization of `member_pointer` for `Value Class::*`.
+        */
+        template<typename Class, typename Value>
+        struct member_pointer<Value Class::*>{
+            using class_type = Class;   ///< The struct.
+            using value_type = Value;   ///< The member type.
+        };
+    } // namespace details
+
+    /**
+    * @struct member
+    * @brief One described member: its pointer and its byte offset in the struct.
+    *
+    * @tparam Pointer The pointer to data member (`&T::m`).
+    * @tparam Offset `offsetof(T, m)`.
+    */
+    template<auto Pointer, std::size_t Offset>
+    struct member{
+        using class_type = typename details::member_pointer<decltype(Pointer)>::class_type;   ///< The struct.
+        using value_type = typename details::member_pointer<decltype(Pointer)>::value_type;   ///< The member type.
+
+        static constexpr std::size_t offset = Offset;   ///< Byte offset of the member in the struct.
+
+        /**
+        * @brief The member of `object`.
+        */
+        static constexpr const value_type &get(const class_type &object) noexcept { return object.*Pointer; }
+
+        /**
+        * @brief The member of `object`.
+        */
+        static constexpr value_type &get(class_type &object) noexcept { return object.*Pointer; }
+    };
+
+    /**
+    * @enum wire_layout
+    * @brief How a described struct is laid out on the wire.
+    */
+    enum class wire_layout : std::uint8_t{
+        image,   ///< `sizeof(T)` bytes, each member at its offset (`ESER_REFLECT`).
+        packed   ///< The members back to back, without padding (`ESER_REFLECT_PACKED`).
+    };
+
+    /**
+    * @struct reflection
+    * @brief The member list of a struct, as declared by `ESER_REFLECT` or `ESER_REFLECT_PACKED`.
+    *
+    * @tparam T The struct.
+    * @tparam Layout The wire layout.
+    * @tparam Members... One @ref member per listed member, in the listed order.
+    */
+    template<typename T, wire_layout Layout, typename... Members>
+    struct reflection{
+        static_assert(sizeof...(Members) > 0, "ESER_REFLECT needs at least one member");
+        static_assert(std::is_standard_layout_v<T>, "[eser] ESER_REFLECT needs a standard-layout struct (member offsets come from offsetof)");
+        static_assert(std::is_trivially_copyable_v<T>, "[eser] ESER_REFLECT describes trivially-copyable structs only");
+        static_assert((... and std::is_same_v<typename Members::class_type, T>), "ESER_REFLECT members must belong to the described struct");
+
+        using type = T;                                              ///< The struct.
+        static constexpr std::size_t count = sizeof...(Members);    ///< Number of described members.
+
+        /**
+        * @brief Whether the members cover every byte of `T` (no padding, nothing left out).
+        */
+        static constexpr bool padding_free = (... + sizeof(typename Members::value_type)) == sizeof(T);
+
+        static constexpr wire_layout layout = Layout;   ///< The wire layout.
+
+        /**
+        * @brief Whether the members tile `T` in the listed order: each starts where the previous
+        *        one ends, and together they cover every byte.
+        */
+        static constexpr bool contiguous = [](){
+            constexpr std::size_t offsets[] = {Members::offset...};
+            constexpr std::size_t sizes[] = {sizeof(typename Members::value_type)...};
+            std::size_t end = 0;
+            for (std::size_t i = 0; i < sizeof...(Members); ++i) {
+                if (offsets[i] != end) return false;
+                end += sizes[i];
+            }
+            return end == sizeof(T);
+        }();
+
+        /**
+        * @brief Call `f(Members{})` for every member, in the listed order.
+        */
+        template<typename F>
+        static constexpr void for_each(F &&f)
+        {
+            (f(Members{}), ...);
+        }
+    };
+
+    namespace details{
+        /**
+        * @brief The `reflection` declared for `T`, found by argument-dependent lookup; `void` if none.
+        */
+        template<typename T, typename = void>
+        struct reflection_of { using type = void; };
+
+        /**
+        * @brief Specialization of `reflection_of` for a struct described with `ESER_REFLECT`.
+        */
+        template<typename T>
+        struct reflection_of<T, std::enable_if_t<std::is_class_v<T>, std::void_t<decltype(eser_reflect(static_cast<const T *>(nullptr)))>>>{
+            using type = decltype(eser_reflect(static_cast<const T *>(nullptr)));
+        };
+    } // namespace details
+
+    /**
+    * @brief The @ref reflection of `T`, or `void` if `T` is not described.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    using reflection_t = typename details::reflection_of<T>::type;
+
+    /**
+    * @var is_reflected_v
+    * @brief Whether `T` was described with `ESER_REFLECT`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    inline constexpr bool is_reflected_v = not std::is_void_v<reflection_t<T>>;
+
+    /**
+    * @var is_packed_v
+    * @brief Whether `T` was described with `ESER_REFLECT_PACKED`.
+    * @tparam T The type to inspect.
+    */
+    template<typename T>
+    inline constexpr bool is_packed_v = [](){
+        if constexpr (is_reflected_v<T>) return reflection_t<T>::layout == wire_layout::packed;
+        else return false;
+    }();
+} // namespace eser::utils
+
+/// @cond ESER_INTERNAL
+#define ESER_INTERNAL_EXPAND(x) x
+#define ESER_INTERNAL_FE_1(F, T, x) F(T, x)
+#define ESER_INTERNAL_FE_2(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_1(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_3(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_2(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_4(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_3(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_5(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_4(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_6(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_5(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_7(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_6(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_8(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_7(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_9(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_8(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_10(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_9(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_11(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_10(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_12(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_11(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_13(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_12(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_14(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_13(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_15(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_14(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_16(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_15(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_17(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_16(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_18(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_17(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_19(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_18(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_20(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_19(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_21(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_20(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_22(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_21(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_23(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_22(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_24(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_23(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_25(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_24(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_26(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_25(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_27(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_26(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_28(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_27(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_29(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_28(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_30(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_29(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_31(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_30(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_32(F, T, x, ...) F(T, x), ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_31(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_FE_PICK(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, _17, _18, _19, _20, _21, _22, _23, _24, _25, _26, _27, _28, _29, _30, _31, _32, N, ...) N
+#define ESER_INTERNAL_FOR_EACH(F, T, ...) \
+    ESER_INTERNAL_EXPAND(ESER_INTERNAL_FE_PICK(__VA_ARGS__, ESER_INTERNAL_FE_32, ESER_INTERNAL_FE_31, ESER_INTERNAL_FE_30, ESER_INTERNAL_FE_29, ESER_INTERNAL_FE_28, ESER_INTERNAL_FE_27, ESER_INTERNAL_FE_26, ESER_INTERNAL_FE_25, ESER_INTERNAL_FE_24, ESER_INTERNAL_FE_23, ESER_INTERNAL_FE_22, ESER_INTERNAL_FE_21, ESER_INTERNAL_FE_20, ESER_INTERNAL_FE_19, ESER_INTERNAL_FE_18, ESER_INTERNAL_FE_17, ESER_INTERNAL_FE_16, ESER_INTERNAL_FE_15, ESER_INTERNAL_FE_14, ESER_INTERNAL_FE_13, ESER_INTERNAL_FE_12, ESER_INTERNAL_FE_11, ESER_INTERNAL_FE_10, ESER_INTERNAL_FE_9, ESER_INTERNAL_FE_8, ESER_INTERNAL_FE_7, ESER_INTERNAL_FE_6, ESER_INTERNAL_FE_5, ESER_INTERNAL_FE_4, ESER_INTERNAL_FE_3, ESER_INTERNAL_FE_2, ESER_INTERNAL_FE_1)(F, T, __VA_ARGS__))
+#define ESER_INTERNAL_REFLECT_MEMBER(T, m) ::eser::utils::member<&T::m, offsetof(T, m)>
+#define ESER_INTERNAL_REFLECT(Type, Layout, ...) \
+    constexpr ::eser::utils::reflection<Type, Layout, ESER_INTERNAL_FOR_EACH(ESER_INTERNAL_REFLECT_MEMBER, Type, __VA_ARGS__)> \
+    eser_reflect(const Type *) noexcept { return {}; } \
+    static_assert(true, "")
+/// @endcond
+
+/**
+* @def ESER_REFLECT
+* @brief Describe the members of a trivially-copyable struct for the codec.
+*
+* Use at namespace scope, in the struct's namespace, after its definition.
+*
+* @param Type The struct.
+* @param ... Its members, by name, in declaration order (up to 32).
+*/
+#define ESER_REFLECT(Type, ...) \
+    ESER_INTERNAL_REFLECT(Type, ::eser::utils::wire_layout::image, __VA_ARGS__)
+
+/**
+* @def ESER_REFLECT_PACKED
+* @brief Describe the members of a trivially-copyable struct and write them without padding.
+*
+* Use like `ESER_REFLECT`. The members go on the wire back to back, in the listed order.
+*
+* @param Type The struct.
+* @param ... Its members, by name (up to 32).
+*/
+#define ESER_REFLECT_PACKED(Type, ...) \
+    ESER_INTERNAL_REFLECT(Type, ::eser::utils::wire_layout::packed, __VA_ARGS__)
+
+#endif // ESER_UTILS_REFLECT_HPP_
@@ -10,6 +10,10 @@
 * The `eser_utils` group is the public utility surface:
 * - The byte-order policy (`endianness.hpp`: the `endianness` enum and `is_endianness_neutral`)
 * - A fixed-capacity string value type (`fixed_string.hpp`)
+* - A narrow, bit-packed integer field (`bits.hpp`)
+* - Length-prefixed bounded containers (`bounded_vector.hpp`, `bounded_string.hpp`)
+* - Member descriptions of structs (`reflect.hpp`, `ESER_REFLECT`)
+* - A bump allocator and arena-backed length-prefixed fields (`arena.hpp`)
 *
 * (Internal machinery — the requirements guard, type traits, and byte-swapping helpers — lives in
 * `eser/internal/` and is not part of the public API.)
@@ -34,9 +38,22 @@
 * - 2026-06-24
 *       Internal machinery (`byte.hpp`, `traits.hpp`, endianness host-detection/byte-swapping)
 *       moved to `eser/internal/`; `utils/` now holds only the public surface.
+* - 2026-10-14
+*       Added `bits.hpp`.
+* - 2026-10-14
+*       Added `bounded_vector.hpp` and `bounded_string.hpp`.
+* - 2026-10-14
+*       Added `reflect.hpp`.
+* - 2026-10-14
+*       Added `arena.hpp`.
 */
 #ifndef ESER_UTILS_UTILS_HPP_
 #define ESER_UTILS_UTILS_HPP_
 #include "endianness.hpp"
 #include "fixed_string.hpp"
+#include "bits.hpp"
+#include "bounded_vector.hpp"
+#include "bounded_string.hpp"
+#include "reflect.hpp"
+#include "arena.hpp"
 #endif // ESER_UTILS_UTILS_HPP_
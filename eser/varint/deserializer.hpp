@@ -0,0 +1,154 @@
+/**
+* @file deserializer.hpp
+*
+* @ingroup eser_varint
+*
+* @brief Deserialization front-end of the variable-length (LEB128 / zigzag) codec.
+*
+* `eser::varint::deserialize(data, length).to<T>()` mirrors `eser::flat::deserialize`: a consuming
+* cursor whose `to<T>()` returns `std::optional<T>`, `std::nullopt` when the input is too short or
+* malformed. Malformed means a varint longer than its type allows, a non-minimal (overlong)
+* encoding such as `80 00` for 0, or a value that does not fit in the named type (e.g. 300 read as
+* `std::uint8_t`). The encoder always writes the minimal encoding, so every value has exactly one.
+*
+* Integer decoding is branch-light: while at least 8 input bytes remain, the next 8 are loaded as
+* one word, the terminating byte is located with a count-trailing-zeros of the continuation bits,
+* and the 7-bit groups are compacted with shifts and masks (or one `pext` on BMI2 targets). Only
+* the last few bytes of a buffer, and 9- or 10-byte `uint64_t` values, take a byte loop.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_VARINT_DESERIALIZER_HPP_
+#define ESER_VARINT_DESERIALIZER_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include "../internal/byte.hpp"
+#include "../internal/traits.hpp"
+#include "size.hpp"
+
+namespace eser::varint{
+    /**
+    * @class deserializer
+    * @brief A consuming reader over a varint-encoded byte stream.
+    *
+    * Every `to()` is all-or-nothing: on failure nothing is consumed.
+    *
+    * @note Create instances with `deserialize()`.
+    */
+    class deserializer{
+    public:
+        /**
+        * @brief Read one value: an integer, enum, `bool`, floating-point value or `std::array`.
+        * @tparam T The type to read.
+        * @return `std::nullopt` if the input is too short or malformed; otherwise the value.
+        */
+        template<typename T, std::enable_if_t<not std::is_array_v<T> and not internal::is_tuple_v<T>, bool> = true>
+        [[nodiscard]] std::optional<T> to() noexcept;
+
+        /**
+        * @brief Read a C-array, returned as the matching `std::array`.
+        * @tparam T A bounded C-array type.
+        * @return `std::nullopt` if the input is too short or malformed; otherwise the array.
+        */
+        template<typename T, std::enable_if_t<std::is_array_v<T> and (std::extent_v<T> > 0), bool> = true>
+        [[nodiscard]] std::optional<internal::as_std_array_t<T>> to() noexcept;
+
+        /**
+        * @brief Read several values in order.
+        * @tparam Tuple A `std::tuple<Es...>` of readable types.
+        * @return `std::nullopt` if any element fails (nothing is consumed); otherwise the tuple.
+        */
+        template<typename Tuple, std::enable_if_t<internal::is_tuple_v<Tuple>, bool> = true>
+        [[nodiscard]] std::optional<Tuple> to() noexcept;
+
+        /**
+        * @brief The number of unread bytes.
+        */
+        [[nodiscard]] constexpr std::size_t available() const noexcept;
+
+    private:
+        const std::byte *_data;   ///< The next unread byte.
+        std::size_t _length;      ///< The number of unread bytes.
+
+        /**
+        * @brief Decode one value; on failure the cursor may have moved (callers restore it).
+        * @return `false` if the input is too short or malformed.
+        */
+        template<typename T>
+        bool deserialize_impl(T &out) noexcept;
+
+        /**
+        * @brief Tuple back-end for `to<std::tuple<Es...>>()`.
+        */
+        template<typename... Es>
+        std::optional<std::tuple<Es...>> to_impl(internal::type_identity<std::tuple<Es...>>) noexcept;
+
+        /**
+        * @brief Construct a deserializer.
+        * @param data Pointer to the byte stream.
+        * @param length Length of the byte stream.
+        */
+        constexpr explicit deserializer(const std::byte *data, std::size_t length) noexcept;
+
+        friend constexpr deserializer deserialize(const std::byte *data, std::size_t length) noexcept;
+    };
+
+    /**
+    * @brief Create a varint reader over `length` bytes at `data`.
+    * @param data Pointer to the byte stream (non-null).
+    * @param length Length of the byte stream; trusted, as in `flat::deserialize`.
+    * @return A `deserializer` over the bytes.
+    */
+    constexpr deserializer deserialize(const std::byte *data, std::size_t length) noexcept;
+
+    /**
+    * @brief Create a varint reader over a fixed-size byte array.
+    * @tparam N The length of the array.
+    * @param data The byte array.
+    * @return A `deserializer` over the array.
+    */
+    template<std::size_t N>
+    constexpr deserializer deserialize(const std::byte (&data)[N]) noexcept
+    {
+        return deserialize(data, N);
+    }
+
+    /**
+    * @brief Create a varint reader over a legacy `uint8_t` buffer.
+    * @param data Pointer to the byte stream (non-null).
+    * @param length Length of the byte stream.
+    * @return A `deserializer` over the bytes.
+    */
+    inline deserializer deserialize(const std::uint8_t *data, std::size_t length) noexcept
+    {
+        return deserialize(static_cast<const std::byte *>(static_cast<const void *>(data)), length);
+    }
+
+    /**
+    * @brief Create a varint reader over a legacy fixed-size `uint8_t` array.
+    * @tparam N The length of the array.
+    * @param data The byte array.
+    * @return A `deserializer` over the array.
+    */
+    template<std::size_t N>
+    inline deserializer deserialize(const std::uint8_t (&data)[N]) noexcept
+    {
+        return deserialize(data, N);
+    }
+} // namespace eser::varint
+
+#include "deserializer.tpp"
+#endif // ESER_VARINT_DESERIALIZER_HPP_
@@ -0,0 +1,213 @@
+/**
+* @file deserializer.tpp
+*
+* @brief Definition of functionality in deserializer.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+* - 2026-10-14
+*       `decode_unsigned` rejects non-minimal encodings (a zero terminating byte after the first).
+*/
+#ifndef ESER_VARINT_DESERIALIZER_TPP_
+#define ESER_VARINT_DESERIALIZER_TPP_
+#include "deserializer.hpp"
+#include "../flat/deserializer.hpp"
+#include "../internal/byteswap.hpp"
+#include "../internal/endianness.hpp"
+#include <cassert>
+#include <cstring>
+#include <limits>
+
+#if defined(__BMI2__) && !defined(ESER_NO_SIMD)
+    #include <immintrin.h>
+    #define ESER_VARINT_PEXT 1
+#endif
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace eser::varint{
+    namespace details{
+        /**
+        * @brief Index of the lowest set bit of a non-zero word.
+        */
+        inline unsigned lowest_set_bit(std::uint64_t word) noexcept
+        {
+            #if defined(__GNUC__) || defined(__clang__)
+                return static_cast<unsigned>(__builtin_ctzll(word));
+            #elif defined(_MSC_VER) && defined(_M_X64)
+                unsigned long index;
+                _BitScanForward64(&index, word);
+                return static_cast<unsigned>(index);
+            #else
+                unsigned index = 0;
+                while ((word & 1u) == 0) word >>= 1, ++index;
+                return index;
+            #endif
+        }
+
+        /**
+        * @brief Gather the low 7 bits of each of the 8 bytes of `word` into one 56-bit value.
+        */
+        inline std::uint64_t compact_groups(std::uint64_t word) noexcept
+        {
+            #if defined(ESER_VARINT_PEXT)
+                return _pext_u64(word, 0x7F7F7F7F7F7F7F7Full);
+            #else
+                word &= 0x7F7F7F7F7F7F7F7Full;
+                // pairs of groups: 7 + 7 bits in each 16-bit lane
+                word = (word & 0x007F007F007F007Full) | ((word & 0x7F007F007F007F00ull) >> 1);
+                // 14 + 14 bits in each 32-bit lane
+                word = (word & 0x00003FFF00003FFFull) | ((word & 0x3FFF00003FFF0000ull) >> 2);
+                // 28 + 28 bits
+                return (word & 0x000000000FFFFFFFull) | ((word & 0x0FFFFFFF00000000ull) >> 4);
+            #endif
+        }
+
+        /**
+        * @brief Decode one LEB128 value of at most `MaxLength` bytes that must not exceed `Max`.
+        *
+        * @param data The input cursor; advanced past the varint on success.
+        * @param length The unread byte count; reduced on success.
+        * @param out Receives the decoded value.
+        * @return `false` (cursor untouched) if the input is truncated, longer than `MaxLength`, not
+        *         the minimal encoding (a zero terminating byte after the first), or out of range.
+        */
+        template<std::size_t MaxLength, std::uint64_t Max>
+        inline bool decode_unsigned(const std::byte *&data, std::size_t &length, std::uint64_t &out) noexcept
+        {
+            if (length >= 8) {
+                std::uint64_t word;
+                std::memcpy(&word, data, sizeof(word));
+                if constexpr (internal::host_endianness == utils::endianness::big) word = internal::byteswap(word);
+                // a clear high bit ends the varint; find the first one
+                const std::uint64_t stops = ~word & 0x8080808080808080ull;
+                if (stops != 0) {
+                    const std::size_t used = lowest_set_bit(stops) / 8 + 1;
+                    if (used > MaxLength) return false;
+                    // a zero terminating byte after the first adds nothing: not the minimal encoding
+                    if (used > 1 and ((word >> ((used - 1) * 8)) & 0xFF) == 0) return false;
+                    const std::uint64_t kept = used == 8 ? word : word & ((std::uint64_t{1} << (used * 8)) - 1);
+                    const std::uint64_t value = compact_groups(kept);
+                    if (value > Max) return false;
+                    out = value, data += used, length -= used;
+                    return true;
+                }
+                if constexpr (MaxLength <= 8) return false;
+            }
+            std::uint64_t value = 0;
+            for (std::size_t i = 0; i < MaxLength and i < length; ++i) {
+                const auto byte = std::to_integer<std::uint64_t>(data[i]);
+                const unsigned shift = static_cast<unsigned>(7 * i);
+                // the tenth byte of a uint64_t carries a single bit
+                if (shift == 63 and (byte & 0x7E) != 0) return false;
+                value |= (byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    if (i > 0 and byte == 0) return false;   // non-minimal, as above
+                    if (value > Max) return false;
+                    out = value, data += i + 1, length -= i + 1;
+                    return true;
+                }
+            }
+            return false;
+        }
+    } // namespace details
+
+    template<typename T>
+    inline bool deserializer::deserialize_impl(T &out) noexcept
+    {
+        if constexpr (std::is_same_v<T, bool>) {
+            if (_length < 1) return false;
+            out = std::to_integer<unsigned char>(*_data) != 0;
+            ++_data, --_length;
+            return true;
+        } else if constexpr (details::is_varint_v<T>) {
+            using integer = typename details::integer_of<T>::type;
+            using unsigned_t = std::make_unsigned_t<integer>;
+            std::uint64_t raw = 0;
+            if (not details::decode_unsigned<max_serialized_size_of<T>(), std::numeric_limits<unsigned_t>::max()>(_data, _length, raw))
+                return false;
+            if constexpr (std::is_signed_v<integer>)
+                out = static_cast<T>(details::unzigzag<integer>(static_cast<unsigned_t>(raw)));
+            else
+                out = static_cast<T>(static_cast<integer>(raw));
+            return true;
+        } else if constexpr (std::is_floating_point_v<T>) {
+            if (_length < sizeof(T)) return false;
+            out = flat::details::deserialize_value<utils::endianness::little, T>(_data);
+            _data += sizeof(T), _length -= sizeof(T);
+            return true;
+        } else {
+            static_assert(internal::is_std_array_v<T>,
+                "[eser] the varint codec supports integers, enums, bool, floating point and arrays of them");
+            for (auto &element : out)
+                if (not deserialize_impl(element)) return false;
+            return true;
+        }
+    }
+
+    template<typename T, std::enable_if_t<not std::is_array_v<T> and not internal::is_tuple_v<T>, bool>>
+    inline std::optional<T> deserializer::to() noexcept
+    {
+        const std::byte *data = _data;
+        const std::size_t length = _length;
+        T value {};
+        if (deserialize_impl(value)) return value;
+        _data = data, _length = length;
+        return std::nullopt;
+    }
+
+    template<typename T, std::enable_if_t<std::is_array_v<T> and (std::extent_v<T> > 0), bool>>
+    inline std::optional<internal::as_std_array_t<T>> deserializer::to() noexcept
+    {
+        return to<internal::as_std_array_t<T>>();
+    }
+
+    template<typename Tuple, std::enable_if_t<internal::is_tuple_v<Tuple>, bool>>
+    inline std::optional<Tuple> deserializer::to() noexcept
+    {
+        return to_impl(internal::type_identity<Tuple>{});
+    }
+
+    template<typename... Es>
+    inline std::optional<std::tuple<Es...>> deserializer::to_impl(internal::type_identity<std::tuple<Es...>>) noexcept
+    {
+        static_assert(sizeof...(Es) > 0, "Cannot deserialize an empty std::tuple<>; name at least one field");
+        const std::byte *data = _data;
+        const std::size_t length = _length;
+        std::tuple<Es...> values {};
+        const bool ok = std::apply([&](auto &...elements){
+            return (... and deserialize_impl(elements));
+        }, values);
+        if (ok) return values;
+        _data = data, _length = length;
+        return std::nullopt;
+    }
+
+    constexpr std::size_t deserializer::available() const noexcept
+    {
+        return _length;
+    }
+
+    constexpr deserializer::deserializer(const std::byte *data, std::size_t length) noexcept
+    : _data(data), _length(length)
+    {
+    }
+
+    constexpr deserializer deserialize(const std::byte *data, std::size_t length) noexcept
+    {
+        assert(data != nullptr && "Data pointer is null");
+        return deserializer(data, length);
+    }
+} // namespace eser::varint
+
+#endif // ESER_VARINT_DESERIALIZER_TPP_
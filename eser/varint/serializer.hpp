@@ -0,0 +1,145 @@
+/**
+* @file serializer.hpp
+*
+* @ingroup eser_varint
+*
+* @brief Serialization front-end of the variable-length (LEB128 / zigzag) codec.
+*
+* `eser::varint::serialize(...).to(buffer)` has the same shape as `eser::flat::serialize`, but
+* integers and enums take only as many bytes as their value needs:
+*
+* | Type | Wire |
+* |---|---|
+* | unsigned integers | LEB128: 7 bits per byte, low group first, high bit = "more bytes follow" |
+* | signed integers | zigzag-mapped (`0,-1,1,-2 -> 0,1,2,3`), then LEB128 |
+* | enums | their underlying integer |
+* | `bool` | one byte, `0` or `1` |
+* | `float` / `double` | fixed width, little-endian (as `flat` with the default wire) |
+* | C-arrays / `std::array` | every element, back-to-back |
+*
+* Varints are byte-oriented, so there is no `Wire` endianness parameter.
+*
+* ```cpp
+* std::uint32_t id = 300;          // 2 bytes instead of 4
+* std::int64_t delta = -3;         // 1 byte instead of 8
+* std::byte buffer[max_serialized_size_of<std::uint32_t, std::int64_t>()];
+* std::size_t written = eser::varint::serialize(id, delta).to(buffer);   // 3
+* ```
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_VARINT_SERIALIZER_HPP_
+#define ESER_VARINT_SERIALIZER_HPP_
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include "../internal/byte.hpp"
+#include "size.hpp"
+
+namespace eser::varint{
+    namespace details{
+        /**
+        * @brief Write one value in the varint format.
+        *
+        * The caller guarantees `serialized_size(value)` bytes of room.
+        *
+        * @param buffer The output cursor; advanced past the written bytes.
+        * @param value The value to write.
+        * @return The number of bytes written.
+        */
+        template<typename T>
+        std::size_t serialize_impl(std::byte *&buffer, const T &value) noexcept;
+    }
+
+    /**
+    * @class serializer
+    * @brief Writes its captured values in the varint format.
+    *
+    * Like `flat::serializer`, it captures its arguments by forwarding reference and its `to()`
+    * overloads are rvalue-ref-qualified: use it as `serialize(...).to(buffer)`.
+    *
+    * @tparam T... The captured argument types (deduced by `serialize()`).
+    */
+    template<typename... T>
+    class serializer{
+    public:
+        /**
+        * @brief Write the captured values into `buffer`.
+        *
+        * A buffer of at least `max_serialized_size_of<T...>()` bytes never needs a size check;
+        * a smaller one is checked against the values' exact `serialized_size`.
+        *
+        * @param buffer A pointer to the output byte stream.
+        * @param size The size of the output buffer in bytes.
+        * @return The number of bytes written, or `0` if the values do not fit — nothing is written
+        *         in that case (and an `assert` fires in debug builds, as in `flat`).
+        */
+        std::size_t to(std::byte *buffer, std::size_t size) &&;
+
+        /**
+        * @brief Write the captured values into a fixed-size byte array.
+        * @tparam N The size of the output array in bytes.
+        * @param buffer The output array.
+        * @return The number of bytes written, or `0` if the values do not fit.
+        */
+        template<std::size_t N>
+        std::size_t to(std::byte (&buffer)[N]) &&;
+
+        /**
+        * @brief Write the captured values into a legacy `uint8_t` buffer.
+        * @param buffer A pointer to the output byte stream as `std::uint8_t*`.
+        * @param size The size of the output buffer in bytes.
+        * @return The number of bytes written, or `0` if the values do not fit.
+        */
+        std::size_t to(std::uint8_t *buffer, std::size_t size) &&;
+
+        /**
+        * @brief Write the captured values into a legacy fixed-size `uint8_t` array.
+        * @tparam N The size of the output array in bytes.
+        * @param buffer The output array.
+        * @return The number of bytes written, or `0` if the values do not fit.
+        */
+        template<std::size_t N>
+        std::size_t to(std::uint8_t (&buffer)[N]) &&;
+
+    private:
+        std::tuple<T...> _args; ///< The captured values (lvalue arguments are held by reference).
+
+        /**
+        * @brief Private constructor to enforce the use of `serialize`.
+        * @param args The values to capture.
+        */
+        constexpr explicit serializer(T&&... args);
+
+        template<typename... U>
+        friend constexpr serializer<U...> serialize(U&&... args);
+    };
+
+    /**
+    * @brief Factory function to create a varint serializer holding the given arguments.
+    *
+    * @tparam T... The deduced argument types: integers, enums, `bool`, floating point, or arrays of them.
+    * @param args The values to serialize.
+    * @return A `serializer` over the arguments.
+    */
+    template<typename... T>
+    constexpr serializer<T...> serialize(T&&... args)
+    {
+        static_assert(sizeof...(T) > 0, "At least one type must be specified");
+        return serializer<T...>(std::forward<T>(args)...);
+    }
+} // namespace eser::varint
+
+#include "serializer.tpp"
+#endif // ESER_VARINT_SERIALIZER_HPP_
@@ -0,0 +1,108 @@
+/**
+* @file serializer.tpp
+*
+* @brief Definition of functionality in serializer.hpp
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_VARINT_SERIALIZER_TPP_
+#define ESER_VARINT_SERIALIZER_TPP_
+#include "serializer.hpp"
+#include "../flat/serializer.hpp"
+#include <cassert>
+
+namespace eser::varint{
+    namespace details{
+        /**
+        * @brief Write `value` as LEB128: seven bits per byte, low group first.
+        * @param buffer The output cursor; advanced past the written bytes.
+        * @param value The unsigned wire value.
+        * @return The number of bytes written (1 to 10).
+        */
+        inline std::size_t encode_unsigned(std::byte *&buffer, std::uint64_t value) noexcept
+        {
+            std::byte *start = buffer;
+            while (value >= 0x80) {
+                *buffer++ = static_cast<std::byte>(value | 0x80);
+                value >>= 7;
+            }
+            *buffer++ = static_cast<std::byte>(value);
+            return static_cast<std::size_t>(buffer - start);
+        }
+
+        template<typename T>
+        inline std::size_t serialize_impl(std::byte *&buffer, const T &value) noexcept
+        {
+            using bare_t = std::remove_cv_t<T>;
+            if constexpr (std::is_same_v<bare_t, bool>) {
+                *buffer++ = static_cast<std::byte>(value ? 1 : 0);
+                return 1;
+            } else if constexpr (is_varint_v<bare_t>) {
+                return encode_unsigned(buffer, wire_value(value));
+            } else if constexpr (std::is_floating_point_v<bare_t>) {
+                std::size_t room = sizeof(bare_t);
+                return flat::details::serialize_impl<utils::endianness::little>(buffer, room, value);
+            } else {
+                static_assert(std::is_array_v<bare_t> or internal::is_std_array_v<bare_t>,
+                    "[eser] the varint codec supports integers, enums, bool, floating point and arrays of them");
+                std::size_t total = 0;
+                for (const auto &element : value) total += serialize_impl(buffer, element);
+                return total;
+            }
+        }
+    } // namespace details
+
+    template<typename... T>
+    inline std::size_t serializer<T...>::to(std::byte *buffer, std::size_t size) &&
+    {
+        constexpr std::size_t bound = max_serialized_size_of<T...>();
+        if (size < bound) {
+            const std::size_t needed = std::apply([](const auto &...args){ return serialized_size(args...); }, _args);
+            if (needed > size){
+                assert(false && "Buffer size is insufficient for serialization");
+                return 0;
+            }
+        }
+        return std::apply([&](const auto &...args){
+            return (... + details::serialize_impl(buffer, args));
+        }, _args);
+    }
+
+    template<typename... T>
+    template<std::size_t N>
+    inline std::size_t serializer<T...>::to(std::byte (&buffer)[N]) &&
+    {
+        return std::move(*this).to(buffer, N);
+    }
+
+    template<typename... T>
+    inline std::size_t serializer<T...>::to(std::uint8_t *buffer, std::size_t size) &&
+    {
+        return std::move(*this).to(static_cast<std::byte *>(static_cast<void *>(buffer)), size);
+    }
+
+    template<typename... T>
+    template<std::size_t N>
+    inline std::size_t serializer<T...>::to(std::uint8_t (&buffer)[N]) &&
+    {
+        return std::move(*this).to(static_cast<std::byte *>(static_cast<void *>(buffer)), N);
+    }
+
+    template<typename... T>
+    constexpr serializer<T...>::serializer(T&&... args)
+    : _args(std::forward<T>(args)...)
+    {
+    }
+} // namespace eser::varint
+
+#endif // ESER_VARINT_SERIALIZER_TPP_
@@ -0,0 +1,183 @@
+/**
+* @file size.hpp
+*
+* @ingroup eser_varint
+*
+* @brief Compile-time upper bound and run-time exact size of the varint wire format.
+*
+* A varint field's size depends on its value, so there are two functions:
+*
+* - `max_serialized_size_of<T...>()` is the largest number of bytes the types can take
+*   (`std::uint32_t`: 5, `std::int64_t`: 10). Size buffers with it when they must be static.
+* - `serialized_size(values...)` is the exact number of bytes those values take.
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_VARINT_SIZE_HPP_
+#define ESER_VARINT_SIZE_HPP_
+#include <array>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "../internal/traits.hpp"
+
+namespace eser::varint{
+    namespace details{
+        /**
+        * @brief The integer type a value is varint-encoded as: itself, or an enum's underlying type.
+        */
+        template<typename T, typename = void>
+        struct integer_of { using type = T; };
+
+        /**
+        * @brief Specialization of `integer_of` mapping an enum to its underlying type.
+        */
+        template<typename T>
+        struct integer_of<T, std::enable_if_t<std::is_enum_v<T>>> { using type = std::underlying_type_t<T>; };
+
+        /**
+        * @brief Whether `T` is encoded as a LEB128 varint (non-`bool` integers and enums).
+        */
+        template<typename T>
+        inline constexpr bool is_varint_v =
+            (std::is_integral_v<T> and not std::is_same_v<T, bool>) or std::is_enum_v<T>;
+
+        /**
+        * @brief Map a signed integer to unsigned with zigzag encoding, so small magnitudes stay small.
+        * @param value The value to map (`0, -1, 1, -2, ...` become `0, 1, 2, 3, ...`).
+        * @return The zigzag-encoded value.
+        */
+        template<typename T>
+        constexpr std::make_unsigned_t<T> zigzag(T value) noexcept
+        {
+            using U = std::make_unsigned_t<T>;
+            // `value >> (bits - 1)` is all ones for a negative value (arithmetic shift), zero otherwise
+            return static_cast<U>(static_cast<U>(static_cast<U>(value) << 1) ^
+                                  static_cast<U>(value >> (sizeof(T) * CHAR_BIT - 1)));
+        }
+
+        /**
+        * @brief Invert @ref zigzag.
+        * @param value A zigzag-encoded value.
+        * @return The signed value.
+        */
+        template<typename T>
+        constexpr T unzigzag(std::make_unsigned_t<T> value) noexcept
+        {
+            using U = std::make_unsigned_t<T>;
+            return static_cast<T>(static_cast<U>(value >> 1) ^ static_cast<U>(U{0} - static_cast<U>(value & 1u)));
+        }
+
+        /**
+        * @brief The unsigned value that goes on the wire for an integer or enum.
+        * @param value The value.
+        * @return `value` itself if unsigned, its zigzag mapping if signed.
+        */
+        template<typename T>
+        constexpr std::uint64_t wire_value(T value) noexcept
+        {
+            using integer = typename integer_of<T>::type;
+            const auto raw = static_cast<integer>(value);
+            if constexpr (std::is_signed_v<integer>) return zigzag(raw);
+            else return raw;
+        }
+
+        /**
+        * @brief The number of LEB128 bytes needed for `value` (1 to 10).
+        */
+        constexpr std::size_t encoded_length(std::uint64_t value) noexcept
+        {
+            std::size_t length = 1;
+            while (value >= 0x80) value >>= 7, ++length;
+            return length;
+        }
+    } // namespace details
+
+    /**
+    * @brief The largest number of bytes one value of type `T` can take on the varint wire.
+    *
+    * - integers and enums: `ceil(bits / 7)` LEB128 bytes (`int8_t` 2, `uint16_t` 3, `uint32_t` 5,
+    *   `uint64_t` 10);
+    * - `bool`: 1; floating point: its fixed little-endian width;
+    * - C-arrays and `std::array`: element count times the element's bound.
+    *
+    * @tparam T The type to size.
+    * @return The upper bound in bytes.
+    */
+    template<typename T>
+    constexpr std::size_t max_serialized_size_of()
+    {
+        using bare_t = std::remove_cv_t<std::remove_reference_t<T>>;
+        if constexpr (std::is_same_v<bare_t, bool>) {
+            return 1;
+        } else if constexpr (details::is_varint_v<bare_t>) {
+            return (sizeof(typename details::integer_of<bare_t>::type) * CHAR_BIT + 6) / 7;
+        } else if constexpr (std::is_floating_point_v<bare_t>) {
+            return sizeof(bare_t);
+        } else if constexpr (std::is_array_v<bare_t>) {
+            return std::extent_v<bare_t> * max_serialized_size_of<std::remove_extent_t<bare_t>>();
+        } else if constexpr (internal::is_std_array_v<bare_t>) {
+            return std::tuple_size_v<bare_t> * max_serialized_size_of<typename bare_t::value_type>();
+        } else {
+            static_assert(internal::always_false_v<bare_t>,
+                "[eser] the varint codec supports integers, enums, bool, floating point and arrays of them");
+            return 0;
+        }
+    }
+
+    /**
+    * @brief The largest number of bytes the types `T...` can take on the varint wire, together.
+    * @tparam T... The types to size.
+    * @return The sum of the per-type bounds.
+    * @see max_serialized_size_of<T>()
+    */
+    template<typename... T, std::enable_if_t<(sizeof...(T) > 1), bool> = true>
+    constexpr std::size_t max_serialized_size_of()
+    {
+        return (... + max_serialized_size_of<T>());
+    }
+
+    /**
+    * @brief The exact number of bytes `value` takes on the varint wire.
+    * @param value The value to size.
+    * @return Its encoded length.
+    */
+    template<typename T>
+    constexpr std::size_t serialized_size(const T &value) noexcept
+    {
+        using bare_t = std::remove_cv_t<T>;
+        if constexpr (details::is_varint_v<bare_t>) {
+            return details::encoded_length(details::wire_value(value));
+        } else if constexpr (std::is_array_v<bare_t> or internal::is_std_array_v<bare_t>) {
+            std::size_t total = 0;
+            for (const auto &element : value) total += serialized_size(element);
+            return total;
+        } else {
+            return max_serialized_size_of<bare_t>();
+        }
+    }
+
+    /**
+    * @brief The exact number of bytes `values...` take on the varint wire, together.
+    * @param values The values to size.
+    * @return The sum of their encoded lengths.
+    */
+    template<typename... T, std::enable_if_t<(sizeof...(T) > 1), bool> = true>
+    constexpr std::size_t serialized_size(const T &...values) noexcept
+    {
+        return (... + serialized_size(values));
+    }
+} // namespace eser::varint
+
+#endif // ESER_VARINT_SIZE_HPP_
@@ -0,0 +1,46 @@
+/**
+* @file varint.hpp
+*
+* @brief Aggregator header for the variable-length (LEB128 / zigzag) codec.
+*
+* @defgroup eser_varint eser::varint
+*
+* @ingroup eser
+*
+* @brief An opt-in alternative to `eser::flat` for bandwidth-bound links.
+*
+* Same front-end as `eser::flat` — `serialize(...).to(buffer)` and
+* `deserialize(data, length).to<T>()` — but integers and enums are written as LEB128 varints
+* (signed ones zigzag-mapped first), so small values take one or two bytes whatever their declared
+* width. Buffers can still be sized statically with `max_serialized_size_of<T...>()`; the exact
+* size of given values is `serialized_size(values...)`.
+*
+* ```cpp
+* #include "eser/varint/varint.hpp"
+*
+* std::uint32_t id = 300;
+* std::int16_t offset = -2;
+* std::byte buffer[eser::varint::max_serialized_size_of<std::uint32_t, std::int16_t>()];   // 8
+*
+* std::size_t n = eser::varint::serialize(id, offset).to(buffer);                        // 3
+* auto fields = eser::varint::deserialize(buffer, n).to<std::tuple<std::uint32_t, std::int16_t>>();
+* ```
+*
+* @author Mark Tikhonov <mtik.philosopher@gmail.com>
+*
+* @date 2026-10-14
+*
+* @copyright
+* MIT License
+* SPDX-License-Identifier: MIT
+*
+* @par Changelog
+* - 2026-10-14
+* -     Initial creation.
+*/
+#ifndef ESER_VARINT_VARINT_HPP_
+#define ESER_VARINT_VARINT_HPP_
+#include "size.hpp"
+#include "serializer.hpp"
+#include "deserializer.hpp"
+#endif // ESER_VARINT_VARINT_HPP_
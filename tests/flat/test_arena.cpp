@@ -0,0 +1,115 @@
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <tuple>
+#include "eser/flat/serializer.hpp"
+#include "eser/flat/deserializer.hpp"
+#include "eser/utils/arena.hpp"
+#include "eser/utils/bounded_vector.hpp"
+#include "eser/utils/bounded_string.hpp"
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+
+using namespace eser::flat;
+using eser::utils::arena;
+using eser::utils::arena_vector;
+using eser::utils::arena_string;
+using eser::utils::bounded_vector;
+using eser::utils::bounded_string;
+
+TEST_CASE("arena bumps aligned blocks, refuses when full and frees on reset") {
+    alignas(8) std::byte scratch[32];
+    arena a(scratch);
+    REQUIRE(a.capacity() == 32);
+
+    void *one = a.allocate(1, 1);
+    REQUIRE(one == scratch);
+    void *four = a.allocate(4, 4);
+    REQUIRE(four == scratch + 4);
+    REQUIRE(a.used() == 8);
+
+    REQUIRE(a.allocate(25, 1) == nullptr);
+    REQUIRE(a.used() == 8);   // a refused block takes nothing
+    REQUIRE(a.allocate(24, 8) == scratch + 8);
+    REQUIRE(a.used() == 32);
+
+    a.reset();
+    REQUIRE(a.used() == 0);
+    REQUIRE(a.allocate(32, 1) == scratch);
+}
+
+TEST_CASE("arena_vector fields are decoded into the arena and round-trip") {
+    using message = std::tuple<std::uint32_t, arena_vector<float, 64>, arena_string<16>>;
+    bounded_vector<float, 64> samples;
+    for (int i = 0; i < 5; ++i) samples.push_back(0.5f * i);
+    bounded_string<16> name("probe");
+
+    std::byte buffer[128];
+    const std::size_t n = serialize<endianness::big>(std::uint32_t{42}, samples, name).to(buffer);
+
+    alignas(alignof(float)) std::byte scratch[64];
+    arena a(scratch);
+    auto d = deserialize<endianness::big>(buffer, n);
+    auto m = d.to<message>(a);
+    REQUIRE(m);
+    REQUIRE_FALSE(d.to<std::uint8_t>());   // the whole message was consumed
+    auto &[id, values, label] = *m;
+    REQUIRE(id == 42);
+    REQUIRE(values.size() == 5);
+    for (std::size_t i = 0; i < 5; ++i) REQUIRE(values[i] == 0.5f * i);
+    REQUIRE(std::string_view(label.data(), label.size()) == "probe");
+    REQUIRE(a.used() == 5 * sizeof(float) + 5);   // only what was on the wire
+
+    // An arena_vector writes the same bytes as the bounded_vector it was decoded from.
+    std::byte again[128];
+    REQUIRE(serialize<endianness::big>(id, values, label).to(again) == n);
+    REQUIRE(std::memcmp(buffer, again, n) == 0);
+}
+
+TEST_CASE("an exhausted arena rejects the message and leaves the cursor in place") {
+    bounded_vector<std::uint16_t, 32> words;
+    for (std::uint16_t i = 0; i < 20; ++i) words.push_back(i);
+    std::byte buffer[128];
+    const std::size_t n = serialize(words, std::uint8_t{9}).to(buffer);
+
+    alignas(2) std::byte scratch[16];
+    arena a(scratch);
+    auto d = deserialize(buffer, n);
+    REQUIRE_FALSE(d.to<std::tuple<arena_vector<std::uint16_t, 32>, std::uint8_t>>(a));
+    REQUIRE_FALSE(d.to<arena_vector<std::uint16_t, 32>>(a));
+
+    // Nothing was consumed, and ordinary bounded fields are still read inline alongside the arena.
+    auto m = d.to<std::tuple<bounded_vector<std::uint16_t, 32>, std::uint8_t>>(a);
+    REQUIRE(m);
+    REQUIRE(std::get<0>(*m).size() == 20);
+    REQUIRE(a.used() == 0);
+
+    // An empty field takes nothing from the arena.
+    const std::size_t e = serialize(bounded_vector<std::uint16_t, 32>{}).to(buffer);
+    auto empty = deserialize(buffer, e).to<arena_vector<std::uint16_t, 32>>(a);
+    REQUIRE(empty);
+    REQUIRE(empty->empty());
+    REQUIRE(a.used() == 0);
+}
+
+#if __has_include(<memory_resource>)
+TEST_CASE("a std::pmr::memory_resource can serve as the arena") {
+    bounded_vector<std::int32_t, 8> in;
+    in.push_back(-1);
+    in.push_back(7);
+    std::byte buffer[64];
+    const std::size_t n = serialize(in).to(buffer);
+
+    alignas(std::max_align_t) std::byte scratch[64];
+    std::pmr::monotonic_buffer_resource resource(scratch, sizeof(scratch), std::pmr::null_memory_resource());
+    auto out = deserialize(buffer, n).to<arena_vector<std::int32_t, 8>>(resource);
+    REQUIRE(out);
+    REQUIRE(out->size() == 2);
+    REQUIRE((*out)[0] == -1);
+    REQUIRE((*out)[1] == 7);
+    REQUIRE(reinterpret_cast<std::byte *>(out->data()) >= scratch);
+    REQUIRE(reinterpret_cast<std::byte *>(out->data()) < scratch + sizeof(scratch));
+}
+#endif
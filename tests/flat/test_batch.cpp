@@ -0,0 +1,117 @@
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include "eser/flat/serializer.hpp"
+#include "eser/flat/batch.hpp"
+#include "eser/utils/bounded_vector.hpp"
+
+using namespace eser::flat;
+using eser::utils::bounded_vector;
+
+namespace {
+    // Two fixed buffers handed out in turn, standing in for registered I/O buffers.
+    struct test_provider {
+        std::byte buffers[2][16] = {};
+        std::size_t next = 0;
+        std::size_t available = 2;
+        const_chunk submitted[8] = {};
+        std::size_t submissions = 0;
+
+        chunk acquire() {
+            if (available == 0) return {nullptr, 0};
+            --available;
+            return {buffers[next++ % 2], sizeof(buffers[0])};
+        }
+        void submit(const_chunk filled) { submitted[submissions++] = filled; }
+    };
+
+    static_assert(is_buffer_provider_v<test_provider>);
+    static_assert(not is_buffer_provider_v<span_sink>);
+}
+
+TEST_CASE("batch_writer packs messages into provider buffers and submits each buffer once") {
+    test_provider provider;
+    batch_writer<test_provider> out(provider);
+
+    for (std::uint32_t i = 0; i < 3; ++i) REQUIRE(out.append<endianness::big>(i, std::uint8_t{0xAA}));
+    REQUIRE(out.pending() == 3);
+    REQUIRE(out.pending_bytes() == 15);
+    REQUIRE(provider.submissions == 0);
+
+    REQUIRE(out.append<endianness::big>(std::uint32_t{3}, std::uint8_t{0xAA}));   // does not fit: the first buffer goes out
+    REQUIRE(provider.submissions == 1);
+    REQUIRE(provider.submitted[0].data == provider.buffers[0]);
+    REQUIRE(provider.submitted[0].size == 15);
+    REQUIRE(out.pending() == 1);
+
+    REQUIRE(out.flush() == 1);
+    REQUIRE(out.flush() == 0);
+    REQUIRE(provider.submissions == 2);
+    REQUIRE(provider.submitted[1].data == provider.buffers[1]);
+    REQUIRE(provider.submitted[1].size == 5);
+
+    // Bytes are exactly what serialize() writes.
+    std::byte expected[5];
+    serialize<endianness::big>(std::uint32_t{3}, std::uint8_t{0xAA}).to(expected);
+    REQUIRE(std::memcmp(provider.buffers[1], expected, 5) == 0);
+
+    // The provider is out of buffers.
+    REQUIRE_FALSE(out.append(std::uint8_t{1}));
+    REQUIRE(out.pending() == 0);
+}
+
+TEST_CASE("batch_writer refuses a message larger than a whole buffer") {
+    test_provider provider;
+    batch_writer<test_provider> out(provider);
+    REQUIRE(out.append(std::uint64_t{1}));
+    const std::uint32_t big[5] = {};
+    REQUIRE_FALSE(out.append(big));
+    REQUIRE(provider.submissions == 0);      // the pending message is not pushed out early
+    REQUIRE(provider.available == 1);
+    REQUIRE(out.append(std::uint64_t{2}));   // still fits after the refused one
+    REQUIRE(out.flush() == 2);
+    REQUIRE(provider.submitted[0].size == 16);
+}
+
+TEST_CASE("batch_writer keeps an empty buffer when the first message does not fit") {
+    test_provider provider;
+    batch_writer<test_provider> out(provider);
+    const std::uint32_t big[5] = {};
+    for (int i = 0; i < 4; ++i) REQUIRE_FALSE(out.append(big));
+    REQUIRE(provider.available == 1);        // one buffer acquired, and kept
+    REQUIRE(provider.submissions == 0);
+    REQUIRE(out.flush() == 0);
+
+    REQUIRE(out.append(std::uint32_t{7}));   // lands in the kept buffer
+    REQUIRE(provider.available == 1);
+    REQUIRE(out.flush() == 1);
+    REQUIRE(provider.submitted[0].data == provider.buffers[0]);
+}
+
+TEST_CASE("for_each_message decodes a completion buffer in place and leaves a split tail") {
+    std::byte rx[64];
+    std::size_t n = 0;
+    for (std::uint16_t i = 0; i < 4; ++i) {
+        bounded_vector<std::uint8_t, 8> tail;
+        for (std::uint16_t k = 0; k < i; ++k) tail.push_back(static_cast<std::uint8_t>(k));
+        n += serialize(i, tail).to(rx + n, sizeof(rx) - n);
+    }
+
+    using message = std::tuple<std::uint16_t, bounded_vector<std::uint8_t, 8>>;
+    std::uint16_t seen = 0;
+    std::size_t elements = 0;
+    const auto handler = [&](std::uint16_t id, const bounded_vector<std::uint8_t, 8> &v){
+        REQUIRE(id == seen++);
+        elements += v.size();
+    };
+    REQUIRE(for_each_message<message>(rx, n, handler) == n);
+    REQUIRE(seen == 4);
+    REQUIRE(elements == 0 + 1 + 2 + 3);
+
+    // The last message is cut short: the three before it are used, its bytes are left.
+    seen = 0;
+    const std::size_t used = for_each_message<message>(rx, n - 1, handler);
+    REQUIRE(seen == 3);
+    REQUIRE(used == n - (2 + 1 + 3));
+}
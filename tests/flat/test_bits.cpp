@@ -0,0 +1,222 @@
+#include <catch2/catch_all.hpp>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include "eser/flat/flat.hpp"
+#include "eser/utils/bits.hpp"
+
+using namespace eser::flat;
+using eser::utils::bits;
+
+namespace {
+    enum class b_mode : std::uint8_t { idle = 0, sample = 2, burst = 5 };
+
+    using mode3 = bits<3, b_mode>;
+    using adc12 = bits<12, std::uint16_t>;
+    using flag1 = bits<1, bool>;
+    using nibble = bits<4, std::uint8_t>;
+    using trim5 = bits<5, std::int8_t>;
+
+    std::byte b_buffer[32];
+    void b_clear() { std::memset(b_buffer, 0xAB, sizeof(b_buffer)); }
+}
+
+static_assert(std::is_trivially_copyable_v<adc12>);
+static_assert(sizeof(mode3) == 1 and sizeof(adc12) == 2 and sizeof(bits<20, std::uint32_t>) == 4);
+static_assert(adc12::mask() == 0x0FFF and bits<64, std::uint64_t>::mask() == ~std::uint64_t{0});
+static_assert(serialized_size_of<mode3, adc12, flag1, std::uint32_t>() == 2 + 4);
+static_assert(serialized_size_of<std::uint8_t, nibble, nibble, std::uint16_t>() == 1 + 1 + 2);
+static_assert(serialized_size_of<nibble, std::uint8_t, nibble>() == 3, "a lone bits field is not packed");
+static_assert(serialized_size_of<bits<20, std::uint32_t>, std::uint8_t>() == 4 + 1);
+static_assert(serialized_size_of<bits<30, std::uint32_t>, bits<30, std::uint32_t>, flag1>() == 8);
+static_assert(layout<std::uint8_t, mode3, adc12, flag1, std::uint16_t>::offset_of<4>() == 3);
+static_assert(layout<std::uint8_t, mode3, adc12, flag1, std::uint16_t>::size() == 5);
+
+TEST_CASE("bits keeps the low N bits and sign-extends signed values") {
+    REQUIRE(mode3{b_mode::burst}.value() == b_mode::burst);
+    REQUIRE(adc12{0xABC}.raw() == 0xABC);
+    REQUIRE(trim5{-3}.raw() == 0x1D);
+    REQUIRE(trim5{-3}.value() == -3);
+    REQUIRE(trim5::from_raw(0x10).value() == -16);
+    REQUIRE(trim5::from_raw(0xEF).value() == 15);
+    REQUIRE(flag1{true}.value());
+    REQUIRE(adc12{100} == adc12{100});
+}
+
+TEST_CASE("a signed value type wider than its storage sign-extends at its own width") {
+    REQUIRE(bits<12, std::int32_t>{-5}.value() == -5);
+    REQUIRE(bits<4, int>{-3}.value() == -3);
+    REQUIRE(bits<4, int>::from_raw(0x8).value() == -8);
+    REQUIRE(bits<12, std::int32_t>::from_raw(0x7FF).value() == 2047);
+
+    std::byte buffer[8];
+    REQUIRE(serialize(bits<4, int>{-3}, bits<12, std::int32_t>{-100}).to(buffer) == 2);
+    auto fields = deserialize(buffer, 2).to<std::tuple<bits<4, int>, bits<12, std::int32_t>>>();
+    REQUIRE(fields);
+    REQUIRE(std::get<0>(*fields).value() == -3);
+    REQUIRE(std::get<1>(*fields).value() == -100);
+
+    REQUIRE(serialize<endianness::big>(bits<12, std::int32_t>{-2048}, bits<4, int>{7}).to(buffer) == 2);
+    auto big = deserialize<endianness::big>(buffer, 2).to<std::tuple<bits<12, std::int32_t>, bits<4, int>>>();
+    REQUIRE(big);
+    REQUIRE(std::get<0>(*big).value() == -2048);
+    REQUIRE(std::get<1>(*big).value() == 7);
+}
+
+TEST_CASE("a bit group packs across byte boundaries, LSB-first on a little-endian wire") {
+    b_clear();
+    REQUIRE(serialize(mode3{b_mode::burst}, adc12{0x7FF}, flag1{true}).to(b_buffer) == 2);
+    // 5 | 0x7FF << 3 | 1 << 15
+    REQUIRE(b_buffer[0] == std::byte{0xFD});
+    REQUIRE(b_buffer[1] == std::byte{0xBF});
+    REQUIRE(b_buffer[2] == std::byte{0xAB});
+}
+
+TEST_CASE("a bit group is MSB-first on a big-endian wire") {
+    b_clear();
+    REQUIRE(serialize<endianness::big>(mode3{b_mode::burst}, adc12{0x7FF}, flag1{true}).to(b_buffer) == 2);
+    REQUIRE(b_buffer[0] == std::byte{0xAF});
+    REQUIRE(b_buffer[1] == std::byte{0xFF});
+
+    // IPv4 version / IHL: the first nibble is the high one
+    REQUIRE(serialize<endianness::big>(nibble{4}, nibble{5}).to(b_buffer) == 1);
+    REQUIRE(b_buffer[0] == std::byte{0x45});
+    REQUIRE(serialize(nibble{4}, nibble{5}).to(b_buffer) == 1);
+    REQUIRE(b_buffer[0] == std::byte{0x54});
+}
+
+TEST_CASE("padding bits of a partial group are zero") {
+    b_clear();
+    REQUIRE(serialize(flag1{true}, bits<2, std::uint8_t>{3}, std::uint8_t{0x11}).to(b_buffer) == 2);
+    REQUIRE(b_buffer[0] == std::byte{0x07});
+    REQUIRE(serialize<endianness::big>(flag1{true}, bits<2, std::uint8_t>{3}).to(b_buffer) == 1);
+    REQUIRE(b_buffer[0] == std::byte{0xE0});
+}
+
+template<endianness Wire>
+static void bits_round_trip()
+{
+    b_clear();
+    const std::uint16_t head = 0x1234;
+    const std::size_t written = serialize<Wire>(head, mode3{b_mode::sample}, trim5{-7}, adc12{0xFED},
+        flag1{true}, std::uint32_t{0xCAFEBABE}, nibble{9}, nibble{1}).to(b_buffer);
+    REQUIRE(written == 2 + 3 + 4 + 1);
+
+    auto d = deserialize<Wire>(b_buffer, written);
+    auto fields = d.template to<std::tuple<std::uint16_t, mode3, trim5, adc12, flag1, std::uint32_t, nibble, nibble>>();
+    REQUIRE(fields);
+    REQUIRE(std::get<0>(*fields) == head);
+    REQUIRE(std::get<1>(*fields).value() == b_mode::sample);
+    REQUIRE(std::get<2>(*fields).value() == -7);
+    REQUIRE(std::get<3>(*fields).value() == 0xFED);
+    REQUIRE(std::get<4>(*fields).value());
+    REQUIRE(std::get<5>(*fields) == 0xCAFEBABE);
+    REQUIRE(std::get<6>(*fields).value() == 9);
+    REQUIRE(std::get<7>(*fields).value() == 1);
+    REQUIRE_FALSE(d.template to<std::uint8_t>());
+}
+
+TEST_CASE("bit groups round-trip through a tuple read") {
+    bits_round_trip<endianness::little>();
+    bits_round_trip<endianness::big>();
+}
+
+TEST_CASE("a 64-bit group round-trips") {
+    using wide = bits<40, std::uint64_t>;
+    using rest = bits<24, std::uint32_t>;
+    for (endianness wire : {endianness::little, endianness::big}) {
+        std::size_t written = wire == endianness::little
+            ? serialize(wide{0xFFEEDDCCBBull}, rest{0x123456}).to(b_buffer)
+            : serialize<endianness::big>(wide{0xFFEEDDCCBBull}, rest{0x123456}).to(b_buffer);
+        REQUIRE(written == 8);
+        auto fields = wire == endianness::little
+            ? deserialize(b_buffer, written).to<std::tuple<wide, rest>>()
+            : deserialize<endianness::big>(b_buffer, written).to<std::tuple<wide, rest>>();
+        REQUIRE(fields);
+        REQUIRE(std::get<0>(*fields).value() == 0xFFEEDDCCBBull);
+        REQUIRE(std::get<1>(*fields).value() == 0x123456u);
+    }
+}
+
+TEST_CASE("a truncated bit group is rejected without consuming") {
+    serialize(std::uint8_t{1}, mode3{b_mode::burst}, adc12{1}, flag1{false}).to(b_buffer);
+    auto d = deserialize(b_buffer, 2);
+    REQUIRE_FALSE((d.to<std::tuple<std::uint8_t, mode3, adc12, flag1>>()));
+    REQUIRE(d.to<std::uint16_t>());
+}
+
+TEST_CASE("a lone bits field is its storage integer") {
+    b_clear();
+    REQUIRE(serialize<endianness::big>(adc12{0x0ABC}).to(b_buffer) == 2);
+    REQUIRE(b_buffer[0] == std::byte{0x0A});
+    REQUIRE(b_buffer[1] == std::byte{0xBC});
+    REQUIRE(deserialize<endianness::big>(b_buffer, 2).to<adc12>()->value() == 0x0ABC);
+
+    const adc12 readings[3] = {1, 2, 0xFFF};
+    REQUIRE(serialize<endianness::big>(readings).to(b_buffer) == 6);
+    REQUIRE(b_buffer[4] == std::byte{0x0F});
+    auto back = deserialize<endianness::big>(b_buffer, 6).to<adc12[3]>();
+    REQUIRE(back);
+    REQUIRE((*back)[2].value() == 0xFFF);
+
+    // stray high bits in a raw-copied field are masked off on read
+    b_buffer[0] = std::byte{0xFF};
+    b_buffer[1] = std::byte{0xFF};
+    REQUIRE(deserialize(b_buffer, 2).to<adc12>()->value() == 0xFFF);
+}
+
+TEST_CASE("bit groups split across a chunk boundary") {
+    std::byte expected[8]{};
+    const std::size_t total = serialize<endianness::big>(std::uint8_t{0x42}, bits<5, std::uint8_t>{17},
+        bits<11, std::uint16_t>{1500}, bits<8, std::uint8_t>{0x5A}, std::uint16_t{0xBEEF}).to(expected);
+    REQUIRE(total == 1 + 3 + 2);
+    for (std::size_t split = 0; split <= total; ++split) {
+        std::byte a[8]{}, b[8]{};
+        chunk regions[] = { {a, split}, {b, total - split} };
+        chunk_sink out(regions);
+        REQUIRE(serialize<endianness::big>(std::uint8_t{0x42}, bits<5, std::uint8_t>{17},
+            bits<11, std::uint16_t>{1500}, bits<8, std::uint8_t>{0x5A}, std::uint16_t{0xBEEF}).to(out) == total);
+        REQUIRE(std::memcmp(a, expected, split) == 0);
+        REQUIRE(std::memcmp(b, expected + split, total - split) == 0);
+
+        const_chunk in_regions[] = { {expected, split}, {expected + split, total - split} };
+        chunk_source in(in_regions);
+        auto fields = deserialize<endianness::big>(in).to<std::tuple<std::uint8_t, bits<5, std::uint8_t>,
+            bits<11, std::uint16_t>, bits<8, std::uint8_t>, std::uint16_t>>();
+        REQUIRE(fields);
+        REQUIRE(std::get<1>(*fields).value() == 17);
+        REQUIRE(std::get<2>(*fields).value() == 1500);
+        REQUIRE(std::get<3>(*fields).value() == 0x5A);
+        REQUIRE(std::get<4>(*fields) == 0xBEEF);
+        REQUIRE(in.consumed() == total);
+    }
+}
+
+TEST_CASE("encoder and to_segments pack bit groups") {
+    mode3 mode = b_mode::idle;
+    adc12 adc = 0;
+    flag1 armed = false;
+    auto enc = make_encoder(mode, adc, armed);
+    static_assert(decltype(enc)::size() == 2);
+
+    mode = b_mode::burst, adc = 0x7FF, armed = true;
+    REQUIRE(enc.encode_into(b_buffer) == 2);
+    REQUIRE(b_buffer[0] == std::byte{0xFD});
+    REQUIRE(b_buffer[1] == std::byte{0xBF});
+
+    const_chunk segments[2]{};
+    std::byte scratch[8]{};
+    REQUIRE(serialize(std::uint8_t{7}, mode, adc, armed).to_segments(segments, 2, scratch, sizeof(scratch)) == 1);
+    REQUIRE(segments[0].size == 3);
+    REQUIRE(scratch[1] == std::byte{0xFD});
+    REQUIRE(scratch[2] == std::byte{0xBF});
+}
+
+#ifdef NDEBUG
+TEST_CASE("an out-of-range bits value is truncated to N bits") {
+    REQUIRE(nibble{0x1F}.value() == 0x0F);
+    REQUIRE(trim5{20}.value() == -12);
+}
+#endif
@@ -0,0 +1,188 @@
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <type_traits>
+#include "eser/flat/flat.hpp"
+#include "eser/utils/bounded_vector.hpp"
+#include "eser/utils/bounded_string.hpp"
+
+using namespace eser::flat;
+using eser::utils::bounded_vector;
+using eser::utils::bounded_string;
+
+namespace {
+    using samples = bounded_vector<std::uint16_t, 64>;
+    using name = bounded_string<16>;
+
+    std::byte bd_buffer[256];
+    void bd_clear() { std::memset(bd_buffer, 0xAB, sizeof(bd_buffer)); }
+}
+
+static_assert(std::is_trivially_copyable_v<samples> and std::is_trivially_copyable_v<name>);
+static_assert(std::is_same_v<samples::length_type, std::uint8_t>);
+static_assert(std::is_same_v<bounded_vector<std::uint8_t, 300>::length_type, std::uint16_t>);
+static_assert(std::is_same_v<bounded_string<70000>::length_type, std::uint32_t>);
+static_assert(max_serialized_size_of<samples>() == 1 + 64 * 2);
+static_assert(max_serialized_size_of<std::uint32_t, name, samples>() == 4 + 17 + 129);
+static_assert(max_serialized_size_of<std::uint32_t, std::uint16_t>() == serialized_size_of<std::uint32_t, std::uint16_t>());
+
+TEST_CASE("bounded_vector keeps a size within its capacity") {
+    samples v{1, 2, 3};
+    REQUIRE(v.size() == 3);
+    REQUIRE(v[2] == 3);
+    REQUIRE(v.push_back(4));
+    v.pop_back();
+    REQUIRE(v == samples{1, 2, 3});
+    v.resize(1);
+    REQUIRE(v != samples{1, 2, 3});
+
+    bounded_vector<std::uint8_t, 2> full{7, 8};
+    REQUIRE_FALSE(full.push_back(9));
+    REQUIRE(full.size() == 2);
+
+    REQUIRE(name{"probe"}.view() == "probe");
+    REQUIRE(name{}.empty());
+}
+
+TEST_CASE("only the used elements follow the length prefix") {
+    bd_clear();
+    const samples v{0x1122, 0x3344, 0x5566};
+    REQUIRE(serialized_size(v) == 1 + 3 * 2);
+    REQUIRE(serialize(v).to(bd_buffer) == 7);
+    REQUIRE(bd_buffer[0] == std::byte{3});
+    REQUIRE(bd_buffer[1] == std::byte{0x22});
+    REQUIRE(bd_buffer[6] == std::byte{0x55});
+    REQUIRE(bd_buffer[7] == std::byte{0xAB});
+
+    REQUIRE(serialize<endianness::big>(bounded_vector<std::uint16_t, 300>{0x0102}).to(bd_buffer) == 4);
+    REQUIRE(bd_buffer[0] == std::byte{0x00});
+    REQUIRE(bd_buffer[1] == std::byte{0x01});
+    REQUIRE(bd_buffer[2] == std::byte{0x01});
+    REQUIRE(bd_buffer[3] == std::byte{0x02});
+}
+
+template<endianness Wire>
+static void bounded_round_trip()
+{
+    bd_clear();
+    const std::uint32_t id = 0xCAFEBABE;
+    const name label{"sensor-7"};
+    const samples values{10, 20, 30, 0xFFFF};
+    const std::uint8_t tail = 0x5A;
+
+    const std::size_t written = serialize<Wire>(id, label, values, tail).to(bd_buffer);
+    REQUIRE(written == serialized_size(id, label, values, tail));
+    REQUIRE(written == 4 + (1 + 8) + (1 + 8) + 1);
+
+    auto d = deserialize<Wire>(bd_buffer, written);
+    auto fields = d.template to<std::tuple<std::uint32_t, name, samples, std::uint8_t>>();
+    REQUIRE(fields);
+    REQUIRE(std::get<0>(*fields) == id);
+    REQUIRE(std::get<1>(*fields) == label);
+    REQUIRE(std::get<2>(*fields) == values);
+    REQUIRE(std::get<3>(*fields) == tail);
+    REQUIRE_FALSE(d.template to<std::uint8_t>());
+
+    auto single = deserialize<Wire>(bd_buffer + 4, written - 4).template to<name>();
+    REQUIRE(single);
+    REQUIRE(single->view() == "sensor-7");
+}
+
+TEST_CASE("bounded fields round-trip on both wires") {
+    bounded_round_trip<endianness::little>();
+    bounded_round_trip<endianness::big>();
+}
+
+TEST_CASE("an empty bounded field is its prefix alone") {
+    REQUIRE(serialize(samples{}).to(bd_buffer) == 1);
+    REQUIRE(bd_buffer[0] == std::byte{0});
+    auto back = deserialize(bd_buffer, 1).to<samples>();
+    REQUIRE(back);
+    REQUIRE(back->empty());
+}
+
+TEST_CASE("a hostile or truncated length prefix is rejected without consuming") {
+    bd_buffer[0] = std::byte{65};   // above the capacity of 64
+    auto over = deserialize(bd_buffer, sizeof(bd_buffer));
+    REQUIRE_FALSE(over.to<samples>());
+    REQUIRE(over.to<std::uint8_t>() == 65);
+
+    serialize(samples{1, 2, 3}).to(bd_buffer);
+    auto short_read = deserialize(bd_buffer, 6);   // the prefix promises 7 bytes
+    REQUIRE_FALSE(short_read.to<samples>());
+    REQUIRE(short_read.to<std::uint8_t>() == 3);
+
+    REQUIRE_FALSE(deserialize(bd_buffer, 0).to<samples>());
+}
+
+TEST_CASE("a rejected bounded field rolls the whole tuple back") {
+    const std::size_t written = serialize(std::uint16_t{0xBEEF}, name{"abc"}, std::uint32_t{7}).to(bd_buffer);
+    REQUIRE(written == 2 + 4 + 4);
+
+    // the prefix may not claim the bytes of the fields after it
+    auto d = deserialize(bd_buffer, written);
+    bd_buffer[2] = std::byte{6};
+    REQUIRE_FALSE((d.to<std::tuple<std::uint16_t, name, std::uint32_t>>()));
+    REQUIRE(d.to<std::uint16_t>() == 0xBEEF);
+
+    bd_buffer[2] = std::byte{3};
+    auto ok = deserialize(bd_buffer, written).to<std::tuple<std::uint16_t, name, std::uint32_t>>();
+    REQUIRE(ok);
+    REQUIRE(std::get<1>(*ok).view() == "abc");
+    REQUIRE(std::get<2>(*ok) == 7);
+
+    REQUIRE_FALSE((deserialize(bd_buffer, 2 + 1 + 3).to<std::tuple<std::uint16_t, name, std::uint32_t>>()));
+}
+
+TEST_CASE("bounded fields split across sink regions") {
+    const name label{"split"};
+    const samples values{0x0102, 0x0304};
+    std::byte expected[32]{};
+    const std::size_t total = serialize<endianness::big>(std::uint8_t{9}, label, values).to(expected);
+    REQUIRE(total == 1 + 6 + 5);
+    for (std::size_t split = 0; split <= total; ++split) {
+        std::byte a[32]{}, b[32]{};
+        chunk regions[] = { {a, split}, {b, total - split} };
+        chunk_sink out(regions);
+        REQUIRE(serialize<endianness::big>(std::uint8_t{9}, label, values).to(out) == total);
+        REQUIRE(std::memcmp(a, expected, split) == 0);
+        REQUIRE(std::memcmp(b, expected + split, total - split) == 0);
+    }
+}
+
+TEST_CASE("a buffer is checked against the exact size, not the maximum") {
+    const samples values{1, 2};
+    std::byte small[5];
+    REQUIRE(serialize(values).to(small) == 5);
+}
+
+TEST_CASE("the encoder writes the current size of a bound bounded field") {
+    std::uint8_t kind = 1;
+    samples values{};
+    auto enc = make_encoder(kind, values);
+    static_assert(decltype(enc)::max_size() == 1 + 129);
+
+    std::byte out[decltype(enc)::max_size()];
+    REQUIRE(enc.encode_into(out) == 2);
+    values.push_back(0xAAAA);
+    REQUIRE(enc.encode_into(out) == 4);
+    REQUIRE(out[1] == std::byte{1});
+}
+
+#ifdef NDEBUG
+TEST_CASE("an over-long source is truncated to the capacity") {
+    REQUIRE(bounded_string<4>{"overflow"}.view() == "over");
+    const std::uint8_t source[] = {1, 2, 3};
+    REQUIRE(bounded_vector<std::uint8_t, 2>(source, 3).size() == 2);
+}
+
+TEST_CASE("a buffer smaller than the message returns 0") {
+    std::byte small[4];
+    REQUIRE(serialize(samples{1, 2}).to(small) == 0);
+
+    std::uint8_t kind = 1;
+    samples values{0xAAAA};
+    REQUIRE(make_encoder(kind, values).encode_into(small, 3) == 0);
+}
+#endif
@@ -0,0 +1,85 @@
+#include <catch2/catch_all.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "eser/flat/flat.hpp"
+
+using namespace eser::flat;
+using eser::utils::bounded_string;
+
+namespace {
+    using ping      = message_type<0x01, std::uint32_t>;
+    using telemetry = message_type<0x02, std::uint32_t, float, float>;
+    using protocol  = message_set<std::uint8_t, ping, telemetry>;
+}
+
+TEST_CASE("message_pool slots fit the largest declared message") {
+    STATIC_REQUIRE(max_message_size_v<protocol> == 1 + 12);
+    STATIC_REQUIRE(max_message_size_v<std::uint16_t, telemetry> == 12);
+    STATIC_REQUIRE(max_message_size_v<protocol, std::tuple<std::uint32_t, bounded_string<32>>> == 4 + 1 + 32);
+
+    using pool = message_pool<4, protocol, std::tuple<std::uint64_t, std::uint64_t>>;
+    STATIC_REQUIRE(pool::slot_size == 16);
+    STATIC_REQUIRE(pool::capacity() == 4);
+    STATIC_REQUIRE(alignof(pool) == pool::cache_line);
+}
+
+TEST_CASE("buffer_pool hands out distinct aligned buffers until it runs out, then reuses released ones") {
+    static message_pool<3, protocol> pool;
+    REQUIRE(pool.available() == 3);
+
+    std::byte *a = pool.acquire();
+    std::byte *b = pool.acquire();
+    std::byte *c = pool.acquire();
+    REQUIRE((a and b and c));
+    REQUIRE((a != b and b != c and a != c));
+    for (std::byte *p : {a, b, c}) {
+        REQUIRE(pool.owns(p));
+        REQUIRE(reinterpret_cast<std::uintptr_t>(p) % pool.cache_line == 0);
+    }
+    REQUIRE(pool.acquire() == nullptr);
+    REQUIRE(pool.available() == 0);
+    REQUIRE_FALSE(pool.owns(a + 1));
+
+    REQUIRE(serialize(std::uint8_t{telemetry::id}, std::uint32_t{7}, 1.5f, 2.5f).to(b, pool.slot_size) == pool.slot_size);
+    std::size_t seen = 0;
+    REQUIRE(protocol::dispatch(b, pool.slot_size, [&seen](auto, auto... fields){ seen = sizeof...(fields); }) == pool.slot_size);
+    REQUIRE(seen == 3);
+
+    pool.release(b);
+    REQUIRE(pool.available() == 1);
+    REQUIRE(pool.acquire() == b);   // the freelist is last in, first out
+    pool.release(a);
+    pool.release(b);
+    pool.release(c);
+    REQUIRE(pool.available() == 3);
+}
+
+TEST_CASE("buffer_pool gives every buffer to one thread at a time") {
+    static buffer_pool<4, 16> pool;
+    constexpr std::uint32_t threads = 8;
+    constexpr std::uint32_t rounds = 5000;
+    std::atomic<bool> exclusive{true};
+    std::vector<std::thread> workers;
+    for (std::uint32_t t = 0; t < threads; ++t) {
+        workers.emplace_back([t, &exclusive]{
+            for (std::uint32_t i = 0; i < rounds; ++i) {
+                std::byte *buffer;
+                while ((buffer = pool.acquire()) == nullptr) std::this_thread::yield();
+                const std::uint32_t stamp = t * rounds + i;
+                std::memcpy(buffer, &stamp, sizeof(stamp));
+                std::this_thread::yield();
+                std::uint32_t kept;
+                std::memcpy(&kept, buffer, sizeof(kept));
+                if (kept != stamp) exclusive = false;
+                pool.release(buffer);
+            }
+        });
+    }
+    for (auto &w : workers) w.join();
+    REQUIRE(exclusive);
+    REQUIRE(pool.available() == 4);
+}
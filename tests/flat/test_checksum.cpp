@@ -0,0 +1,81 @@
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstring>
+#include "eser/flat/flat.hpp"
+
+using namespace eser::flat;
+
+namespace {
+    const char cs_check[] = "123456789";
+    const std::byte *cs_bytes(const char *text) { return static_cast<const std::byte *>(static_cast<const void *>(text)); }
+
+    std::byte cs_long[1027];
+    void cs_fill() { for (std::size_t i = 0; i < sizeof(cs_long); ++i) cs_long[i] = std::byte(i * 131 + 7); }
+
+    // bit-by-bit reference, independent of the tables and the CRC instructions
+    std::uint32_t cs_reference32(std::uint32_t poly, const std::byte *data, std::size_t n)
+    {
+        std::uint32_t crc = 0xFFFFFFFFu;
+        for (std::size_t i = 0; i < n; ++i) {
+            crc ^= std::to_integer<std::uint32_t>(data[i]);
+            for (int bit = 0; bit < 8; ++bit) crc = (crc & 1u) ? (crc >> 1) ^ poly : crc >> 1;
+        }
+        return ~crc;
+    }
+}
+
+TEST_CASE("the CRC policies produce their catalogued check values") {
+    REQUIRE(checksum_of<crc16_ccitt>(cs_bytes(cs_check), 9) == 0x29B1);
+    REQUIRE(checksum_of<crc32>(cs_bytes(cs_check), 9) == 0xCBF43926u);
+    REQUIRE(checksum_of<crc32c>(cs_bytes(cs_check), 9) == 0xE3069283u);
+    REQUIRE(checksum_of<crc32>(cs_bytes(cs_check), 0) == 0);
+    REQUIRE(checksum_of<no_checksum>(cs_bytes(cs_check), 9) == 0);
+}
+
+TEST_CASE("the CRC kernels agree with a bitwise reference at every length") {
+    cs_fill();
+    for (std::size_t n : {1u, 3u, 4u, 7u, 8u, 9u, 15u, 16u, 17u, 63u, 1027u}) {
+        REQUIRE(checksum_of<crc32>(cs_long, n) == cs_reference32(0xEDB88320u, cs_long, n));
+        REQUIRE(checksum_of<crc32c>(cs_long, n) == cs_reference32(0x82F63B78u, cs_long, n));
+    }
+}
+
+TEST_CASE("a checksum fed in pieces equals the one-shot checksum") {
+    cs_fill();
+    for (std::size_t split = 0; split <= 64; split += 5) {
+        auto state = crc32c::update(crc32c::initial, cs_long, split);
+        state = crc32c::update(state, cs_long + split, 100 - split);
+        REQUIRE(crc32c::finalize(state) == checksum_of<crc32c>(cs_long, 100));
+
+        auto narrow = crc16_ccitt::update(crc16_ccitt::initial, cs_long, split);
+        narrow = crc16_ccitt::update(narrow, cs_long + split, 100 - split);
+        REQUIRE(crc16_ccitt::finalize(narrow) == checksum_of<crc16_ccitt>(cs_long, 100));
+    }
+}
+
+TEST_CASE("checksum_sink checksums what the serializer writes, across regions") {
+    std::byte expected[16]{};
+    const std::size_t total = serialize<endianness::big>(std::uint32_t{0xDEADBEEF}, std::uint16_t{7}, 2.5f).to(expected);
+    for (std::size_t split = 0; split <= total; ++split) {
+        std::byte a[16]{}, b[16]{};
+        chunk regions[] = { {a, split}, {b, total - split} };
+        chunk_sink out(regions);
+        checksum_sink<crc32, chunk_sink> summed(out);
+        REQUIRE(serialize<endianness::big>(std::uint32_t{0xDEADBEEF}, std::uint16_t{7}, 2.5f).to(summed) == total);
+        REQUIRE(summed.value() == checksum_of<crc32>(expected, total));
+        REQUIRE(std::memcmp(a, expected, split) == 0);
+    }
+}
+
+TEST_CASE("checksum_source checksums what the deserializer reads") {
+    std::byte wire[16]{};
+    const std::size_t total = serialize(std::uint8_t{1}, std::uint64_t{0x0102030405060708ull}, std::int16_t{-2}).to(wire);
+    const_chunk regions[] = { {wire, 5}, {wire + 5, total - 5} };
+    chunk_source in(regions);
+    checksum_source<crc16_ccitt, chunk_source> summed(in);
+    auto fields = deserialize(summed).to<std::tuple<std::uint8_t, std::uint64_t, std::int16_t>>();
+    REQUIRE(fields);
+    REQUIRE(std::get<1>(*fields) == 0x0102030405060708ull);
+    REQUIRE(summed.value() == checksum_of<crc16_ccitt>(wire, total));
+    REQUIRE(in.consumed() == total);
+}
@@ -0,0 +1,94 @@
+#include <catch2/catch_all.hpp>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include "eser/flat/serializer.hpp"
+#include "eser/flat/deserializer.hpp"
+#include "eser/flat/convert.hpp"
+#include "eser/utils/bits.hpp"
+#include "eser/utils/fixed_string.hpp"
+#include "eser/utils/reflect.hpp"
+
+using namespace eser::flat;
+using eser::utils::bits;
+using eser::utils::fixed_string;
+
+namespace {
+    enum class mode : std::uint16_t { idle = 0x0102, run = 0x0304 };
+
+    struct sample{
+        std::uint8_t channel;
+        std::uint32_t value;
+        std::int16_t offset;
+    };
+    ESER_REFLECT(sample, channel, value, offset);
+
+    struct compact{
+        std::uint8_t tag;
+        std::uint32_t count;
+    };
+    ESER_REFLECT_PACKED(compact, tag, count);
+
+    template<std::size_t N>
+    bool same_bytes(const std::byte (&a)[N], const std::byte (&b)[N], std::size_t n) {
+        return std::memcmp(a, b, n) == 0;
+    }
+}
+
+TEST_CASE("convert_in_place turns a big-endian message into the little-endian one") {
+    const std::uint32_t words[5] = {1, 0x01020304u, 3, 4, 5};
+    const std::int16_t shorts[3] = {-2, 0x0102, 7};
+    std::byte big[96] = {};
+    std::byte little[96] = {};
+    const std::size_t n = serialize<endianness::big>(std::uint8_t{9}, words, std::uint32_t{0xA0B0C0D0u}, 2.5f,
+                                                     fixed_string<6>{"node"}, shorts, mode::run, 1.0e10, true).to(big);
+    REQUIRE(serialize<endianness::little>(std::uint8_t{9}, words, std::uint32_t{0xA0B0C0D0u}, 2.5f,
+                                          fixed_string<6>{"node"}, shorts, mode::run, 1.0e10, true).to(little) == n);
+
+    const std::size_t converted = convert_in_place<endianness::big, endianness::little,
+        std::uint8_t, std::uint32_t[5], std::uint32_t, float, fixed_string<6>, std::int16_t[3], mode, double, bool>(big, sizeof(big));
+    REQUIRE(converted == n);
+    REQUIRE(same_bytes(big, little, n));
+
+    // and back again
+    convert_in_place<endianness::little, endianness::big,
+        std::uint8_t, std::uint32_t[5], std::uint32_t, float, fixed_string<6>, std::int16_t[3], mode, double, bool>(big, n);
+    auto d = deserialize<endianness::big>(big, n);
+    auto m = d.to<std::tuple<std::uint8_t, std::array<std::uint32_t, 5>, std::uint32_t>>();
+    REQUIRE(m);
+    REQUIRE(std::get<1>(*m)[1] == 0x01020304u);
+    REQUIRE(std::get<2>(*m) == 0xA0B0C0D0u);
+}
+
+TEST_CASE("convert_in_place converts described structs member by member and repacks bit groups") {
+    using flag = bits<1, bool>;
+    using level = bits<12, std::uint16_t>;
+    using kind = bits<3, std::uint8_t>;
+    sample samples[2];
+    std::memset(samples, 0, sizeof(samples));   // the native wire copies the padding as is
+    samples[0].channel = 1, samples[0].value = 0x11223344u, samples[0].offset = -3;
+    samples[1].channel = 2, samples[1].value = 7, samples[1].offset = 0x0506;
+    const compact c{4, 0xCAFEBABEu};
+    std::byte big[64] = {};
+    std::byte little[64] = {};
+    const std::size_t n = serialize<endianness::big>(flag{true}, level{0xABC}, kind{5}, samples, c, bits<10, std::uint16_t>{0x2F1}).to(big);
+    REQUIRE(serialize<endianness::little>(flag{true}, level{0xABC}, kind{5}, samples, c, bits<10, std::uint16_t>{0x2F1}).to(little) == n);
+
+    REQUIRE(convert_in_place<endianness::big, endianness::little,
+        flag, level, kind, sample[2], compact, bits<10, std::uint16_t>>(big, n) == n);
+    REQUIRE(same_bytes(big, little, n));
+}
+
+TEST_CASE("convert_in_place leaves short buffers and same-order conversions alone") {
+    std::byte buffer[8] = {};
+    const std::size_t n = serialize<endianness::big>(std::uint32_t{0x01020304u}, std::uint16_t{0x0506}).to(buffer);
+    std::byte copy[8];
+    std::memcpy(copy, buffer, sizeof(buffer));
+
+    REQUIRE(convert_in_place<endianness::big, endianness::little, std::uint32_t, std::uint16_t>(buffer, n - 1) == 0);
+    REQUIRE(same_bytes(buffer, copy, sizeof(buffer)));
+    REQUIRE(convert_in_place<endianness::big, endianness::big, std::uint32_t, std::uint16_t>(buffer, n) == n);
+    REQUIRE(same_bytes(buffer, copy, sizeof(buffer)));
+    STATIC_REQUIRE(details::swap_width<endianness::big, fixed_string<4>>() == 0);
+    STATIC_REQUIRE(details::swap_width<endianness::big, std::uint8_t[4]>() == 0);
+}
@@ -0,0 +1,115 @@
+#include <catch2/catch_all.hpp>
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include "eser/flat/serializer.hpp"
+#include "eser/flat/delta.hpp"
+#include "eser/utils/bits.hpp"
+
+using namespace eser::flat;
+using eser::utils::bits;
+
+namespace {
+    using tx_t = delta_encoder<endianness::big, std::uint32_t, float, std::int16_t[3], std::uint8_t>;
+    using rx_t = delta_decoder<endianness::big, std::uint32_t, float, std::int16_t[3], std::uint8_t>;
+}
+
+TEST_CASE("delta frames carry only the changed fields and rebuild the full message") {
+    STATIC_REQUIRE(tx_t::max_size() == 1 + 4 + 4 + 6 + 1);
+    STATIC_REQUIRE(std::is_same_v<rx_t::message_type, std::tuple<std::uint32_t, float, std::array<std::int16_t, 3>, std::uint8_t>>);
+    tx_t tx;
+    rx_t rx;
+    std::byte packet[tx_t::max_size()];
+    std::int16_t axes[3] = {1, -2, 3};
+
+    // From the all-zero start, every nonzero field is sent.
+    std::size_t n = tx.encode_into(packet, sizeof(packet), 7, 1.5f, axes, 0);
+    REQUIRE(n == 1 + 4 + 4 + 6);
+    REQUIRE(packet[0] == std::byte{0b0111});
+    auto frame = rx.decode(packet, n);
+    REQUIRE(frame);
+    REQUIRE(*frame == std::make_tuple(std::uint32_t{7}, 1.5f, std::array<std::int16_t, 3>{1, -2, 3}, std::uint8_t{0}));
+
+    // One field changes: the bitmap and that field's four bytes.
+    n = tx.encode_into(packet, sizeof(packet), 8, 1.5f, axes, 0);
+    REQUIRE(n == 1 + 4);
+    REQUIRE(packet[0] == std::byte{0b0001});
+    REQUIRE(packet[4] == std::byte{8});   // still the big-endian wire bytes
+    frame = rx.decode(packet, n);
+    REQUIRE(std::get<0>(*frame) == 8);
+    REQUIRE(std::get<1>(*frame) == 1.5f);
+
+    // Nothing changes: the bitmap alone.
+    REQUIRE(tx.encode_into(packet, sizeof(packet), 8, 1.5f, axes, 0) == 1);
+    REQUIRE(rx.decode(packet, 1));
+
+    // refresh() resends every field, so a decoder that joins late catches up.
+    tx.refresh();
+    n = tx.encode_into(packet, sizeof(packet), 8, 1.5f, axes, 9);
+    REQUIRE(n == tx_t::max_size());
+    rx_t late;
+    REQUIRE(late.decode(packet, n) == rx.decode(packet, n));
+}
+
+TEST_CASE("malformed delta frames are rejected and leave the decoder untouched") {
+    tx_t tx;
+    rx_t rx;
+    std::byte packet[tx_t::max_size()];
+    std::int16_t axes[3] = {0, 0, 0};
+    const std::size_t n = tx.encode_into(packet, sizeof(packet), 5, 0.f, axes, 0);
+    REQUIRE(n == 5);
+
+    REQUIRE_FALSE(rx.decode(packet, n - 1));   // truncated
+    REQUIRE_FALSE(rx.decode(packet, 0));
+    std::byte trailing[8] = {packet[0], packet[1], packet[2], packet[3], packet[4], std::byte{0}};
+    REQUIRE_FALSE(rx.decode(trailing, n + 1));
+    const std::byte unknown[1] = {std::byte{0x10}};   // bit 4: the message has four fields
+    REQUIRE_FALSE(rx.decode(unknown, 1));
+
+    auto frame = rx.decode(packet, n);
+    REQUIRE(frame);
+    REQUIRE(std::get<0>(*frame) == 5);
+}
+
+TEST_CASE("XOR frames are the full image XOR the previous one") {
+    tx_t tx;
+    rx_t rx;
+    std::byte packet[tx_t::xor_size()];
+    std::int16_t axes[3] = {4, 5, 6};
+    REQUIRE(tx.encode_xor_into(packet, sizeof(packet), 0x01020304u, 2.f, axes, 1) == sizeof(packet));
+    REQUIRE(rx.decode_xor(packet, sizeof(packet)));
+
+    axes[1] = 0x0105;
+    REQUIRE(tx.encode_xor_into(packet, sizeof(packet), 0x01020304u, 2.f, axes, 1) == sizeof(packet));
+    for (std::size_t i = 0; i < sizeof(packet); ++i)
+        REQUIRE(packet[i] == (i == 10 ? std::byte{0x01} : std::byte{0}));   // 5 -> 0x0105, high byte
+    auto frame = rx.decode_xor(packet, sizeof(packet));
+    REQUIRE(frame);
+    REQUIRE(std::get<2>(*frame) == std::array<std::int16_t, 3>{4, 0x0105, 6});
+    REQUIRE_FALSE(rx.decode_xor(packet, sizeof(packet) - 1));
+
+    tx.reset();
+    rx.reset();
+    REQUIRE(tx.encode_xor_into(packet, sizeof(packet), 0, 0.f, axes, 0) == sizeof(packet));
+    REQUIRE(std::get<2>(*rx.decode_xor(packet, sizeof(packet)))[1] == 0x0105);
+}
+
+TEST_CASE("a bit group is one delta field, flagged on its first member") {
+    using flag = bits<1, bool>;
+    using level = bits<12, std::uint16_t>;
+    delta_encoder<endianness::little, std::uint16_t, flag, level> tx;
+    delta_decoder<endianness::little, std::uint16_t, flag, level> rx;
+    std::byte packet[decltype(tx)::max_size()];
+
+    REQUIRE(tx.encode_into(packet, sizeof(packet), 3, flag{false}, level{0x123}) == 1 + 2 + 2);
+    REQUIRE(packet[0] == std::byte{0b011});
+    REQUIRE(rx.decode(packet, 5));
+    REQUIRE(tx.encode_into(packet, sizeof(packet), 3, flag{true}, level{0x123}) == 1 + 2);
+    auto frame = rx.decode(packet, 3);
+    REQUIRE(frame);
+    REQUIRE(std::get<1>(*frame).value());
+    REQUIRE(std::get<2>(*frame).value() == 0x123);
+
+    const std::byte member[1] = {std::byte{0b100}};   // the group's second member has no bytes of its own
+    REQUIRE_FALSE(rx.decode(member, 1));
+}
@@ -3,6 +3,7 @@
 #include <cstdint>
 #include <tuple>
 #include <array>
+#include <cstring>
 #include "eser/flat/deserializer.hpp"
 
 using namespace eser::flat;
@@ -346,3 +347,51 @@ TEST_CASE("Single-element tuple unpacks unambiguously") {
     auto& [x] = *result;
     REQUIRE(x == v);
 }
+
+TEST_CASE("C-array and nested C-array types deserialize as std::array") {
+    fill();
+    std::int32_t grid[2][3] = {{1, -2, 3}, {-4, 5, -6}};
+    std::memcpy(buffer, grid, sizeof(grid));
+
+    auto a = deserialize(buffer).to<std::int32_t[2][3]>();
+    static_assert(std::is_same_v<decltype(a), std::optional<std::array<std::array<std::int32_t, 3>, 2>>>);
+    REQUIRE(a);
+    REQUIRE((*a)[1][2] == -6);
+
+    REQUIRE_FALSE(deserialize(buffer, sizeof(grid) - 1).to<std::int32_t[2][3]>());
+}
+
+TEST_CASE("view<T>() decodes in place without copying the payload") {
+    fill();
+    std::uint16_t samples[64];
+    for (std::uint16_t i = 0; i < 64; ++i) samples[i] = static_cast<std::uint16_t>(i * 3);
+    std::memcpy(buffer, samples, sizeof(samples));
+    buffer[sizeof(samples)] = 0x2A;
+
+    auto d = deserialize(buffer, sizeof(samples) + 1);
+    auto v = d.view<std::uint16_t[64]>();
+    REQUIRE(v);
+    REQUIRE(v->data() == reinterpret_cast<const std::byte*>(buffer)); // points into the input buffer
+    REQUIRE(v->size() == 64);
+    REQUIRE((*v)[10] == 30);
+    REQUIRE(v->at(63) == std::optional<std::uint16_t>{189});
+    REQUIRE_FALSE(v->at(64));
+    REQUIRE(v->get()[5] == 15);
+
+    // The cursor moved past the viewed bytes.
+    REQUIRE(*d.to<std::uint8_t>() == 0x2A);
+    REQUIRE_FALSE(d.view<std::uint8_t>());
+}
+
+TEST_CASE("view<T>() of a nested array indexes into inner views") {
+    fill();
+    std::int16_t grid[3][2] = {{1, 2}, {3, 4}, {5, 6}};
+    std::memcpy(buffer, grid, sizeof(grid));
+
+    auto v = deserialize(buffer).view<std::array<std::array<std::int16_t, 2>, 3>>();
+    REQUIRE(v);
+    auto row = (*v)[2];
+    REQUIRE(row.size() == 2);
+    REQUIRE(row[1] == 6);
+    REQUIRE(v->at(1)->get() == std::array<std::int16_t, 2>{3, 4});
+}
@@ -0,0 +1,74 @@
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include "eser/flat/serializer.hpp"
+#include "eser/flat/deserializer.hpp"
+#include "eser/flat/encoder.hpp"
+
+using namespace eser::flat;
+using eser::utils::endianness;
+
+TEST_CASE("encoder re-encodes the current values of its bound variables") {
+    std::uint32_t tick = 0;
+    float setpoint = 1.5f;
+    std::int16_t samples[3] = {1, -2, 3};
+
+    auto enc = make_encoder<endianness::big>(tick, setpoint, samples);
+    static_assert(decltype(enc)::size() == 4 + 4 + 6);
+
+    std::byte frame[decltype(enc)::size()];
+    for (std::uint32_t i = 1; i <= 3; ++i) {
+        tick = i;
+        samples[1] = static_cast<std::int16_t>(-2 * static_cast<int>(i));
+        REQUIRE(enc.encode_into(frame) == sizeof(frame));
+
+        auto d = deserialize<endianness::big>(frame, sizeof(frame));
+        auto t = d.to<std::uint32_t>();
+        auto sp = d.to<float>();
+        auto s = d.to<std::int16_t[3]>();
+        REQUIRE((t and sp and s));
+        REQUIRE(*t == i);
+        REQUIRE(*sp == 1.5f);
+        REQUIRE(*s == std::array<std::int16_t, 3>{1, static_cast<std::int16_t>(-2 * static_cast<int>(i)), 3});
+    }
+}
+
+TEST_CASE("encoder writes the same bytes as serialize(...).to(...)") {
+    std::uint8_t id = 7;
+    double value = -3.25;
+    std::array<std::uint16_t, 4> words{1, 2, 3, 4};
+
+    std::byte expected[32]{};
+    std::byte actual[32]{};
+    std::size_t n = serialize<endianness::big>(id, value, words).to(expected, sizeof(expected));
+
+    auto enc = make_encoder<endianness::big>(id, value, words);
+    REQUIRE(enc.encode_into(actual, sizeof(actual)) == n);
+    REQUIRE(std::memcmp(expected, actual, n) == 0);
+
+    std::uint8_t legacy[decltype(enc)::size()]{};
+    REQUIRE(enc.encode_into(legacy) == n);
+    REQUIRE(std::memcmp(expected, legacy, n) == 0);
+}
+
+TEST_CASE("encoder accepts a larger runtime buffer and defaults to little-endian") {
+    std::uint16_t a = 0x0102;
+    auto enc = make_encoder(a);
+
+    std::uint8_t buffer[8]{};
+    REQUIRE(enc.encode_into(buffer, sizeof(buffer)) == 2);
+    REQUIRE(buffer[0] == 0x02);
+    REQUIRE(buffer[1] == 0x01);
+}
+
+#ifdef NDEBUG
+TEST_CASE("encoder returns 0 and writes nothing into an undersized runtime buffer") {
+    std::uint32_t a = 0xDEADBEEF;
+    auto enc = make_encoder(a);
+
+    std::byte buffer[3]{};
+    REQUIRE(enc.encode_into(buffer + 0, sizeof(buffer)) == 0);
+    REQUIRE(buffer[0] == std::byte{0});
+}
+#endif
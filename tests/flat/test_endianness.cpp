@@ -5,6 +5,7 @@
 #include "eser/flat/serializer.hpp"
 #include "eser/flat/deserializer.hpp"
 #include "eser/utils/fixed_string.hpp"
+#include <cstring>
 
 using namespace eser::flat;
 using eser::utils::endianness;
@@ -142,3 +143,96 @@ TEST_CASE("explicit little-endian equals the default") {
     serialize<endianness::little>(v).to(b); // explicit little
     REQUIRE(std::equal(a, a + 4, b));
 }
+
+template<typename U>
+static void check_byteswap_copy_matches_scalar_reverse(std::size_t count) {
+    std::array<U, 67> src{};
+    for (std::size_t i = 0; i < src.size(); ++i) src[i] = static_cast<U>(0x0102030405060708ull * (i + 1));
+    std::array<U, 67> dst{};
+    eser::internal::byteswap_copy<sizeof(U)>(dst.data(), src.data(), count);
+    for (std::size_t i = 0; i < count; ++i) {
+        U expected = src[i];
+        eser::internal::reverse_bytes(expected);
+        REQUIRE(dst[i] == expected);
+    }
+    for (std::size_t i = count; i < dst.size(); ++i) REQUIRE(dst[i] == 0); // no write past the run
+}
+
+TEST_CASE("byteswap_copy matches a scalar reverse for every width and tail length") {
+    for (std::size_t count : {0u, 1u, 7u, 8u, 16u, 17u, 33u, 67u}) {
+        check_byteswap_copy_matches_scalar_reverse<std::uint16_t>(count);
+        check_byteswap_copy_matches_scalar_reverse<std::uint32_t>(count);
+        check_byteswap_copy_matches_scalar_reverse<std::uint64_t>(count);
+    }
+}
+
+TEST_CASE("byteswap_copy swaps in place when source and destination coincide") {
+    std::array<std::uint32_t, 19> v{};
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = 0x01020304u + static_cast<std::uint32_t>(i);
+    eser::internal::byteswap_copy<4>(v.data(), v.data(), v.size());
+    for (std::size_t i = 0; i < v.size(); ++i) REQUIRE(v[i] == eser::internal::byteswap(0x01020304u + static_cast<std::uint32_t>(i)));
+}
+
+TEST_CASE("big-endian std::array<float, N> frame round-trips through the vector kernel") {
+    static std::uint8_t frame_buffer[256 * sizeof(float)];
+    std::array<float, 256> frame{};
+    for (std::size_t i = 0; i < frame.size(); ++i) frame[i] = static_cast<float>(i) * 0.25f - 3.0f;
+
+    REQUIRE(serialize<endianness::big>(frame).to(frame_buffer) == sizeof(frame));
+    std::uint32_t first_bits = 0;
+    std::memcpy(&first_bits, &frame[1], sizeof(first_bits));
+    REQUIRE(frame_buffer[4] == ((first_bits >> 24) & 0xFF)); // element 1, most-significant byte first
+
+    auto out = deserialize<endianness::big>(frame_buffer).to<std::array<float, 256>>();
+    REQUIRE(out);
+    REQUIRE(*out == frame);
+}
+
+TEST_CASE("big-endian nested C-array and enum arrays swap while copying") {
+    e_clear();
+    enum class mode : std::uint16_t { idle = 0x0102, run = 0x0304 };
+    std::uint32_t grid[2][2] = {{0x01020304u, 0x05060708u}, {0x090A0B0Cu, 0x0D0E0F10u}};
+    std::array<mode, 2> modes = {mode::run, mode::idle};
+
+    auto written = serialize<endianness::big>(grid, modes).to(e_buffer);
+    REQUIRE(written == sizeof(grid) + sizeof(modes));
+    REQUIRE(e_buffer[0] == 0x01);  REQUIRE(e_buffer[3] == 0x04);
+    REQUIRE(e_buffer[12] == 0x0D); REQUIRE(e_buffer[15] == 0x10);
+    REQUIRE(e_buffer[16] == 0x03); REQUIRE(e_buffer[17] == 0x04);
+
+    auto fields = deserialize<endianness::big>(e_buffer)
+        .to<std::tuple<std::array<std::array<std::uint32_t, 2>, 2>, std::array<mode, 2>>>();
+    REQUIRE(fields);
+    auto& [rgrid, rmodes] = *fields;
+    REQUIRE(rgrid[1][0] == grid[1][0]);
+    REQUIRE(rmodes == modes);
+}
+
+TEST_CASE("native-order arrays of structs and strings copy as one block") {
+    e_clear();
+    struct pair16 { std::uint16_t a, b; };
+    std::array<pair16, 3> pairs = {{ {1, 2}, {3, 4}, {5, 6} }};
+    std::array<fixed_string<4>, 2> tags = {fixed_string<4>{"ab"}, fixed_string<4>{"wxyz"}};
+
+    auto written = serialize(pairs, tags).to(e_buffer);
+    REQUIRE(written == sizeof(pairs) + sizeof(tags));
+    REQUIRE(std::memcmp(e_buffer, pairs.data(), sizeof(pairs)) == 0);
+
+    // fixed_string is endianness-neutral, so an array of them also crosses a big-endian wire whole.
+    serialize<endianness::big>(tags).to(e_buffer);
+    auto out = deserialize<endianness::big>(e_buffer).to<std::array<fixed_string<4>, 2>>();
+    REQUIRE(out);
+    REQUIRE((*out)[1].view() == "wxyz");
+}
+
+TEST_CASE("big-endian view swaps lazily on element access") {
+    e_clear();
+    std::array<std::uint32_t, 4> values = {0x01020304u, 0x05060708u, 0x090A0B0Cu, 0x0D0E0F10u};
+    serialize<endianness::big>(values).to(e_buffer);
+
+    auto v = deserialize<endianness::big>(e_buffer).view<std::array<std::uint32_t, 4>>();
+    REQUIRE(v);
+    REQUIRE(e_buffer[4] == 0x05);      // wire bytes stay big-endian in place
+    REQUIRE((*v)[1] == 0x05060708u);   // decoded on access
+    REQUIRE(v->get() == values);
+}
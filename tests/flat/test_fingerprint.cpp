@@ -0,0 +1,74 @@
+#include <catch2/catch_all.hpp>
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include "eser/flat/serializer.hpp"
+#include "eser/flat/deserializer.hpp"
+#include "eser/flat/fingerprint.hpp"
+#include "eser/utils/arena.hpp"
+#include "eser/utils/bits.hpp"
+#include "eser/utils/bounded_string.hpp"
+#include "eser/utils/bounded_vector.hpp"
+#include "eser/utils/fixed_string.hpp"
+#include "eser/utils/reflect.hpp"
+
+using namespace eser::flat;
+using eser::utils::bits;
+using eser::utils::bounded_vector;
+using eser::utils::fixed_string;
+
+namespace {
+    enum class color : std::uint8_t { red, green };
+    enum class colour : std::uint8_t { rouge, vert, bleu };
+    enum class wide_color : std::uint16_t { red, green };
+
+    struct point{ std::uint16_t x; std::uint32_t y; };
+    ESER_REFLECT(point, x, y);
+    struct point_packed{ std::uint16_t x; std::uint32_t y; };
+    ESER_REFLECT_PACKED(point_packed, x, y);
+    struct point_swapped{ std::uint16_t x; std::uint32_t y; };
+    ESER_REFLECT(point_swapped, y, x);
+
+    template<typename... T>
+    constexpr std::uint32_t le = schema_fingerprint_v<endianness::little, T...>;
+}
+
+TEST_CASE("the fingerprint follows types, order, sizes and byte order") {
+    STATIC_REQUIRE(le<std::uint32_t, float> != le<float, std::uint32_t>);
+    STATIC_REQUIRE(le<std::uint32_t> != le<std::int32_t>);
+    STATIC_REQUIRE(le<std::uint32_t> != le<std::uint64_t>);
+    STATIC_REQUIRE(le<std::uint32_t> != le<std::uint32_t, std::uint32_t>);
+    STATIC_REQUIRE(le<std::uint32_t> != schema_fingerprint_v<endianness::big, std::uint32_t>);
+    STATIC_REQUIRE(le<bool> != le<std::uint8_t>);
+    STATIC_REQUIRE(le<fixed_string<8>> != le<fixed_string<9>>);
+    STATIC_REQUIRE(le<bits<3, std::uint8_t>, bits<5, std::uint8_t>> != le<bits<4, std::uint8_t>, bits<4, std::uint8_t>>);
+    STATIC_REQUIRE(le<bounded_vector<std::uint8_t, 255>> != le<bounded_vector<std::uint8_t, 256>>);   // the prefix widens
+    STATIC_REQUIRE(le<color> != le<wide_color>);
+    STATIC_REQUIRE(le<point> != le<point_packed>);
+    STATIC_REQUIRE(le<point> != le<point_swapped>);
+}
+
+TEST_CASE("the fingerprint ignores what the wire does not carry") {
+    STATIC_REQUIRE(le<color> == le<colour>);                                  // names
+    STATIC_REQUIRE(le<const std::uint16_t &> == le<std::uint16_t>);
+    STATIC_REQUIRE(le<float[3]> == le<std::array<float, 3>>);
+    STATIC_REQUIRE(le<bounded_vector<char, 16>> == le<eser::utils::bounded_string<16>>);
+    STATIC_REQUIRE(le<bounded_vector<float, 64>> == le<eser::utils::arena_vector<float, 64>>);
+    // FNV-1a over a fixed description: the value is the same on every compiler and host.
+    STATIC_REQUIRE(le<std::uint32_t> == 0x519982E2u);
+}
+
+TEST_CASE("a prefixed fingerprint rejects a mismatched layout with one compare") {
+    constexpr std::uint32_t ours = schema_fingerprint_v<endianness::big, std::uint32_t, float, float>;
+    constexpr std::uint32_t theirs = schema_fingerprint_v<endianness::big, std::uint32_t, float, std::int32_t>;
+    std::byte packet[16];
+    const std::size_t n = serialize<endianness::big>(theirs, std::uint32_t{1}, 2.f, std::int32_t{3}).to(packet);
+
+    auto d = deserialize<endianness::big>(packet, n);
+    REQUIRE(d.to<std::uint32_t>() != ours);
+
+    serialize<endianness::big>(ours, std::uint32_t{1}, 2.f, 3.f).to(packet);
+    auto again = deserialize<endianness::big>(packet, n);
+    REQUIRE(again.to<std::uint32_t>() == ours);
+    REQUIRE(again.to<std::tuple<std::uint32_t, float, float>>() == std::make_tuple(std::uint32_t{1}, 2.f, 3.f));
+}
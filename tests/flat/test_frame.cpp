@@ -0,0 +1,130 @@
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include "eser/flat/flat.hpp"
+#include "eser/utils/bounded_vector.hpp"
+
+using namespace eser::flat;
+
+namespace {
+    using crc16_link = frame<crc16_ccitt, endianness::big>;
+    using link32 = frame<crc32c, endianness::little, 0x7E7E>;
+    using bare = frame<no_checksum, endianness::little>;
+    using message = std::tuple<std::uint32_t, std::uint16_t, float>;
+
+    std::byte fr_buffer[128];
+}
+
+static_assert(crc16_link::overhead == 6 and link32::overhead == 8 and bare::overhead == 4);
+static_assert(crc16_link::max_size_of<std::uint32_t, std::uint16_t, float>() == 6 + 10);
+static_assert(crc16_link::max_size_of<eser::utils::bounded_vector<std::uint8_t, 32>>() == 6 + 33);
+
+TEST_CASE("a frame is sync, length, payload and a checksum over length and payload") {
+    std::memset(fr_buffer, 0xAB, sizeof(fr_buffer));
+    REQUIRE(crc16_link::serialize(std::uint32_t{0x01020304}, std::uint16_t{0x0506}).to(fr_buffer) == 6 + 6);
+    REQUIRE(fr_buffer[0] == std::byte{0xEB});
+    REQUIRE(fr_buffer[1] == std::byte{0x90});
+    REQUIRE(fr_buffer[2] == std::byte{0x00});
+    REQUIRE(fr_buffer[3] == std::byte{0x06});
+    REQUIRE(fr_buffer[4] == std::byte{0x01});
+    REQUIRE(fr_buffer[9] == std::byte{0x06});
+    const std::uint16_t crc = checksum_of<crc16_ccitt>(fr_buffer + 2, 2 + 6);
+    REQUIRE(fr_buffer[10] == std::byte(crc >> 8));
+    REQUIRE(fr_buffer[11] == std::byte(crc & 0xFF));
+    REQUIRE(fr_buffer[12] == std::byte{0xAB});
+    REQUIRE(crc16_link::size_of(fr_buffer, sizeof(fr_buffer)) == 12);
+}
+
+TEST_CASE("open verifies the frame and hands out the payload") {
+    const std::size_t n = link32::serialize(std::uint32_t{42}, std::uint16_t{7}, 1.5f).to(fr_buffer);
+    REQUIRE(n == 8 + 10);
+    auto payload = link32::open(fr_buffer, n);
+    REQUIRE(payload);
+    auto fields = payload->to<message>();
+    REQUIRE(fields);
+    REQUIRE(std::get<0>(*fields) == 42);
+    REQUIRE(std::get<2>(*fields) == 1.5f);
+    REQUIRE_FALSE(payload->to<std::uint8_t>());   // the deserializer ends at the payload
+}
+
+TEST_CASE("open rejects a corrupt, truncated or foreign frame") {
+    const std::size_t n = crc16_link::serialize(std::uint32_t{42}, std::uint16_t{7}, 1.5f).to(fr_buffer);
+    for (std::size_t i = 0; i < n; ++i) {
+        fr_buffer[i] ^= std::byte{0x10};
+        REQUIRE_FALSE(crc16_link::open(fr_buffer, n));
+        fr_buffer[i] ^= std::byte{0x10};
+    }
+    REQUIRE(crc16_link::open(fr_buffer, n));
+    REQUIRE_FALSE(crc16_link::open(fr_buffer, n - 1));
+    REQUIRE_FALSE(crc16_link::open(fr_buffer, 3));
+    REQUIRE_FALSE(link32::open(fr_buffer, n));
+
+    // a length field claiming more than the buffer holds
+    fr_buffer[2] = std::byte{0xFF};
+    REQUIRE_FALSE(crc16_link::open(fr_buffer, n));
+}
+
+TEST_CASE("no_checksum frames carry no trailer") {
+    REQUIRE(bare::serialize(std::uint8_t{9}).to(fr_buffer) == 5);
+    auto payload = bare::open(fr_buffer, 5);
+    REQUIRE(payload);
+    REQUIRE(payload->to<std::uint8_t>() == 9);
+}
+
+TEST_CASE("a frame with a bounded field has the length of the values written") {
+    const eser::utils::bounded_vector<std::uint16_t, 32> samples{1, 2, 3};
+    const std::size_t n = crc16_link::serialize(std::uint8_t{1}, samples).to(fr_buffer);
+    REQUIRE(n == 6 + 1 + 1 + 6);
+    auto payload = crc16_link::open(fr_buffer, n);
+    REQUIRE(payload);
+    auto fields = payload->to<std::tuple<std::uint8_t, eser::utils::bounded_vector<std::uint16_t, 32>>>();
+    REQUIRE(fields);
+    REQUIRE(std::get<1>(*fields) == samples);
+}
+
+TEST_CASE("frames written into a split sink match the contiguous frame") {
+    std::byte expected[32]{};
+    const std::size_t total = link32::serialize(std::uint32_t{0xCAFE}, std::uint16_t{3}, -4.0f).to(expected);
+    for (std::size_t split = 0; split <= total; ++split) {
+        std::byte a[32]{}, b[32]{};
+        chunk regions[] = { {a, split}, {b, total - split} };
+        chunk_sink out(regions);
+        REQUIRE(link32::serialize(std::uint32_t{0xCAFE}, std::uint16_t{3}, -4.0f).to(out) == total);
+        REQUIRE(std::memcmp(a, expected, split) == 0);
+        REQUIRE(std::memcmp(b, expected + split, total - split) == 0);
+    }
+}
+
+TEST_CASE("read decodes a frame from a source and checks it in the same pass") {
+    std::byte wire[64]{};
+    const std::size_t one = crc16_link::serialize(std::uint32_t{1}, std::uint16_t{2}, 3.0f).to(wire);
+    const std::size_t two = crc16_link::serialize(std::uint32_t{4}, std::uint16_t{5}, 6.0f).to(wire + one, sizeof(wire) - one);
+    for (std::size_t split = 1; split < one + two; split += 3) {
+        const_chunk regions[] = { {wire, split}, {wire + split, one + two - split} };
+        chunk_source in(regions);
+        auto first = crc16_link::read<message>(in);
+        REQUIRE(first);
+        REQUIRE(std::get<2>(*first) == 3.0f);
+        auto second = crc16_link::read<message>(in);
+        REQUIRE(second);
+        REQUIRE(std::get<0>(*second) == 4);
+        REQUIRE_FALSE(crc16_link::read<message>(in));
+    }
+
+    wire[5] ^= std::byte{1};
+    span_source corrupt(wire, one + two);
+    REQUIRE_FALSE(crc16_link::read<message>(corrupt));
+    REQUIRE(corrupt.available() == two);   // the corrupt frame is consumed, the next one is intact
+    REQUIRE(crc16_link::read<message>(corrupt));
+
+    span_source wrong_size(wire + one, two);
+    REQUIRE_FALSE((crc16_link::read<std::tuple<std::uint32_t>>(wrong_size)));
+}
+
+#ifdef NDEBUG
+TEST_CASE("a frame that does not fit writes nothing") {
+    std::byte small[8];
+    REQUIRE(crc16_link::serialize(std::uint32_t{1}, std::uint16_t{2}, 3.0f).to(small) == 0);
+}
+#endif
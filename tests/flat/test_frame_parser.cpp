@@ -0,0 +1,130 @@
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include "eser/flat/flat.hpp"
+
+using namespace eser::flat;
+
+namespace {
+    using crc16_link = frame<crc16_ccitt, endianness::big>;
+    using link32 = frame<crc32c, endianness::little, 0x7E7E>;
+    using bare = frame<no_checksum, endianness::little>;
+    using message = std::tuple<std::uint32_t, std::uint16_t, float>;
+
+    std::byte fp_buffer[256];
+
+    template<typename Frame>
+    std::size_t write_message(std::byte *out, std::uint32_t id) {
+        return Frame::serialize(id, std::uint16_t{7}, 1.5f).to(out, 64);
+    }
+}
+
+TEST_CASE("frame_parser assembles a frame fed one byte at a time") {
+    static frame_parser<crc16_link, 64> parser;
+    parser.reset();
+    const std::size_t n = write_message<crc16_link>(fp_buffer, 42);
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        REQUIRE(parser.feed(fp_buffer + i, 1) == 1);
+        REQUIRE_FALSE(parser.ready());
+    }
+    REQUIRE(parser.feed(fp_buffer + n - 1, 1) == 1);
+    REQUIRE(parser.ready());
+    auto payload = parser.payload();
+    REQUIRE(payload);
+    auto m = parser.take<message>();
+    REQUIRE(m);
+    REQUIRE(std::get<0>(*m) == 42);
+    REQUIRE(std::get<2>(*m) == 1.5f);
+    REQUIRE_FALSE(parser.ready());
+    REQUIRE(parser.discarded() == 0);
+}
+
+TEST_CASE("frame_parser gives the same result at every split point") {
+    static frame_parser<link32, 64> parser;
+    const std::size_t n = write_message<link32>(fp_buffer, 9);
+    for (std::size_t split = 0; split <= n; ++split) {
+        parser.reset();
+        REQUIRE(parser.feed(fp_buffer, split) == split);
+        REQUIRE(parser.feed(fp_buffer + split, n - split) == n - split);
+        auto m = parser.take<message>();
+        REQUIRE(m);
+        REQUIRE(std::get<0>(*m) == 9);
+    }
+}
+
+TEST_CASE("frame_parser skips noise before the sync word and counts it") {
+    static frame_parser<crc16_link, 64> parser;
+    parser.reset();
+    const std::byte noise[] = {std::byte{0x00}, std::byte{0xEB}, std::byte{0x12}, std::byte{0xEB}, std::byte{0xEB}};
+    std::memcpy(fp_buffer, noise, sizeof(noise));
+    const std::size_t n = sizeof(noise) + write_message<crc16_link>(fp_buffer + sizeof(noise), 5);
+    REQUIRE(parser.feed(fp_buffer, n) == n);
+    REQUIRE(parser.ready());
+    REQUIRE(parser.discarded() == sizeof(noise));
+    REQUIRE(std::get<0>(*parser.take<message>()) == 5);
+}
+
+TEST_CASE("frame_parser drops a corrupt frame and recovers on the next one") {
+    static frame_parser<crc16_link, 64> parser;
+    const std::size_t a = write_message<crc16_link>(fp_buffer, 1);
+    const std::size_t b = write_message<crc16_link>(fp_buffer + a, 2);
+    for (std::size_t i = crc16_link::header_size; i < a; ++i) {   // every payload and checksum byte
+        parser.reset();
+        fp_buffer[i] ^= std::byte{0x01};
+        const std::size_t used = parser.feed(fp_buffer, a + b);
+        fp_buffer[i] ^= std::byte{0x01};
+        REQUIRE(parser.ready());
+        REQUIRE(used == a + b);
+        REQUIRE(parser.discarded() == a);
+        REQUIRE(std::get<0>(*parser.take<message>()) == 2);
+    }
+}
+
+TEST_CASE("frame_parser rejects a length above MaxPayload without buffering it") {
+    static frame_parser<crc16_link, 8> parser;
+    parser.reset();
+    const std::size_t a = crc16_link::serialize(std::uint64_t{1}, std::uint16_t{2}).to(fp_buffer, 64);
+    const std::size_t b = crc16_link::serialize(std::uint32_t{3}).to(fp_buffer + a, 64);
+    REQUIRE(parser.feed(fp_buffer, a + b) == a + b);
+    REQUIRE(parser.ready());
+    REQUIRE(parser.discarded() == a);
+    REQUIRE(std::get<0>(*parser.take<std::tuple<std::uint32_t>>()) == 3);
+}
+
+TEST_CASE("feed stops after a frame and consumes nothing while it is pending") {
+    static frame_parser<crc16_link, 64> parser;
+    parser.reset();
+    const std::size_t a = write_message<crc16_link>(fp_buffer, 10);
+    const std::size_t b = write_message<crc16_link>(fp_buffer + a, 11);
+    REQUIRE(parser.feed(fp_buffer, a + b) == a);
+    REQUIRE(parser.feed(fp_buffer + a, b) == 0);
+    REQUIRE(std::get<0>(*parser.payload()->to<message>()) == 10);
+    parser.release();
+    REQUIRE(parser.feed(fp_buffer + a, b) == b);
+    REQUIRE(std::get<0>(*parser.take<message>()) == 11);
+    REQUIRE_FALSE(parser.take<message>());
+    REQUIRE_FALSE(parser.payload());
+}
+
+TEST_CASE("take releases a frame whose payload is too short for the tuple") {
+    static frame_parser<crc16_link, 64> parser;
+    parser.reset();
+    const std::size_t n = crc16_link::serialize(std::uint16_t{1}).to(fp_buffer, 64);
+    REQUIRE(parser.feed(fp_buffer, n) == n);
+    REQUIRE_FALSE(parser.take<message>());
+    REQUIRE_FALSE(parser.ready());
+}
+
+TEST_CASE("frame_parser handles frames without a checksum and legacy buffers") {
+    static frame_parser<bare, 64> parser;
+    parser.reset();
+    std::uint8_t legacy[64];
+    const std::size_t n = bare::serialize(std::uint32_t{77}, std::uint16_t{7}, 2.0f).to(legacy, sizeof(legacy));
+    REQUIRE(n == 4 + 10);
+    REQUIRE(parser.feed(legacy, n) == n);
+    auto m = parser.take<message>();
+    REQUIRE(m);
+    REQUIRE(std::get<0>(*m) == 77);
+    REQUIRE(std::get<2>(*m) == 2.0f);
+}
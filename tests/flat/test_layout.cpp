@@ -0,0 +1,69 @@
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <array>
+#include <tuple>
+#include "eser/flat/serializer.hpp"
+#include "eser/flat/deserializer.hpp"
+#include "eser/flat/layout.hpp"
+#include "eser/utils/fixed_string.hpp"
+
+using namespace eser::flat;
+using eser::utils::fixed_string;
+
+enum class kind : std::uint8_t { ping = 1, data = 2 };
+using packet = layout<kind, std::uint16_t, std::uint32_t, fixed_string<8>, std::int16_t[3], double>;
+
+static_assert(packet::field_count() == 6);
+static_assert(packet::offset_of<0>() == 0);
+static_assert(packet::offset_of<1>() == 1);
+static_assert(packet::offset_of<2>() == 3);
+static_assert(packet::offset_of<3>() == 7);
+static_assert(packet::offset_of<4>() == 15);
+static_assert(packet::offset_of<5>() == 21);
+static_assert(packet::size_of<4>() == 6);
+static_assert(packet::size() == serialized_size_of<kind, std::uint16_t, std::uint32_t, fixed_string<8>, std::int16_t[3], double>());
+static_assert(std::is_same_v<packet::value_t<4>, std::array<std::int16_t, 3>>);
+
+static std::byte l_buffer[64];
+
+TEST_CASE("layout::get reads any field without decoding the ones before it") {
+    std::int16_t samples[3] = {-1, 2, -3};
+    serialize<endianness::big>(kind::data, std::uint16_t{0x0102}, std::uint32_t{77}, fixed_string<8>{"node"}, samples, 2.5)
+        .to(l_buffer);
+
+    REQUIRE(packet::get<0, endianness::big>(l_buffer) == kind::data);
+    REQUIRE(packet::get<2, endianness::big>(l_buffer) == 77u);
+    REQUIRE(packet::get<3, endianness::big>(l_buffer).view() == "node");
+    REQUIRE(packet::get<4, endianness::big>(l_buffer) == std::array<std::int16_t, 3>{-1, 2, -3});
+    REQUIRE(packet::get<5, endianness::big>(l_buffer) == 2.5);
+}
+
+TEST_CASE("layout::set patches one field in place") {
+    std::int16_t samples[3] = {4, 5, 6};
+    auto written = serialize(kind::ping, std::uint16_t{9}, std::uint32_t{1000}, fixed_string<8>{"a"}, samples, -1.0)
+        .to(l_buffer);
+
+    std::byte before[64];
+    std::copy(l_buffer, l_buffer + written, before);
+    packet::set<2>(l_buffer, 1001u);
+
+    for (std::size_t i = 0; i < written; ++i) {
+        const bool inside = i >= packet::offset_of<2>() && i < packet::offset_of<3>();
+        if (!inside) REQUIRE(l_buffer[i] == before[i]);
+    }
+    auto fields = deserialize(l_buffer, written)
+        .to<std::tuple<kind, std::uint16_t, std::uint32_t, fixed_string<8>, std::array<std::int16_t, 3>, double>>();
+    REQUIRE(fields);
+    REQUIRE(std::get<2>(*fields) == 1001u);
+    REQUIRE(std::get<5>(*fields) == -1.0);
+}
+
+TEST_CASE("layout::set honors the wire byte order") {
+    using header = layout<std::uint8_t, std::uint32_t>;
+    std::fill(l_buffer, l_buffer + 8, std::byte{0});
+    header::set<1, endianness::big>(l_buffer, 0x0A0B0C0Du);
+    REQUIRE(l_buffer[1] == std::byte{0x0A});
+    REQUIRE(l_buffer[4] == std::byte{0x0D});
+    REQUIRE(header::get<1, endianness::big>(l_buffer) == 0x0A0B0C0Du);
+}
@@ -0,0 +1,122 @@
+#include <catch2/catch_all.hpp>
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "eser/flat/flat.hpp"
+
+using namespace eser::flat;
+
+namespace {
+    using sample = std::tuple<std::uint32_t, std::uint32_t, float>;   // producer, sequence, value
+}
+
+TEST_CASE("message_queue slot size and layout") {
+    using queue = spsc_queue<8, std::uint32_t, std::uint32_t, float>;
+    STATIC_REQUIRE(queue::slot_size == 12);
+    STATIC_REQUIRE(queue::capacity() == 8);
+    STATIC_REQUIRE(alignof(queue) == queue::cache_line);
+    STATIC_REQUIRE(mpsc_queue<4, std::uint64_t>::producers == queue_producers::multiple);
+}
+
+TEST_CASE("spsc_queue serializes into slots and decodes in place, in order") {
+    static spsc_queue<4, std::uint32_t, std::uint32_t, float> queue;
+    REQUIRE(queue.empty());
+    REQUIRE_FALSE(queue.try_pop<sample>());
+
+    for (std::uint32_t i = 0; i < 4; ++i) REQUIRE(queue.try_push(serialize(std::uint32_t{0}, i, 0.5f * i)));
+    REQUIRE_FALSE(queue.try_push(serialize(std::uint32_t{0}, std::uint32_t{4}, 2.f)));   // full
+    REQUIRE_FALSE(queue.empty());
+
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        auto m = queue.try_pop<sample>();
+        REQUIRE(m);
+        REQUIRE(std::get<1>(*m) == i);
+        REQUIRE(std::get<2>(*m) == 0.5f * i);
+    }
+    REQUIRE(queue.empty());
+    REQUIRE(queue.try_push(serialize(std::uint32_t{1}, std::uint32_t{9}, 1.f)));   // wraps around
+    REQUIRE(std::get<1>(*queue.try_pop<sample>()) == 9);
+}
+
+TEST_CASE("message_queue hands the reader the slot bytes and their length") {
+    static message_queue<2, 16> queue;
+    REQUIRE(queue.try_push(serialize<endianness::big>(std::uint16_t{0x0102})));
+    std::size_t seen = 0;
+    REQUIRE(queue.try_pop([&seen](const std::byte *data, std::size_t size){
+        seen = size;
+        REQUIRE(data[0] == std::byte{0x01});
+    }));
+    REQUIRE(seen == 2);
+
+    // a writer that gives up publishes nothing
+    REQUIRE_FALSE(queue.try_write([](std::byte *, std::size_t){ return std::size_t{0}; }));
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("mpsc_queue skips a slot whose writer gave up") {
+    static mpsc_queue<4, std::uint32_t, std::uint32_t, float> queue;
+    REQUIRE(queue.try_push(serialize(std::uint32_t{0}, std::uint32_t{1}, 1.f)));
+    REQUIRE_FALSE(queue.try_write([](std::byte *, std::size_t){ return std::size_t{0}; }));
+    REQUIRE(queue.try_push(serialize(std::uint32_t{0}, std::uint32_t{2}, 2.f)));
+    REQUIRE(std::get<1>(*queue.try_pop<sample>()) == 1);
+    REQUIRE(std::get<1>(*queue.try_pop<sample>()) == 2);
+    REQUIRE_FALSE(queue.try_pop<sample>());
+    REQUIRE(queue.empty());
+
+    for (std::uint32_t i = 0; i < 4; ++i) REQUIRE(queue.try_push(serialize(std::uint32_t{0}, i, 0.f)));
+    REQUIRE_FALSE(queue.try_push(serialize(std::uint32_t{0}, std::uint32_t{4}, 0.f)));
+}
+
+TEST_CASE("spsc_queue delivers every message across threads in order") {
+    static spsc_queue<64, std::uint32_t, std::uint32_t, float> queue;
+    constexpr std::uint32_t count = 20000;
+    std::thread producer([]{
+        for (std::uint32_t i = 0; i < count; ++i)
+            while (not queue.try_push(serialize(std::uint32_t{0}, i, static_cast<float>(i)))) std::this_thread::yield();
+    });
+    std::uint32_t expected = 0;
+    bool ordered = true;
+    while (expected < count) {
+        if (auto m = queue.try_pop<sample>()) {
+            ordered = ordered and std::get<1>(*m) == expected and std::get<2>(*m) == static_cast<float>(expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    REQUIRE(ordered);
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("mpsc_queue delivers every message of every producer in per-producer order") {
+    static mpsc_queue<64, std::uint32_t, std::uint32_t, float> queue;
+    constexpr std::uint32_t producers = 4;
+    constexpr std::uint32_t count = 5000;
+    std::vector<std::thread> threads;
+    for (std::uint32_t p = 0; p < producers; ++p) {
+        threads.emplace_back([p]{
+            for (std::uint32_t i = 0; i < count; ++i)
+                while (not queue.try_push(serialize(p, i, 1.f))) std::this_thread::yield();
+        });
+    }
+    std::array<std::uint32_t, producers> next{};
+    std::uint32_t received = 0;
+    bool ordered = true;
+    while (received < producers * count) {
+        if (auto m = queue.try_pop<sample>()) {
+            auto &[producer, sequence, value] = *m;
+            ordered = ordered and producer < producers and sequence == next[producer] and value == 1.f;
+            if (producer < producers) ++next[producer];
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    for (auto &t : threads) t.join();
+    REQUIRE(ordered);
+    REQUIRE(queue.empty());
+    for (std::uint32_t n : next) REQUIRE(n == count);
+}
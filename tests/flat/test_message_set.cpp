@@ -0,0 +1,98 @@
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <tuple>
+#include "eser/flat/flat.hpp"
+
+using namespace eser::flat;
+
+namespace {
+    using ping = message_type<0x01, std::uint32_t>;
+    using telemetry = message_type<0x02, std::uint32_t, float, float>;
+    using status = message_type<0x04, std::uint32_t>;              // same fields as ping
+    using shutdown = message_type<0x07>;
+    using protocol = message_set<std::uint8_t, ping, telemetry, status, shutdown>;
+
+    enum class command : std::uint16_t { open = 0x100, close = 0x101, seek = 0x108 };
+    using open_cmd = message_type<command::open, std::uint8_t>;
+    using seek_cmd = message_type<command::seek, std::uint64_t>;
+    using commands = message_set<command, open_cmd, seek_cmd>;
+
+    struct recorder{
+        int last = 0;
+        std::uint32_t value = 0;
+        float lat = 0;
+
+        void operator()(ping, std::uint32_t seq) { last = ping::id, value = seq; }
+        void operator()(telemetry, std::uint32_t t, float la, float) { last = telemetry::id, value = t, lat = la; }
+        void operator()(status, std::uint32_t code) { last = status::id, value = code; }
+        void operator()(shutdown) { last = shutdown::id; }
+        void operator()(open_cmd, std::uint8_t mode) { last = 1, value = mode; }
+        void operator()(seek_cmd, std::uint64_t offset) { last = 2, value = static_cast<std::uint32_t>(offset); }
+    };
+
+    std::byte ms_buffer[64];
+}
+
+static_assert(ping::size == 4 and telemetry::size == 12 and shutdown::size == 0);
+static_assert(protocol::min_id == 0x01 and protocol::max_id == 0x07);
+static_assert(protocol::max_size == 1 + 12);
+static_assert(protocol::size_of(0x02) == 13 and protocol::size_of(0x07) == 1);
+static_assert(protocol::contains(0x04) and not protocol::contains(0x03) and not protocol::contains(0x08) and not protocol::contains(0x00));
+static_assert(commands::size_of(command::seek) == 2 + 8 and not commands::contains(command::close));
+
+TEST_CASE("message_set dispatches each id to its handler overload") {
+    recorder r;
+    std::size_t n = serialize(std::uint8_t{telemetry::id}, std::uint32_t{99}, 1.5f, 2.5f).to(ms_buffer);
+    REQUIRE(protocol::dispatch(ms_buffer, n, r) == n);
+    REQUIRE(r.last == telemetry::id);
+    REQUIRE(r.value == 99);
+    REQUIRE(r.lat == 1.5f);
+
+    n = serialize(std::uint8_t{status::id}, std::uint32_t{5}).to(ms_buffer);
+    REQUIRE(protocol::dispatch(ms_buffer, n, r) == 5);
+    REQUIRE(r.last == status::id);
+    REQUIRE(r.value == 5);
+
+    n = serialize(std::uint8_t{shutdown::id}).to(ms_buffer);
+    REQUIRE(protocol::dispatch(ms_buffer, n, r) == 1);
+    REQUIRE(r.last == shutdown::id);
+}
+
+TEST_CASE("message_set rejects unknown ids and short buffers without calling the handler") {
+    recorder r;
+    for (std::uint8_t id : {0x00, 0x03, 0x05, 0x08, 0xFF}) {
+        serialize(id, std::uint32_t{1}, 1.0f, 1.0f).to(ms_buffer);
+        REQUIRE(protocol::dispatch(ms_buffer, 13, r) == 0);
+    }
+    const std::size_t n = serialize(std::uint8_t{ping::id}, std::uint32_t{7}).to(ms_buffer);
+    REQUIRE(protocol::dispatch(ms_buffer, n - 1, r) == 0);
+    REQUIRE(protocol::dispatch(ms_buffer, 0, r) == 0);
+    REQUIRE(r.last == 0);
+}
+
+TEST_CASE("message_set walks a buffer of back-to-back messages") {
+    recorder r;
+    std::size_t n = serialize(std::uint8_t{ping::id}, std::uint32_t{1}).to(ms_buffer);
+    n += serialize(std::uint8_t{status::id}, std::uint32_t{2}).to(ms_buffer + n, sizeof(ms_buffer) - n);
+    n += serialize(std::uint8_t{ping::id}, std::uint32_t{3}).to(ms_buffer + n, sizeof(ms_buffer) - n);
+    std::uint32_t sum = 0;
+    for (std::size_t at = 0; at < n;) {
+        const std::size_t used = protocol::dispatch(ms_buffer + at, n - at, r);
+        REQUIRE(used == 5);
+        sum += r.value;
+        at += used;
+    }
+    REQUIRE(sum == 6);
+}
+
+TEST_CASE("message_set follows the wire order of ids and payloads") {
+    recorder r;
+    std::uint8_t legacy[16];
+    const std::size_t n = serialize<endianness::big>(command::seek, std::uint64_t{0x1234}).to(legacy, sizeof(legacy));
+    REQUIRE(legacy[0] == 0x01);
+    REQUIRE(legacy[1] == 0x08);
+    REQUIRE(commands::dispatch<endianness::big>(legacy, n, r) == 10);
+    REQUIRE(r.last == 2);
+    REQUIRE(r.value == 0x1234);
+    REQUIRE(commands::dispatch<endianness::little>(legacy, n, r) == 0);   // 0x0801 is not an id
+}
@@ -0,0 +1,171 @@
+// This file plugs in its own observer. Every message type below is local to this file, so the
+// `to` instantiations that report to it are distinct from the other test files' (which use
+// null_observer) and the one-definition rule holds.
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+namespace {
+    template<typename Message>
+    struct counters {
+        static inline std::atomic<std::size_t> calls{0};
+        static inline std::atomic<std::size_t> bytes{0};
+        static inline std::atomic<std::size_t> failures{0};
+    };
+
+    struct test_observer {
+        using stamp = std::uint64_t;
+        static inline std::uint64_t clock = 100;
+        static inline std::uint64_t last_elapsed = 0;
+
+        static stamp start() noexcept { return clock; }
+
+        template<typename Message>
+        static void encoded(const stamp &t0, std::size_t bytes) noexcept {
+            counters<Message>::calls.fetch_add(1, std::memory_order_relaxed);
+            counters<Message>::bytes.fetch_add(bytes, std::memory_order_relaxed);
+            counters<Message>::failures.fetch_add(bytes == 0, std::memory_order_relaxed);
+            last_elapsed = ++clock - t0;
+        }
+
+        template<typename Message>
+        static void decoded(const stamp &t0, std::size_t bytes) noexcept {
+            encoded<Message>(t0, bytes);
+        }
+    };
+}
+
+#define ESER_OBSERVER test_observer
+#include <catch2/catch_all.hpp>
+#include "eser/flat/flat.hpp"
+
+using namespace eser::flat;
+using eser::utils::bounded_vector;
+
+namespace {
+    enum class channel : std::uint8_t { left = 1, right = 2 };
+
+    struct reading {
+        std::uint16_t sensor;
+        float value;
+    };
+
+    using pair = std::tuple<channel, reading>;
+    using samples = bounded_vector<channel, 4>;
+
+    template<typename Message>
+    void reset() {
+        counters<Message>::calls = 0;
+        counters<Message>::bytes = 0;
+        counters<Message>::failures = 0;
+    }
+}
+
+TEST_CASE("the active observer is the one named by ESER_OBSERVER") {
+    STATIC_REQUIRE(std::is_same_v<active_observer, test_observer>);
+    STATIC_REQUIRE(std::is_same_v<details::observed_message_t<channel &>, channel>);
+    STATIC_REQUIRE(std::is_same_v<details::observed_message_t<const channel &, reading>, pair>);
+    STATIC_REQUIRE(std::is_same_v<details::observed_message_t<channel (&)[3]>, std::array<channel, 3>>);
+}
+
+TEST_CASE("serializer::to reports the message type, its size and the start stamp") {
+    reset<pair>();
+    std::byte buffer[16];
+    const channel c = channel::left;
+    REQUIRE(serialize(c, reading{7, 1.5f}).to(buffer) == 1 + sizeof(reading));
+    REQUIRE(counters<pair>::calls == 1);
+    REQUIRE(counters<pair>::bytes == 1 + sizeof(reading));
+    REQUIRE(counters<pair>::failures == 0);
+    REQUIRE(test_observer::last_elapsed == 1);
+
+    span_sink sink(buffer, sizeof(buffer));
+    REQUIRE(serialize(channel::right, reading{8, 2.f}).to(sink) == 1 + sizeof(reading));
+    REQUIRE(counters<pair>::calls == 2);
+}
+
+TEST_CASE("deserializer::to reports the same message type, the bytes consumed and failures") {
+    reset<pair>();
+    reset<channel>();
+    std::byte buffer[16];
+    const std::size_t n = serialize(channel::right, reading{3, 0.25f}).to(buffer);
+    reset<pair>();
+
+    auto d = deserialize(buffer, n);
+    REQUIRE(d.to<pair>());
+    REQUIRE(counters<pair>::calls == 1);
+    REQUIRE(counters<pair>::bytes == n);
+    REQUIRE(counters<pair>::failures == 0);
+
+    REQUIRE_FALSE(d.to<pair>());          // nothing left
+    REQUIRE_FALSE(d.to<channel>());
+    REQUIRE(counters<pair>::failures == 1);
+    REQUIRE(counters<channel>::calls == 1);
+    REQUIRE(counters<channel>::failures == 1);
+    REQUIRE(counters<channel>::bytes == 0);
+}
+
+TEST_CASE("bounded reads report their wire size, and a rejected prefix as a failure") {
+    reset<samples>();
+    std::byte buffer[16];
+    samples in;
+    in.push_back(channel::left);
+    in.push_back(channel::right);
+    const std::size_t n = serialize(in).to(buffer);
+    REQUIRE(counters<samples>::bytes == n);
+
+    REQUIRE(deserialize(buffer, n).to<samples>());
+    REQUIRE(counters<samples>::bytes == 2 * n);
+    REQUIRE_FALSE(deserialize(buffer, n - 1).to<samples>());
+    REQUIRE(counters<samples>::calls == 3);
+    REQUIRE(counters<samples>::failures == 1);
+}
+
+#ifdef NDEBUG
+TEST_CASE("a buffer too small for the message is reported as a zero-byte encode") {
+    reset<reading>();
+    std::byte buffer[2];
+    REQUIRE(serialize(reading{1, 1.f}).to(buffer) == 0);
+    REQUIRE(counters<reading>::calls == 1);
+    REQUIRE(counters<reading>::failures == 1);
+}
+#endif
+
+TEST_CASE("sink writes and source reads report the same message type") {
+    reset<pair>();
+    reset<reading>();
+    std::byte buffer[16];
+    span_sink sink(buffer, sizeof(buffer));
+    REQUIRE(serialize(channel::left, reading{5, 0.5f}).to(sink) == 1 + sizeof(reading));
+
+    span_source source(buffer, sink.written());
+    auto d = deserialize(source);
+    REQUIRE(d.to<pair>());
+    REQUIRE(counters<pair>::calls == 2);
+    REQUIRE(counters<pair>::bytes == 2 * (1 + sizeof(reading)));
+    REQUIRE(counters<pair>::failures == 0);
+
+    REQUIRE_FALSE(d.to<pair>());          // the source is drained
+    REQUIRE_FALSE(d.to<reading>());
+    REQUIRE(counters<pair>::failures == 1);
+    REQUIRE(counters<reading>::failures == 1);
+}
+
+TEST_CASE("a frame reports its payload message, not its envelope words") {
+    using link = frame<crc32c, endianness::little, 0x7E7E>;
+    reset<pair>();
+    reset<std::uint16_t>();
+    reset<std::uint32_t>();
+    std::byte buffer[32];
+    const std::size_t n = link::serialize(channel::right, reading{9, 4.f}).to(buffer);
+    REQUIRE(n == link::overhead + 1 + sizeof(reading));
+    REQUIRE(counters<pair>::calls == 1);
+    REQUIRE(counters<pair>::bytes == 1 + sizeof(reading));
+
+    span_source source(buffer, n);
+    REQUIRE(link::read<pair>(source));
+    REQUIRE(counters<pair>::calls == 2);
+    REQUIRE(counters<pair>::bytes == 2 * (1 + sizeof(reading)));
+    REQUIRE(counters<std::uint16_t>::calls == 0);   // the sync and length words
+    REQUIRE(counters<std::uint32_t>::calls == 0);   // the CRC
+}
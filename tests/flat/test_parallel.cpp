@@ -0,0 +1,130 @@
+#include <catch2/catch_all.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+#include "eser/flat/flat.hpp"
+
+using namespace eser::flat;
+
+namespace {
+    struct sample {
+        std::uint32_t id;
+        float value;
+    };
+
+    // counts the parts it is asked to run, running them in order
+    struct counting_executor {
+        std::size_t threads;
+        std::size_t *runs;
+        std::size_t concurrency() const { return threads; }
+        template<typename Job>
+        void run(std::size_t parts, const Job &job) const {
+            *runs = parts;
+            for (std::size_t part = 0; part < parts; ++part) job(part);
+        }
+    };
+}
+
+TEST_CASE("batch_parts splits only above the threshold, up to the concurrency") {
+    STATIC_REQUIRE(details::batch_parts(100, 4, 8, 1024) == 1);          // 400 bytes
+    STATIC_REQUIRE(details::batch_parts(1024, 4, 8, 1024) == 4);         // 4 KiB in 1 KiB parts
+    STATIC_REQUIRE(details::batch_parts(1 << 20, 4, 8, 1024) == 8);      // capped by concurrency
+    STATIC_REQUIRE(details::batch_parts(1 << 20, 4, 1, 1024) == 1);
+    STATIC_REQUIRE(details::batch_parts(0, 4, 8, 1024) == 1);
+    STATIC_REQUIRE(details::batch_parts(10, 3, 8, 8) == 3);              // 3 records make 8 bytes
+    STATIC_REQUIRE(inline_executor::concurrency() == 1);
+}
+
+TEST_CASE("an executor splits a large range into parts that write the sequential bytes") {
+    std::vector<std::uint32_t> records(10007);
+    for (std::size_t i = 0; i < records.size(); ++i) records[i] = static_cast<std::uint32_t>(i * 2654435761u);
+    const std::size_t size = records.size() * sizeof(std::uint32_t);
+
+    std::vector<std::byte> sequential(size), parallel(size);
+    REQUIRE(serialize_range<endianness::big>(records).to(sequential.data(), size) == size);
+
+    std::size_t runs = 0;
+    counting_executor executor{4, &runs};
+    REQUIRE(serialize_range<endianness::big>(records).to<1024>(parallel.data(), size, executor) == size);
+    REQUIRE(runs == 4);
+    REQUIRE(sequential == parallel);
+
+    std::vector<std::uint32_t> decoded(records.size());
+    auto d = deserialize<endianness::big>(parallel.data(), size);
+    REQUIRE(d.to_range<std::uint32_t, 1024>(decoded.data(), decoded.size(), executor));
+    REQUIRE(decoded == records);
+    REQUIRE_FALSE(d.to<std::uint8_t>());   // the cursor consumed the whole batch
+}
+
+TEST_CASE("a small batch or an inline executor takes the single-threaded path") {
+    std::uint16_t records[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    std::byte buffer[sizeof(records)];
+    std::size_t runs = 0;
+    counting_executor executor{8, &runs};
+    REQUIRE(serialize_range(records).to(buffer, sizeof(buffer), executor) == sizeof(records));
+    REQUIRE(runs == 0);
+
+    std::uint16_t decoded[8] = {};
+    inline_executor serial;
+    REQUIRE(deserialize(buffer).to_range<std::uint16_t, 4>(decoded, 8, serial));
+    REQUIRE(std::equal(decoded, decoded + 8, records));
+}
+
+TEST_CASE("the executor overloads keep the capacity contracts") {
+    std::byte buffer[64] = {};
+    std::size_t runs = 0;
+    counting_executor executor{4, &runs};
+#ifdef NDEBUG
+    std::uint32_t records[64] = {};
+    REQUIRE(serialize_range(records).to<16>(buffer, sizeof(buffer), executor) == 0);
+#endif
+    std::uint32_t decoded[64] = {};
+    auto d = deserialize(buffer);
+    REQUIRE_FALSE(d.to_range<std::uint32_t, 16>(decoded, 64, executor));
+    REQUIRE(runs == 0);
+    REQUIRE(d.to_range<std::uint32_t, 16>(decoded, 16, executor));   // the failed read consumed nothing
+    REQUIRE(runs == 4);
+}
+
+#if defined(ESER_HAS_THREADS)
+TEST_CASE("thread_executor runs every part exactly once") {
+    thread_executor pool(4);
+    REQUIRE(pool.concurrency() == 4);
+    REQUIRE(thread_executor(1000).concurrency() == thread_executor::max_threads);
+    REQUIRE(thread_executor().concurrency() >= 1);
+
+    std::atomic<std::size_t> seen[10] = {};
+    pool.run(10, [&seen](std::size_t part){ seen[part].fetch_add(1, std::memory_order_relaxed); });
+    for (auto &count : seen) REQUIRE(count.load() == 1);
+}
+
+TEST_CASE("thread_executor round-trips a large batch of structs on both wires") {
+    std::vector<sample> records(50000);
+    for (std::uint32_t i = 0; i < records.size(); ++i) records[i] = {i, i * 0.25f};
+    const std::size_t size = records.size() * sizeof(sample);
+    thread_executor pool(4);
+
+    std::vector<std::byte> sequential(size), parallel(size);
+    REQUIRE(serialize_range(records).to(sequential.data(), size) == size);
+    REQUIRE(serialize_range(records).to<4096>(parallel.data(), size, pool) == size);
+    REQUIRE(sequential == parallel);
+
+    std::vector<sample> decoded(records.size());
+    REQUIRE(deserialize(parallel.data(), size).to_range<sample, 4096>(decoded.data(), decoded.size(), pool));
+    bool same = true;
+    for (std::size_t i = 0; i < records.size(); ++i)
+        same = same and decoded[i].id == records[i].id and decoded[i].value == records[i].value;
+    REQUIRE(same);
+
+    std::vector<std::uint64_t> wide(40000);
+    for (std::size_t i = 0; i < wide.size(); ++i) wide[i] = 0x0102030405060708ull * i;
+    std::vector<std::byte> big(wide.size() * 8), big_sequential(wide.size() * 8);
+    REQUIRE(serialize_range<endianness::big>(wide).to<4096>(big.data(), big.size(), pool) == big.size());
+    REQUIRE(serialize_range<endianness::big>(wide).to(big_sequential.data(), big_sequential.size()) == big.size());
+    REQUIRE(big == big_sequential);
+    std::vector<std::uint64_t> wide_decoded(wide.size());
+    REQUIRE(deserialize<endianness::big>(big.data(), big.size()).to_range<std::uint64_t, 4096>(wide_decoded.data(), wide_decoded.size(), pool));
+    REQUIRE(wide_decoded == wide);
+}
+#endif
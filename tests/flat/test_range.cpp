@@ -0,0 +1,92 @@
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <array>
+#include <vector>
+#include "eser/flat/serializer.hpp"
+#include "eser/flat/deserializer.hpp"
+
+using namespace eser::flat;
+
+constexpr std::size_t RBUF = 256;
+static std::uint8_t r_buffer[RBUF];
+
+static void r_clear() { std::fill(r_buffer, r_buffer + RBUF, 0); }
+
+struct telemetry {
+    std::uint16_t sensor;
+    float value;
+};
+
+TEST_CASE("serialize_range writes the same bytes as one serialize() per record") {
+    r_clear();
+    std::uint32_t records[4] = {0x01020304u, 0x05060708u, 0x0A0B0C0Du, 0xDEADBEEFu};
+    std::uint8_t expected[RBUF] = {0};
+    for (int i = 0; i < 4; ++i) serialize<endianness::big>(records[i]).to(expected + 4 * i, 4);
+
+    auto written = serialize_range<endianness::big>(records).to(r_buffer);
+    REQUIRE(written == sizeof(records));
+    REQUIRE(std::equal(r_buffer, r_buffer + written, expected));
+    REQUIRE(r_buffer[0] == 0x01);
+}
+
+TEST_CASE("serialize_range / to_range round-trip a batch of structs") {
+    r_clear();
+    std::vector<telemetry> in;
+    for (std::uint16_t i = 0; i < 16; ++i) in.push_back({i, i * 0.5f});
+
+    auto written = serialize_range(in).to(r_buffer);
+    REQUIRE(written == in.size() * sizeof(telemetry));
+
+    telemetry out[16] = {};
+    auto d = deserialize(r_buffer, written);
+    REQUIRE(d.to_range(out, 16));
+    for (std::size_t i = 0; i < 16; ++i) {
+        REQUIRE(out[i].sensor == in[i].sensor);
+        REQUIRE(out[i].value == in[i].value);
+    }
+    REQUIRE_FALSE(d.to<std::uint8_t>()); // the cursor consumed the whole batch
+}
+
+TEST_CASE("big-endian to_range swaps every element") {
+    r_clear();
+    std::array<std::int16_t, 5> in = {1, -2, 300, -400, 32767};
+    serialize_range<endianness::big>(in).to(r_buffer);
+
+    std::int16_t out[5] = {};
+    REQUIRE(deserialize<endianness::big>(r_buffer).to_range(out, 5));
+    for (std::size_t i = 0; i < 5; ++i) REQUIRE(out[i] == in[i]);
+}
+
+TEST_CASE("to_range is all-or-nothing on a short buffer") {
+    r_clear();
+    std::uint32_t out[3] = {7, 7, 7};
+    auto d = deserialize(r_buffer, 3 * sizeof(std::uint32_t) - 1);
+    REQUIRE_FALSE(d.to_range(out, 3));
+    REQUIRE(out[0] == 7);
+    REQUIRE(d.to_range(out, 2)); // cursor did not move on failure
+}
+
+TEST_CASE("to_range normalizes bool records") {
+    r_clear();
+    r_buffer[0] = 0x00; r_buffer[1] = 0x02; r_buffer[2] = 0xFF;
+    bool out[3] = {};
+    REQUIRE(deserialize(r_buffer).to_range(out, 3));
+    REQUIRE(out[0] == false);
+    REQUIRE(out[1] == true);
+    REQUIRE(out[2] == true);
+}
+
+TEST_CASE("empty ranges write and read nothing") {
+    std::uint32_t* none = nullptr;
+    REQUIRE(serialize_range(none, 0).to(r_buffer) == 0);
+    REQUIRE(deserialize(r_buffer).to_range(none, 0));
+}
+
+#ifdef NDEBUG
+TEST_CASE("serialize_range into an undersized buffer writes nothing (release)") {
+    std::fill(r_buffer, r_buffer + RBUF, 0xAB);
+    std::uint32_t records[2] = {1, 2};
+    REQUIRE(serialize_range(records).to(r_buffer, 7) == 0);
+    REQUIRE(r_buffer[0] == 0xAB);
+}
+#endif
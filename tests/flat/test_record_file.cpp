@@ -0,0 +1,154 @@
+#include <catch2/catch_all.hpp>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include "eser/flat/flat.hpp"
+
+using namespace eser::flat;
+
+namespace {
+    using ticks = record_file<record_format::columns, endianness::little, std::uint64_t, float, std::uint16_t>;
+    using ticks_be = record_file<record_format::columns, endianness::big, std::uint64_t, float, std::uint16_t>;
+    using tick_rows = record_file<record_format::rows, endianness::big, std::uint64_t, float, std::uint16_t>;
+    using vectors = record_file<record_format::columns, endianness::little, std::uint32_t, std::array<float, 3>>;
+    using signed_ticks = record_file<record_format::columns, endianness::little, std::int64_t, float, std::uint16_t>;
+
+    alignas(64) std::byte rf_buffer[4096];
+
+    template<typename File>
+    void fill(std::size_t capacity, std::size_t count) {
+        auto writer = File::create(rf_buffer, sizeof(rf_buffer), capacity);
+        REQUIRE(writer);
+        for (std::size_t i = 0; i < count; ++i)
+            REQUIRE(writer->append(std::uint64_t{1000 + i}, 0.5f * static_cast<float>(i), static_cast<std::uint16_t>(i * 3)));
+    }
+}
+
+TEST_CASE("record_file sizes and column offsets") {
+    STATIC_REQUIRE(ticks::record_size == 14);
+    STATIC_REQUIRE(ticks::column_offset<0>(10) == 64);
+    STATIC_REQUIRE(ticks::column_offset<1>(10) == 64 + 128);       // 80 bytes, rounded up to 128
+    STATIC_REQUIRE(ticks::column_offset<2>(10) == 64 + 128 + 64);  // 40 bytes, rounded up to 64
+    STATIC_REQUIRE(ticks::size_for(10) == 64 + 128 + 64 + 20);
+    STATIC_REQUIRE(tick_rows::column_offset<1>(10) == 64 + 8);
+    STATIC_REQUIRE(tick_rows::size_for(10) == 64 + 140);
+    STATIC_REQUIRE(std::is_same_v<ticks::column_t<1>, column_view<endianness::little, float, 4>>);
+    STATIC_REQUIRE(std::is_same_v<tick_rows::column_t<1>, column_view<endianness::big, float, 14>>);
+}
+
+TEST_CASE("record_file writes a little-endian header") {
+    fill<ticks_be>(10, 3);
+    const std::byte expected[] = {
+        std::byte{'E'}, std::byte{'S'}, std::byte{'R'}, std::byte{'F'},
+        std::byte{2}, std::byte{1}, std::byte{1}, std::byte{3},
+        std::byte{14}, std::byte{0}, std::byte{0}, std::byte{0},
+        std::byte(ticks_be::schema), std::byte(ticks_be::schema >> 8), std::byte(ticks_be::schema >> 16), std::byte(ticks_be::schema >> 24),
+        std::byte{10}, std::byte{0}, std::byte{0}, std::byte{0}, std::byte{0}, std::byte{0}, std::byte{0}, std::byte{0},
+        std::byte{3}, std::byte{0}, std::byte{0}, std::byte{0}, std::byte{0}, std::byte{0}, std::byte{0}, std::byte{0},
+    };
+    REQUIRE(std::memcmp(rf_buffer, expected, sizeof(expected)) == 0);
+}
+
+TEST_CASE("record_file columns round-trip through zero-copy views") {
+    fill<ticks>(100, 40);
+    auto reader = ticks::open(rf_buffer, sizeof(rf_buffer));
+    REQUIRE(reader);
+    REQUIRE(reader->size() == 40);
+    REQUIRE(reader->capacity() == 100);
+
+    auto prices = reader->column<1>();
+    REQUIRE(prices.size() == 40);
+    REQUIRE(prices.data() == rf_buffer + ticks::column_offset<1>(100));
+    float total = 0;
+    for (float price : prices) total += price;
+    REQUIRE(total == 0.5f * (39 * 40 / 2));
+
+    REQUIRE(reader->column<0>()[7] == 1007);
+    REQUIRE(reader->get<2>(5) == 15);
+    REQUIRE(prices.at(39));
+    REQUIRE_FALSE(prices.at(40));
+
+    // each column holds just its own field, back to back
+    std::uint16_t volume;
+    std::memcpy(&volume, rf_buffer + ticks::column_offset<2>(100) + 2 * sizeof(volume), sizeof(volume));
+    REQUIRE(volume == 6);
+}
+
+TEST_CASE("record_file rows are what serialize writes") {
+    fill<tick_rows>(10, 4);
+    std::byte expected[14];
+    REQUIRE(serialize<endianness::big>(std::uint64_t{1002}, 1.0f, std::uint16_t{6}).to(expected) == 14);
+    REQUIRE(std::memcmp(rf_buffer + tick_rows::data_offset + 2 * 14, expected, 14) == 0);
+
+    auto reader = tick_rows::open(rf_buffer, tick_rows::size_for(10));
+    REQUIRE(reader);
+    REQUIRE(reader->column<1>()[2] == 1.0f);
+    auto row = reader->row(3);
+    REQUIRE(row);
+    REQUIRE(*row == std::make_tuple(std::uint64_t{1003}, 1.5f, std::uint16_t{9}));
+    REQUIRE_FALSE(reader->row(4));
+}
+
+TEST_CASE("record_file big-endian columns are byte-swapped on access") {
+    fill<ticks_be>(8, 8);
+    const std::byte *first = rf_buffer + ticks_be::column_offset<0>(8);
+    REQUIRE(first[7] == std::byte{0xE8});  // 1000 = 0x03E8, most significant byte first
+    REQUIRE(first[6] == std::byte{0x03});
+    auto reader = ticks_be::open(rf_buffer, sizeof(rf_buffer));
+    REQUIRE(reader);
+    std::uint64_t sum = 0;
+    for (std::uint64_t t : reader->column<0>()) sum += t;
+    REQUIRE(sum == 8 * 1000 + 28);
+}
+
+TEST_CASE("record_file array fields are columns of arrays") {
+    auto writer = vectors::create(rf_buffer, sizeof(rf_buffer), 16);
+    REQUIRE(writer);
+    REQUIRE(writer->append(std::uint32_t{1}, std::array<float, 3>{1.f, 2.f, 3.f}));
+    REQUIRE(writer->append(std::uint32_t{2}, std::array<float, 3>{4.f, 5.f, 6.f}));
+    auto reader = vectors::open(rf_buffer, sizeof(rf_buffer));
+    REQUIRE(reader);
+    REQUIRE(reader->column<1>()[1] == std::array<float, 3>{4.f, 5.f, 6.f});
+}
+
+TEST_CASE("record_writer stops at capacity and resumes after the last record") {
+    auto writer = ticks::create(rf_buffer, sizeof(rf_buffer), 2);
+    REQUIRE(writer);
+    REQUIRE(writer->append(std::uint64_t{1}, 1.f, std::uint16_t{1}));
+    REQUIRE(ticks::open(rf_buffer, sizeof(rf_buffer))->size() == 1);
+
+    auto resumed = ticks::resume(rf_buffer, sizeof(rf_buffer));
+    REQUIRE(resumed);
+    REQUIRE(resumed->size() == 1);
+    REQUIRE(resumed->append(std::uint64_t{2}, 2.f, std::uint16_t{2}));
+    REQUIRE_FALSE(resumed->append(std::uint64_t{3}, 3.f, std::uint16_t{3}));
+    REQUIRE(resumed->size() == 2);
+
+    auto reader = ticks::open(rf_buffer, sizeof(rf_buffer));
+    REQUIRE(reader);
+    REQUIRE(reader->column<0>()[1] == 2);
+}
+
+TEST_CASE("record_file rejects a buffer too small for the capacity") {
+    REQUIRE_FALSE(ticks::create(rf_buffer, ticks::size_for(100) - 1, 100));
+    REQUIRE_FALSE(ticks::create(rf_buffer, 32, 0));
+    REQUIRE(ticks::create(rf_buffer, ticks::size_for(100), 100));
+}
+
+TEST_CASE("record_file::open rejects foreign or truncated files") {
+    fill<ticks>(100, 10);
+    REQUIRE(ticks::open(rf_buffer, ticks::size_for(100)));
+    REQUIRE_FALSE(ticks::open(rf_buffer, ticks::size_for(100) - 1));
+    REQUIRE_FALSE(ticks::open(rf_buffer, 40));
+    REQUIRE_FALSE(ticks_be::open(rf_buffer, sizeof(rf_buffer)));
+    REQUIRE_FALSE(tick_rows::open(rf_buffer, sizeof(rf_buffer)));
+    REQUIRE_FALSE(vectors::open(rf_buffer, sizeof(rf_buffer)));
+    REQUIRE_FALSE(signed_ticks::open(rf_buffer, sizeof(rf_buffer)));   // same sizes, another schema
+
+    rf_buffer[24] = std::byte{101};   // count beyond capacity
+    REQUIRE_FALSE(ticks::open(rf_buffer, sizeof(rf_buffer)));
+    rf_buffer[24] = std::byte{10};
+    rf_buffer[0] = std::byte{'X'};
+    REQUIRE_FALSE(ticks::open(rf_buffer, sizeof(rf_buffer)));
+}
@@ -0,0 +1,233 @@
+#include <catch2/catch_all.hpp>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include "eser/flat/flat.hpp"
+#include "eser/utils/reflect.hpp"
+
+using namespace eser::flat;
+
+namespace {
+    struct sample{
+        std::uint8_t channel;
+        std::uint32_t value;
+        std::int16_t offset;
+    };
+    ESER_REFLECT(sample, channel, value, offset);
+
+    enum class unit : std::uint16_t { volt = 0x0102, amp = 0x0304 };
+
+    struct reading{
+        sample s;
+        unit u;
+        std::uint16_t history[3];
+        std::array<float, 2> range;
+    };
+    ESER_REFLECT(reading, s, u, history, range);
+
+    struct dense{
+        std::uint32_t a;
+        std::uint16_t b;
+        std::uint16_t c;
+    };
+    ESER_REFLECT(dense, a, b, c);
+
+    struct bytes_only{
+        std::uint8_t tag;
+        char name[3];
+    };
+    ESER_REFLECT(bytes_only, tag, name);
+
+    struct plain{ std::uint32_t x; };
+
+    std::byte rf_buffer[128];
+}
+
+using eser::utils::is_reflected_v;
+using eser::utils::reflection_t;
+using eser::internal::needs_byte_swap_v;
+
+static_assert(is_reflected_v<sample> and is_reflected_v<reading> and not is_reflected_v<plain> and not is_reflected_v<int>);
+static_assert(reflection_t<sample>::count == 3 and not reflection_t<sample>::padding_free);
+static_assert(reflection_t<dense>::padding_free);
+static_assert(needs_byte_swap_v<endianness::big, sample> != needs_byte_swap_v<endianness::little, sample>);
+static_assert(not needs_byte_swap_v<endianness::big, bytes_only> and not needs_byte_swap_v<endianness::little, bytes_only>);
+static_assert(serialized_size_of<sample>() == sizeof(sample));
+
+TEST_CASE("a described struct keeps its layout and swaps each member on a big-endian wire") {
+    std::memset(rf_buffer, 0xAB, sizeof(rf_buffer));
+    const sample s{0x11, 0x01020304, -2};
+    REQUIRE(serialize<endianness::big>(s).to(rf_buffer) == sizeof(sample));
+    const std::uint8_t expected[12] = {0x11, 0, 0, 0, 0x01, 0x02, 0x03, 0x04, 0xFF, 0xFE, 0, 0};
+    REQUIRE(std::memcmp(rf_buffer, expected, sizeof(expected)) == 0);   // padding written as zero
+    REQUIRE(rf_buffer[12] == std::byte{0xAB});
+
+    auto back = deserialize<endianness::big>(rf_buffer).to<sample>();
+    REQUIRE(back);
+    REQUIRE(back->channel == 0x11);
+    REQUIRE(back->value == 0x01020304);
+    REQUIRE(back->offset == -2);
+}
+
+TEST_CASE("the two wire orders of a described struct are byte-reversed member by member") {
+    const dense d{0x0A0B0C0D, 0x1122, 0x3344};
+    std::byte little[8], big[8];
+    serialize<endianness::little>(d).to(little);
+    serialize<endianness::big>(d).to(big);
+    for (std::size_t i = 0; i < 4; ++i) REQUIRE(little[i] == big[3 - i]);
+    REQUIRE((little[4] == big[5] and little[5] == big[4]));
+    REQUIRE((little[6] == big[7] and little[7] == big[6]));
+}
+
+TEST_CASE("nested described structs, enums and array members round-trip on both wires") {
+    const reading r{{3, 0xDEADBEEF, -300}, unit::amp, {1, 0x0203, 0xFFFF}, {1.5f, -2.25f}};
+    for (int pass = 0; pass < 2; ++pass) {
+        const std::size_t n = pass == 0 ? serialize<endianness::big>(r).to(rf_buffer) : serialize<endianness::little>(r).to(rf_buffer);
+        REQUIRE(n == sizeof(reading));
+        auto back = pass == 0 ? deserialize<endianness::big>(rf_buffer).to<reading>() : deserialize<endianness::little>(rf_buffer).to<reading>();
+        REQUIRE(back);
+        REQUIRE(back->s.value == 0xDEADBEEF);
+        REQUIRE(back->s.offset == -300);
+        REQUIRE(back->u == unit::amp);
+        REQUIRE(back->history[1] == 0x0203);
+        REQUIRE(back->history[2] == 0xFFFF);
+        REQUIRE(back->range[1] == -2.25f);
+    }
+}
+
+TEST_CASE("a described struct on the host wire is its object representation") {
+    const dense d{1, 2, 3};
+    serialize<eser::internal::host_endianness>(d).to(rf_buffer);
+    REQUIRE(std::memcmp(rf_buffer, &d, sizeof(d)) == 0);
+    const bytes_only b{7, {'a', 'b', 'c'}};
+    serialize<endianness::big>(b).to(rf_buffer);
+    REQUIRE(std::memcmp(rf_buffer, &b, sizeof(b)) == 0);
+}
+
+TEST_CASE("ranges, tuples and split sources of described structs on a big-endian wire") {
+    const sample in[4] = {{1, 10, -1}, {2, 20, -2}, {3, 30, -3}, {4, 40, -4}};
+    REQUIRE(serialize_range<endianness::big>(in, 4).to(rf_buffer) == 4 * sizeof(sample));
+    sample out[4] = {};
+    REQUIRE(deserialize<endianness::big>(rf_buffer).to_range(out, 4));
+    for (std::size_t i = 0; i < 4; ++i) REQUIRE((out[i].channel == in[i].channel and out[i].value == in[i].value and out[i].offset == in[i].offset));
+
+    const std::size_t n = serialize<endianness::big>(std::uint8_t{9}, in[2]).to(rf_buffer);
+    for (std::size_t split = 0; split <= n; ++split) {
+        const_chunk regions[] = { {rf_buffer, split}, {rf_buffer + split, n - split} };
+        chunk_source source(regions);
+        auto fields = deserialize<endianness::big>(source).to<std::tuple<std::uint8_t, sample>>();
+        REQUIRE(fields);
+        REQUIRE(std::get<1>(*fields).value == 30);
+        REQUIRE(std::get<1>(*fields).offset == -3);
+    }
+}
+
+namespace {
+    struct record{
+        std::uint8_t kind;
+        std::uint32_t stamp;
+        std::uint8_t level;
+    };
+    ESER_REFLECT_PACKED(record, kind, stamp, level);
+
+    struct tight{
+        std::uint16_t a;
+        std::uint16_t b;
+        std::uint32_t c;
+    };
+    ESER_REFLECT_PACKED(tight, a, b, c);
+
+    struct reordered{
+        std::uint16_t a;
+        std::uint16_t b;
+    };
+    ESER_REFLECT_PACKED(reordered, b, a);
+
+    struct outer{
+        std::uint8_t tag;
+        record inner[2];
+        sample image;
+        std::array<record, 2> more;
+        bool flag;
+    };
+    ESER_REFLECT_PACKED(outer, tag, inner, image, more, flag);
+}
+
+static_assert(eser::utils::is_packed_v<record> and not eser::utils::is_packed_v<sample>);
+static_assert(sizeof(record) == 12 and serialized_size_of<record>() == 6);
+static_assert(serialized_size_of<record, std::uint16_t>() == 8);
+static_assert(serialized_size_of<record[3]>() == 18 and serialized_size_of<std::array<record, 3>>() == 18);
+static_assert(serialized_size_of<outer>() == 1 + 12 + sizeof(sample) + 12 + 1);
+static_assert(needs_byte_swap_v<eser::internal::host_endianness, record>);   // padding must be dropped
+static_assert(not needs_byte_swap_v<eser::internal::host_endianness, tight>);
+static_assert(needs_byte_swap_v<eser::internal::host_endianness, reordered>);
+
+TEST_CASE("a packed struct writes only its members, back to back") {
+    std::memset(rf_buffer, 0xAB, sizeof(rf_buffer));
+    const record r{7, 0x01020304, 9};
+    REQUIRE(serialize<endianness::big>(r, std::uint8_t{0xEE}).to(rf_buffer) == 7);
+    const std::uint8_t expected[7] = {7, 0x01, 0x02, 0x03, 0x04, 9, 0xEE};
+    REQUIRE(std::memcmp(rf_buffer, expected, sizeof(expected)) == 0);
+    REQUIRE(rf_buffer[7] == std::byte{0xAB});
+
+    serialize<endianness::little>(r).to(rf_buffer);
+    const std::uint8_t little[6] = {7, 0x04, 0x03, 0x02, 0x01, 9};
+    REQUIRE(std::memcmp(rf_buffer, little, sizeof(little)) == 0);
+
+    auto back = deserialize<endianness::little>(rf_buffer, 6).to<record>();
+    REQUIRE(back);
+    REQUIRE((back->kind == 7 and back->stamp == 0x01020304 and back->level == 9));
+    REQUIRE_FALSE(deserialize<endianness::little>(rf_buffer, 5).to<record>());
+}
+
+TEST_CASE("a packed struct whose members tile it is its object representation") {
+    const tight t{1, 2, 3};
+    REQUIRE(serialize<eser::internal::host_endianness>(t).to(rf_buffer) == sizeof(tight));
+    REQUIRE(std::memcmp(rf_buffer, &t, sizeof(t)) == 0);
+
+    const reordered r{0x0102, 0x0304};
+    REQUIRE(serialize<endianness::big>(r).to(rf_buffer) == 4);
+    const std::uint8_t expected[4] = {0x03, 0x04, 0x01, 0x02};
+    REQUIRE(std::memcmp(rf_buffer, expected, sizeof(expected)) == 0);
+    auto back = deserialize<endianness::big>(rf_buffer).to<reordered>();
+    REQUIRE((back and back->a == 0x0102 and back->b == 0x0304));
+}
+
+TEST_CASE("packed structs nest, and ranges, tuples and sources step by the packed size") {
+    outer o{};
+    o.tag = 1;
+    o.inner[0] = {2, 200, 3};
+    o.inner[1] = {4, 400, 5};
+    o.image = {6, 600, -6};
+    o.more[1] = {8, 800, 9};
+    o.flag = true;
+    constexpr std::size_t n = serialized_size_of<outer>();
+    REQUIRE(serialize<endianness::big>(o).to(rf_buffer) == n);
+    auto back = deserialize<endianness::big>(rf_buffer, n).to<outer>();
+    REQUIRE(back);
+    REQUIRE(back->inner[1].stamp == 400);
+    REQUIRE(back->image.offset == -6);
+    REQUIRE(back->more[1].level == 9);
+    REQUIRE(back->flag);
+
+    const record in[3] = {{1, 10, 2}, {3, 30, 4}, {5, 50, 6}};
+    REQUIRE(serialize_range(in, 3).to(rf_buffer) == 18);
+    record out[3] = {};
+    auto d = deserialize(rf_buffer, 18);
+    REQUIRE(d.to_range(out, 3));
+    REQUIRE((out[2].kind == 5 and out[2].stamp == 50 and out[2].level == 6));
+    REQUIRE_FALSE(d.to<std::uint8_t>());
+
+    const std::size_t m = serialize<endianness::big>(in[1], std::uint16_t{0xBEEF}).to(rf_buffer);
+    REQUIRE(m == 8);
+    for (std::size_t split = 0; split <= m; ++split) {
+        const_chunk regions[] = { {rf_buffer, split}, {rf_buffer + split, m - split} };
+        chunk_source source(regions);
+        auto fields = deserialize<endianness::big>(source).to<std::tuple<record, std::uint16_t>>();
+        REQUIRE(fields);
+        REQUIRE(std::get<0>(*fields).stamp == 30);
+        REQUIRE(std::get<1>(*fields) == 0xBEEF);
+        REQUIRE(source.consumed() == m);
+    }
+}
@@ -1,5 +1,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include "eser/flat/serializer.hpp"
+#include "eser/internal/endianness.hpp"
+#include <cstring>
+#include <array>
 
 using namespace eser::flat;
 
@@ -236,3 +239,82 @@ TEST_CASE("Large struct serialization near buffer limit") {
     std::size_t size = serialize(s).to(buffer);
     REQUIRE(size == sizeof(s));
 }
+
+namespace {
+    using frame_payload = std::array<std::uint8_t, 256>;
+
+    std::size_t concatenate(const const_chunk *segments, std::size_t count, std::uint8_t *out) {
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < count; ++i) {
+            std::memcpy(out + total, segments[i].data, segments[i].size);
+            total += segments[i].size;
+        }
+        return total;
+    }
+}
+
+TEST_CASE("to_segments references large native lvalues in place and copies the rest") {
+    frame_payload payload{};
+    for (std::size_t i = 0; i < payload.size(); ++i) payload[i] = static_cast<std::uint8_t>(i);
+    std::uint16_t type = 0x0102;
+    std::uint32_t sequence = 7;
+    std::uint32_t crc = 0xCAFEBABE;
+
+    const_chunk segments[3]{};
+    std::byte scratch[16]{};
+    std::size_t count = serialize<endianness::big>(type, sequence, payload, crc)
+        .to_segments(segments, 3, scratch, sizeof(scratch));
+
+    REQUIRE(count == 3);
+    REQUIRE(segments[0].data == scratch);
+    REQUIRE(segments[0].size == 6);
+    REQUIRE(segments[1].data == static_cast<const std::byte *>(static_cast<const void *>(&payload)));
+    REQUIRE(segments[1].size == sizeof(payload));
+    REQUIRE(segments[2].data == scratch + 6);
+    REQUIRE(segments[2].size == 4);
+
+    std::uint8_t gathered[BUFFER_SIZE + 100]{};
+    std::uint8_t expected[BUFFER_SIZE + 100]{};
+    std::size_t bytes = serialize<endianness::big>(type, sequence, payload, crc).to(expected, sizeof(expected));
+    REQUIRE(concatenate(segments, count, gathered) == bytes);
+    REQUIRE(std::memcmp(gathered, expected, bytes) == 0);
+}
+
+TEST_CASE("to_segments copies rvalues, swapped arrays and small fields") {
+    std::uint32_t words[32]{};
+    for (std::uint32_t i = 0; i < 32; ++i) words[i] = i * 0x01010101u;
+    std::uint8_t bytes_be[64]{};
+
+    const_chunk segments[4]{};
+    std::byte scratch[256]{};
+    // words needs swapping on a big wire; bytes_be does not, but is only referenced at >= 64 bytes
+    std::size_t count = serialize<endianness::big>(words, std::uint8_t{9}, bytes_be)
+        .to_segments(segments, 4, scratch, sizeof(scratch));
+    if constexpr (eser::internal::host_endianness == endianness::big) {
+        REQUIRE(count == 3);
+    } else {
+        REQUIRE(count == 2);
+        REQUIRE(segments[0].data == scratch);
+        REQUIRE(segments[0].size == sizeof(words) + 1);
+        REQUIRE(segments[1].data == static_cast<const std::byte *>(static_cast<const void *>(bytes_be)));
+        REQUIRE(scratch[3] == std::byte{0});
+        REQUIRE(scratch[4 + 3] == std::byte{0x01});
+    }
+
+    // a larger threshold copies everything into one segment
+    count = serialize<endianness::big>(words, std::uint8_t{9}, bytes_be)
+        .to_segments<1024>(segments, 4, scratch, sizeof(scratch));
+    REQUIRE(count == 1);
+    REQUIRE(segments[0].size == sizeof(words) + 1 + sizeof(bytes_be));
+}
+
+#ifdef NDEBUG
+TEST_CASE("to_segments returns 0 when the segment list or scratch is too small") {
+    frame_payload payload{};
+    std::uint32_t crc = 1;
+    const_chunk segments[1]{};
+    std::byte scratch[8]{};
+    REQUIRE(serialize(crc, payload).to_segments(segments, 1, scratch, sizeof(scratch)) == 0);
+    REQUIRE(serialize(payload, crc).to_segments(segments, 2, scratch, 2) == 0);
+}
+#endif
@@ -0,0 +1,197 @@
+#include <catch2/catch_all.hpp>
+#include <cstdint>
+#include <cstring>
+#include <array>
+#include <tuple>
+#include "eser/flat/serializer.hpp"
+#include "eser/flat/deserializer.hpp"
+#include "eser/flat/encoder.hpp"
+#include "eser/flat/stream.hpp"
+
+using namespace eser::flat;
+using eser::utils::endianness;
+
+static_assert(is_sink_v<span_sink> and is_sink_v<chunk_sink> and is_sink_v<ring_sink>);
+static_assert(is_source_v<span_source> and is_source_v<chunk_source> and is_source_v<ring_source>);
+static_assert(not is_sink_v<span_source> and not is_source_v<span_sink>);
+static_assert(not is_sink_v<std::byte[8]> and not is_source_v<const std::byte*>);
+
+namespace {
+    struct telemetry { std::uint32_t id; float values[3]; };
+
+    constexpr std::uint32_t l_id = 0xA1B2C3D4;
+    constexpr double l_value = -12.5;
+    constexpr std::int16_t l_samples[5] = {1, -2, 3, -4, 5};
+    constexpr std::size_t l_message_size = 4 + 8 + 10;
+
+    template<endianness Wire>
+    std::array<std::byte, l_message_size> contiguous_reference()
+    {
+        std::array<std::byte, l_message_size> out{};
+        REQUIRE(serialize<Wire>(l_id, l_value, l_samples).to(out.data(), out.size()) == l_message_size);
+        return out;
+    }
+}
+
+TEST_CASE("chunk_sink writes the same bytes as a contiguous buffer, for every split point") {
+    const auto expected = contiguous_reference<endianness::big>();
+    for (std::size_t split = 0; split <= l_message_size; ++split) {
+        std::byte a[l_message_size]{}, b[l_message_size]{};
+        chunk regions[] = { {a, split}, {nullptr, 0}, {b, l_message_size - split} };
+        chunk_sink out(regions);
+
+        REQUIRE(serialize<endianness::big>(l_id, l_value, l_samples).to(out) == l_message_size);
+        REQUIRE(out.written() == l_message_size);
+        REQUIRE(out.available() == 0);
+        REQUIRE(std::memcmp(a, expected.data(), split) == 0);
+        REQUIRE(std::memcmp(b, expected.data() + split, l_message_size - split) == 0);
+    }
+}
+
+TEST_CASE("chunk_source reads a message split at every point") {
+    const auto wire = contiguous_reference<endianness::big>();
+    for (std::size_t split = 0; split <= l_message_size; ++split) {
+        const_chunk regions[] = { {wire.data(), split}, {wire.data() + split, l_message_size - split} };
+        chunk_source in(regions);
+        auto d = deserialize<endianness::big>(in);
+
+        auto id = d.to<std::uint32_t>();
+        auto value = d.to<double>();
+        auto samples = d.to<std::int16_t[5]>();
+        REQUIRE((id and value and samples));
+        REQUIRE(*id == l_id);
+        REQUIRE(*value == l_value);
+        REQUIRE(*samples == std::array<std::int16_t, 5>{1, -2, 3, -4, 5});
+        REQUIRE(in.consumed() == l_message_size);
+        REQUIRE_FALSE(d.to<std::uint8_t>());
+    }
+}
+
+TEST_CASE("ring_sink and ring_source wrap around the end of the storage") {
+    std::byte storage[32]{};
+    for (std::size_t head = 0; head < sizeof(storage); ++head) {
+        ring_sink tx(storage, sizeof(storage), head, sizeof(storage));
+        REQUIRE(serialize(l_id, l_value, l_samples).to(tx) == l_message_size);
+        REQUIRE(tx.position() == (head + l_message_size) % sizeof(storage));
+
+        ring_source rx(storage, sizeof(storage), head, l_message_size);
+        auto d = deserialize(rx);
+        auto fields = d.to<std::tuple<std::uint32_t, double, std::array<std::int16_t, 5>>>();
+        REQUIRE(fields);
+        REQUIRE(std::get<0>(*fields) == l_id);
+        REQUIRE(std::get<1>(*fields) == l_value);
+        REQUIRE(std::get<2>(*fields)[3] == -4);
+        REQUIRE(rx.position() == tx.position());
+        REQUIRE(rx.available() == 0);
+    }
+}
+
+TEST_CASE("span_sink keeps its cursor across messages") {
+    std::byte buffer[16]{};
+    span_sink out(buffer, sizeof(buffer));
+    REQUIRE(serialize(std::uint16_t{0x0102}).to(out) == 2);
+    REQUIRE(serialize(std::uint32_t{0x03040506}).to(out) == 4);
+    REQUIRE(out.written() == 6);
+
+    span_source in(buffer, out.written());
+    auto d = deserialize(in);
+    REQUIRE(d.to<std::uint16_t>() == std::uint16_t{0x0102});
+    REQUIRE(d.to<std::uint32_t>() == std::uint32_t{0x03040506});
+    REQUIRE(d.available() == 0);
+}
+
+TEST_CASE("native structs straddling a boundary are copied across it unchanged") {
+    telemetry records[4]{};
+    for (std::uint32_t i = 0; i < 4; ++i) records[i] = {i, {i * 1.f, i * 2.f, i * 3.f}};
+
+    std::byte storage[sizeof(records) + 8]{};
+    ring_sink tx(storage, sizeof(storage), sizeof(storage) - 7, sizeof(storage));
+    REQUIRE(serialize_range(records).to(tx) == sizeof(records));
+
+    ring_source rx(storage, sizeof(storage), sizeof(storage) - 7, sizeof(records));
+    telemetry decoded[4]{};
+    REQUIRE(deserialize(rx).to_range(decoded, 4));
+    for (std::uint32_t i = 0; i < 4; ++i) {
+        REQUIRE(decoded[i].id == i);
+        REQUIRE(decoded[i].values[2] == i * 3.f);
+    }
+}
+
+TEST_CASE("big-endian ranges and bools survive chunk boundaries") {
+    std::uint32_t words[6] = {1, 0x01020304, 3, 0xFFFFFFFF, 5, 6};
+    std::byte a[5]{}, b[19]{};
+    chunk regions[] = { {a, sizeof(a)}, {b, sizeof(b)} };
+    chunk_sink out(regions);
+    REQUIRE(serialize_range<endianness::big>(words).to(out) == sizeof(words));
+    REQUIRE(a[4] == std::byte{0x01});
+    REQUIRE(b[0] == std::byte{0x02});
+
+    const_chunk in_regions[] = { {a, sizeof(a)}, {b, sizeof(b)} };
+    chunk_source in(in_regions);
+    std::uint32_t decoded[6]{};
+    REQUIRE(deserialize<endianness::big>(in).to_range(decoded, 6));
+    REQUIRE(std::memcmp(decoded, words, sizeof(words)) == 0);
+
+    const std::byte flags[] = {std::byte{0}, std::byte{7}};
+    const_chunk flag_regions[] = { {flags, 1}, {flags + 1, 1} };
+    chunk_source flag_source(flag_regions);
+    auto d = deserialize(flag_source);
+    auto both = d.to<std::tuple<bool, bool>>();
+    REQUIRE(both);
+    REQUIRE(std::get<0>(*both) == false);
+    REQUIRE(std::get<1>(*both) == true);
+}
+
+TEST_CASE("encoder writes into a sink") {
+    std::uint16_t seq = 0;
+    float level = 0.25f;
+    auto enc = make_encoder<endianness::big>(seq, level);
+
+    std::byte storage[8]{};
+    ring_sink tx(storage, sizeof(storage), 5, sizeof(storage));
+    seq = 0xBEEF;
+    REQUIRE(enc.encode_into(tx) == 6);
+
+    ring_source rx(storage, sizeof(storage), 5, 6);
+    auto d = deserialize<endianness::big>(rx);
+    REQUIRE(d.to<std::uint16_t>() == std::uint16_t{0xBEEF});
+    REQUIRE(d.to<float>() == 0.25f);
+}
+
+TEST_CASE("a zero-capacity ring refuses every value without dividing by its capacity") {
+    std::byte storage[1]{}, bytes[1]{};
+    ring_sink tx(storage, 0, 0, 0);
+    REQUIRE(tx.available() == 0);
+    tx.write(bytes, 0);
+    REQUIRE(tx.position() == 0);
+
+    ring_source rx(storage, 0, 0, 0);
+    REQUIRE_FALSE(deserialize(rx).to<std::uint8_t>());
+    rx.read(bytes, 0);
+    REQUIRE(rx.position() == 0);
+}
+
+TEST_CASE("a source shorter than the value yields nullopt and consumes nothing") {
+    const std::byte bytes[3]{};
+    const_chunk regions[] = { {bytes, 1}, {bytes + 1, 2} };
+    chunk_source in(regions);
+    auto d = deserialize(in);
+    REQUIRE_FALSE(d.to<std::uint32_t>());
+    std::uint16_t pair[2]{};
+    REQUIRE_FALSE(d.to_range(pair, 2));
+    REQUIRE(in.available() == 3);
+}
+
+#ifdef NDEBUG
+TEST_CASE("a sink with too little room returns 0 and writes nothing") {
+    std::byte a[2]{}, b[1]{};
+    chunk regions[] = { {a, sizeof(a)}, {b, sizeof(b)} };
+    chunk_sink out(regions);
+    REQUIRE(serialize(std::uint32_t{0xFFFFFFFF}).to(out) == 0);
+    REQUIRE(out.written() == 0);
+    REQUIRE(a[0] == std::byte{0});
+
+    std::uint16_t words[2] = {1, 2};
+    REQUIRE(serialize_range(words).to(out) == 0);
+}
+#endif
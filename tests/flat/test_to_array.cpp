@@ -0,0 +1,140 @@
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include "eser/flat/flat.hpp"
+#include "eser/utils/fixed_string.hpp"
+#include "eser/utils/reflect.hpp"
+
+using namespace eser::flat;
+using eser::utils::fixed_string;
+
+namespace {
+    enum class mode : std::uint16_t { idle = 1, run = 0x0203 };
+
+    struct gain{
+        std::uint8_t channel;
+        std::uint32_t scale;
+    };
+    ESER_REFLECT(gain, channel, scale);
+
+    struct packed_gain{
+        std::uint8_t channel;
+        std::uint32_t scale;
+    };
+    ESER_REFLECT_PACKED(packed_gain, channel, scale);
+
+    struct raw_pair{
+        std::uint16_t a;
+        std::uint16_t b;
+    };
+
+    // Same layout as `gain`: three padding bytes. Bit-casting them is not a constant expression,
+    // so to_array rejects it with a static_assert; `gain` is the ESER_REFLECT way to encode it.
+    struct padded_raw{
+        std::uint8_t channel;
+        std::uint32_t scale;
+    };
+    static_assert(not std::has_unique_object_representations_v<padded_raw>);
+    static_assert(std::has_unique_object_representations_v<raw_pair>);
+
+    constexpr auto padded = serialize<endianness::little>(gain{1, 2}).to_array();
+    static_assert(padded.size() == sizeof(gain));
+    static_assert(padded[0] == std::byte{1} and padded[1] == std::byte{0} and padded[3] == std::byte{0});
+    static_assert(padded[4] == std::byte{2} and padded[7] == std::byte{0});
+
+    constexpr std::array<std::uint16_t, 4> gains = {1024, 1019, 1031, 998};
+    constexpr gain calibration[2] = {{1, 0x01020304}, {2, 0x05060708}};
+
+    constexpr auto integers = serialize<endianness::big>(std::uint32_t{0x11223344}, std::int16_t{-2}, true).to_array();
+    static_assert(integers.size() == 7);
+    static_assert(integers[0] == std::byte{0x11} and integers[3] == std::byte{0x44});
+    static_assert(integers[4] == std::byte{0xFF} and integers[5] == std::byte{0xFE});
+    static_assert(integers[6] == std::byte{1});
+
+    constexpr auto table = serialize(gains, mode::run).to_array();
+    static_assert(table.size() == 10);
+    static_assert(table[0] == std::byte{0x00} and table[1] == std::byte{0x04});   // 1024, little-endian
+    static_assert(table[8] == std::byte{0x03} and table[9] == std::byte{0x02});
+
+    constexpr auto described = serialize<endianness::big>(calibration).to_array();
+    static_assert(described.size() == 2 * sizeof(gain));
+    static_assert(described[0] == std::byte{1} and described[1] == std::byte{0});  // padding is zero
+    static_assert(described[4] == std::byte{0x01} and described[7] == std::byte{0x04});
+
+    constexpr auto packed = serialize<endianness::big>(packed_gain{3, 0x0A0B0C0D}).to_array();
+    static_assert(packed.size() == 5);
+    static_assert(packed[0] == std::byte{3} and packed[1] == std::byte{0x0A} and packed[4] == std::byte{0x0D});
+
+    constexpr auto name = serialize(fixed_string<6>("imu")).to_array();
+    static_assert(name.size() == 6 and name[2] == std::byte{'u'} and name[3] == std::byte{0});
+
+#if defined(ESER_CONSTEXPR_BIT_CAST)
+    constexpr auto real = serialize<endianness::big>(1.0f, -2.0).to_array();
+    static_assert(real[0] == std::byte{0x3F} and real[1] == std::byte{0x80} and real[3] == std::byte{0});
+    static_assert(real[4] == std::byte{0xC0} and real[11] == std::byte{0});
+
+    constexpr auto raw = serialize<eser::internal::host_endianness>(raw_pair{1, 2}).to_array();
+    static_assert(raw.size() == 4);
+#endif
+
+    template<std::size_t N>
+    bool same_bytes(const std::array<std::byte, N> &blob, const std::byte *expected, std::size_t n) {
+        return n == N and std::memcmp(blob.data(), expected, N) == 0;
+    }
+}
+
+TEST_CASE("to_array produces the bytes to() writes") {
+    std::byte expected[64];
+
+    std::size_t n = serialize<endianness::big>(std::uint32_t{0x11223344}, std::int16_t{-2}, true).to(expected);
+    REQUIRE(same_bytes(integers, expected, n));
+
+    n = serialize(gains, mode::run).to(expected);
+    REQUIRE(same_bytes(table, expected, n));
+
+    n = serialize<endianness::big>(calibration).to(expected);
+    REQUIRE(same_bytes(described, expected, n));
+
+    n = serialize<endianness::big>(packed_gain{3, 0x0A0B0C0D}).to(expected);
+    REQUIRE(same_bytes(packed, expected, n));
+
+    n = serialize(fixed_string<6>("imu")).to(expected);
+    REQUIRE(same_bytes(name, expected, n));
+
+#if defined(ESER_CONSTEXPR_BIT_CAST)
+    n = serialize<eser::internal::host_endianness>(raw_pair{1, 2}).to(expected);
+    REQUIRE(same_bytes(raw, expected, n));
+#endif
+}
+
+TEST_CASE("to_array encodes a padded struct through ESER_REFLECT with zero padding") {
+    std::byte expected[sizeof(gain)];
+    const std::size_t n = serialize<endianness::little>(gain{1, 2}).to(expected);
+    REQUIRE(n == padded.size());
+    REQUIRE(expected[0] == padded[0]);
+    REQUIRE(std::memcmp(expected + offsetof(gain, scale), padded.data() + offsetof(gain, scale), sizeof(std::uint32_t)) == 0);
+}
+
+TEST_CASE("to_array encodes floating-point fields in either byte order") {
+    std::byte expected[16];
+    for (float value : {0.0f, -1.5f, 3.14159f, 1e-30f}) {
+        std::size_t n = serialize<endianness::big>(value, static_cast<double>(value)).to(expected);
+        REQUIRE(same_bytes(serialize<endianness::big>(value, static_cast<double>(value)).to_array(), expected, n));
+        n = serialize<endianness::little>(value, static_cast<double>(value)).to(expected);
+        REQUIRE(same_bytes(serialize<endianness::little>(value, static_cast<double>(value)).to_array(), expected, n));
+    }
+}
+
+TEST_CASE("to_array reads back with deserialize") {
+    static constexpr auto blob = serialize<endianness::big>(std::uint8_t{2}, gains, 0.5f, mode::idle).to_array();
+    auto fields = deserialize<endianness::big>(blob.data(), blob.size())
+        .to<std::tuple<std::uint8_t, std::array<std::uint16_t, 4>, float, mode>>();
+    REQUIRE(fields);
+    REQUIRE(std::get<0>(*fields) == 2);
+    REQUIRE(std::get<1>(*fields) == gains);
+    REQUIRE(std::get<2>(*fields) == 0.5f);
+    REQUIRE(std::get<3>(*fields) == mode::idle);
+}
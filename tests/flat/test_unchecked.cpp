@@ -0,0 +1,88 @@
+#include <catch2/catch_all.hpp>
+#include <array>
+#include <cstdint>
+#include <tuple>
+#include "eser/flat/serializer.hpp"
+#include "eser/flat/deserializer.hpp"
+#include "eser/utils/bits.hpp"
+
+using namespace eser::flat;
+using eser::utils::bits;
+
+namespace {
+    struct telemetry {
+        std::uint16_t sensor;
+        float value;
+    };
+}
+
+TEST_CASE("unchecked reads return values directly and match the checked reads") {
+    std::byte buffer[32];
+    const std::size_t n = serialize<endianness::big>(std::uint32_t{0xA1B2C3D4u}, std::int16_t{-5}, 2.5f, true).to(buffer);
+
+    auto d = deserialize<endianness::big>(unchecked, buffer, n);
+    STATIC_REQUIRE(std::is_same_v<decltype(d.to<std::uint32_t>()), std::uint32_t>);
+    REQUIRE(d.to<std::uint32_t>() == 0xA1B2C3D4u);
+    auto [s, f, b] = d.to<std::tuple<std::int16_t, float, bool>>();
+    REQUIRE(s == -5);
+    REQUIRE(f == 2.5f);
+    REQUIRE(b);
+}
+
+TEST_CASE("claim checks the length once and moves the checked cursor past the claim") {
+    std::byte buffer[32];
+    const std::size_t n = serialize(std::uint32_t{7}, std::uint16_t{9}, 1.5f, std::uint8_t{0xEE}).to(buffer);
+
+    auto d = deserialize(buffer, n);
+    auto m = d.claim<std::uint32_t, std::uint16_t, float>();
+    REQUIRE(m);
+    REQUIRE(m->to<std::uint32_t>() == 7);
+    REQUIRE(m->to<std::tuple<std::uint16_t, float>>() == std::make_tuple(std::uint16_t{9}, 1.5f));
+    REQUIRE(d.to<std::uint8_t>() == std::uint8_t{0xEE});   // the checked reader resumes after it
+
+    auto short_read = deserialize(buffer, 9);
+    REQUIRE_FALSE(short_read.claim<std::uint32_t, std::uint16_t, float>());
+    REQUIRE(short_read.to<std::uint32_t>() == 7);           // a failed claim consumes nothing
+}
+
+TEST_CASE("claim(bytes) covers a batch read with to_range") {
+    telemetry records[3] = {{1, 0.5f}, {2, 1.5f}, {3, 2.5f}};
+    std::uint16_t flags[4] = {0x0102, 0x0304, 0x0506, 0x0708};
+    std::byte buffer[64];
+    const std::size_t a = serialize_range(records).to(buffer);
+    const std::size_t b = serialize_range<endianness::big>(flags).to(buffer + a, sizeof(buffer) - a);
+
+    auto d = deserialize(buffer, a + b);
+    auto rows = d.claim(3 * serialized_size_of<telemetry>());
+    REQUIRE(rows);
+    telemetry out[3] = {};
+    rows->to_range(out, 3);
+    for (std::size_t i = 0; i < 3; ++i) {
+        REQUIRE(out[i].sensor == records[i].sensor);
+        REQUIRE(out[i].value == records[i].value);
+    }
+    REQUIRE_FALSE(d.claim(b + 1));
+
+    auto swapped = deserialize<endianness::big>(unchecked, buffer + a, b);
+    std::uint16_t flags_out[4] = {};
+    swapped.to_range(flags_out, 4);
+    for (std::size_t i = 0; i < 4; ++i) REQUIRE(flags_out[i] == flags[i]);
+}
+
+TEST_CASE("unchecked tuple reads unpack bit groups and C-arrays") {
+    using flag = bits<1, bool>;
+    using level = bits<12, std::uint16_t>;
+    std::byte buffer[16];
+    const std::uint16_t levels[2] = {300, 400};
+    const std::size_t n = serialize<endianness::big>(flag{true}, level{0xABC}, std::uint16_t{0xBEEF}, levels).to(buffer);
+    REQUIRE(n == 2 + 2 + 4);
+
+    auto d = deserialize<endianness::big>(buffer, n);
+    auto m = d.claim<flag, level, std::uint16_t, std::array<std::uint16_t, 2>>();
+    REQUIRE(m);
+    auto [f, l, word] = m->to<std::tuple<flag, level, std::uint16_t>>();
+    REQUIRE(f.value());
+    REQUIRE(l.value() == 0xABC);
+    REQUIRE(word == 0xBEEF);
+    REQUIRE(m->to<std::uint16_t[2]>() == std::array<std::uint16_t, 2>{300, 400});
+}
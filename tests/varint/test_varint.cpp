@@ -0,0 +1,167 @@
+#include <catch2/catch_all.hpp>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include "eser/varint/varint.hpp"
+
+using namespace eser::varint;
+
+static_assert(max_serialized_size_of<std::uint8_t>() == 2);
+static_assert(max_serialized_size_of<std::int16_t>() == 3);
+static_assert(max_serialized_size_of<std::uint32_t>() == 5);
+static_assert(max_serialized_size_of<std::int64_t>() == 10);
+static_assert(max_serialized_size_of<bool, float, double>() == 13);
+static_assert(max_serialized_size_of<std::uint16_t[4]>() == 12);
+static_assert(max_serialized_size_of<std::array<std::uint32_t, 2>, std::uint8_t>() == 12);
+static_assert(serialized_size(std::uint32_t{127}) == 1);
+static_assert(serialized_size(std::uint32_t{128}) == 2);
+static_assert(serialized_size(std::int32_t{-64}, std::int32_t{64}) == 3);
+
+namespace {
+    enum class mode : std::uint16_t { off = 0, burst = 500 };
+    enum class trim : std::int8_t { down = -3, up = 3 };
+
+    template<typename T>
+    void round_trip(T value, std::size_t padding)
+    {
+        std::byte buffer[32]{};
+        const std::size_t written = serialize(value).to(buffer);
+        REQUIRE(written == serialized_size(value));
+        // `padding` trailing bytes select the word-at-a-time path (>= 8 readable) or the byte loop
+        auto decoded = deserialize(buffer, written + padding).template to<T>();
+        REQUIRE(decoded);
+        REQUIRE(*decoded == value);
+    }
+}
+
+TEST_CASE("varint encodes the canonical LEB128 and zigzag byte sequences") {
+    std::byte buffer[16]{};
+    REQUIRE(serialize(std::uint32_t{300}).to(buffer) == 2);
+    REQUIRE(buffer[0] == std::byte{0xAC});
+    REQUIRE(buffer[1] == std::byte{0x02});
+
+    REQUIRE(serialize(std::int32_t{-1}).to(buffer) == 1);
+    REQUIRE(buffer[0] == std::byte{0x01});
+    REQUIRE(serialize(std::int32_t{1}).to(buffer) == 1);
+    REQUIRE(buffer[0] == std::byte{0x02});
+    REQUIRE(serialize(std::int32_t{-64}).to(buffer) == 1);
+    REQUIRE(buffer[0] == std::byte{0x7F});
+
+    REQUIRE(serialize(std::numeric_limits<std::uint64_t>::max()).to(buffer) == 10);
+    REQUIRE(buffer[9] == std::byte{0x01});
+    REQUIRE(serialize(std::numeric_limits<std::int64_t>::min()).to(buffer) == 10);
+}
+
+TEST_CASE("varint round-trips every width through both decode paths") {
+    for (std::size_t padding : {std::size_t{0}, std::size_t{16}}) {
+        for (int shift = 0; shift < 64; ++shift) {
+            const std::uint64_t v = std::uint64_t{1} << shift;
+            round_trip<std::uint64_t>(v, padding);
+            round_trip<std::uint64_t>(v - 1, padding);
+            round_trip<std::int64_t>(static_cast<std::int64_t>(v), padding);
+            round_trip<std::int64_t>(-static_cast<std::int64_t>(v - 1), padding);
+            round_trip<std::uint32_t>(static_cast<std::uint32_t>(v), padding);
+            round_trip<std::int32_t>(static_cast<std::int32_t>(v), padding);
+            round_trip<std::uint16_t>(static_cast<std::uint16_t>(v), padding);
+            round_trip<std::int8_t>(static_cast<std::int8_t>(v), padding);
+        }
+        round_trip(std::numeric_limits<std::int64_t>::min(), padding);
+        round_trip(std::numeric_limits<std::int64_t>::max(), padding);
+        round_trip(std::numeric_limits<std::int16_t>::min(), padding);
+        round_trip(std::numeric_limits<std::uint8_t>::max(), padding);
+        round_trip(mode::burst, padding);
+        round_trip(trim::down, padding);
+    }
+}
+
+TEST_CASE("varint mixes fixed-width fields, bools and arrays") {
+    const std::uint16_t levels[3] = {1, 200, 40000};
+    std::array<std::int32_t, 2> deltas{-5, 70000};
+    std::byte buffer[max_serialized_size_of<bool, float, std::uint16_t[3], std::array<std::int32_t, 2>>()]{};
+
+    const std::size_t written = serialize(true, 2.5f, levels, deltas).to(buffer);
+    REQUIRE(written == 1 + 4 + (1 + 2 + 3) + (1 + 3));
+
+    auto d = deserialize(buffer, written);
+    auto fields = d.to<std::tuple<bool, float, std::array<std::uint16_t, 3>>>();
+    REQUIRE(fields);
+    REQUIRE(std::get<0>(*fields));
+    REQUIRE(std::get<1>(*fields) == 2.5f);
+    REQUIRE(std::get<2>(*fields)[2] == 40000);
+    auto tail = d.to<std::int32_t[2]>();
+    REQUIRE(tail);
+    REQUIRE(*tail == deltas);
+    REQUIRE(d.available() == 0);
+}
+
+TEST_CASE("varint rejects truncated, too long, non-minimal and out-of-range input without consuming it") {
+    const std::byte truncated[] = {std::byte{0x80}, std::byte{0x80}};
+    auto d1 = deserialize(truncated);
+    REQUIRE_FALSE(d1.to<std::uint32_t>());
+    REQUIRE(d1.available() == 2);
+
+    std::byte overlong[16];
+    std::memset(overlong, 0x80, sizeof(overlong));
+    REQUIRE_FALSE(deserialize(overlong).to<std::uint64_t>());
+    REQUIRE_FALSE(deserialize(overlong).to<std::uint16_t>());
+    REQUIRE_FALSE(deserialize(overlong, 9).to<std::uint64_t>());
+
+    std::byte buffer[16]{};
+    const std::size_t written = serialize(std::uint32_t{300}).to(buffer);
+    REQUIRE_FALSE(deserialize(buffer, written).to<std::uint8_t>());
+    REQUIRE_FALSE(deserialize(buffer).to<std::uint8_t>());
+    REQUIRE(deserialize(buffer).to<std::uint16_t>() == std::uint16_t{300});
+
+    // a tenth byte may only carry the top bit of a uint64_t
+    std::byte too_wide[10];
+    std::memset(too_wide, 0xFF, 9);
+    too_wide[9] = std::byte{0x02};
+    REQUIRE_FALSE(deserialize(too_wide).to<std::uint64_t>());
+
+    // non-minimal encodings (a zero terminating byte after the first), in both decode paths
+    const std::byte zero_padded[] = {std::byte{0x80}, std::byte{0x00}};
+    auto d3 = deserialize(zero_padded);
+    REQUIRE_FALSE(d3.to<std::uint32_t>());
+    REQUIRE(d3.available() == 2);
+    std::byte padded_word[16]{};
+    padded_word[0] = std::byte{0x81};
+    padded_word[1] = std::byte{0x80};
+    REQUIRE_FALSE(deserialize(padded_word).to<std::uint32_t>());               // 81 80 00: 1 in three bytes
+    REQUIRE_FALSE(deserialize(padded_word, 3).to<std::uint32_t>());
+    REQUIRE_FALSE(deserialize(padded_word).to<std::int16_t>());
+    padded_word[1] = std::byte{0x01};
+    REQUIRE(deserialize(padded_word).to<std::uint32_t>() == std::uint32_t{129}); // 81 01 is minimal
+    REQUIRE(deserialize(padded_word, 2).to<std::uint32_t>() == std::uint32_t{129});
+    std::byte zero_tenth[10];
+    std::memset(zero_tenth, 0xFF, 9);
+    zero_tenth[9] = std::byte{0x00};
+    REQUIRE_FALSE(deserialize(zero_tenth).to<std::uint64_t>());
+
+    // a failing tuple element leaves the cursor at the start of the tuple
+    serialize(std::uint8_t{7}, std::uint32_t{300}).to(buffer);
+    auto d2 = deserialize(buffer, 3);
+    REQUIRE_FALSE((d2.to<std::tuple<std::uint8_t, std::uint8_t>>()));
+    REQUIRE(d2.available() == 3);
+    REQUIRE(d2.to<std::uint8_t>() == std::uint8_t{7});
+}
+
+TEST_CASE("varint sizes small values far below their fixed width") {
+    std::uint64_t ids[4] = {1, 2, 3, 4};
+    std::byte buffer[max_serialized_size_of<std::uint64_t[4]>()]{};
+    REQUIRE(sizeof(buffer) == 40);
+    REQUIRE(serialize(ids).to(buffer) == 4);
+
+    // a buffer below the static bound is checked against the exact size instead
+    std::byte small[4]{};
+    REQUIRE(serialize(ids).to(small) == 4);
+}
+
+#ifdef NDEBUG
+TEST_CASE("varint returns 0 when the values do not fit") {
+    std::byte small[1]{};
+    REQUIRE(serialize(std::uint32_t{300}).to(small) == 0);
+    REQUIRE(small[0] == std::byte{0});
+}
+#endif
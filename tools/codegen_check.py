@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+"""Check the code generated for eser's encode/decode cases against checked-in budgets.
+
+Compiles codegen/cases.cpp to assembly with one compiler per target, measures every
+`extern "C"` case function, and compares it with codegen/budgets.json:
+
+  max_instructions   upper bound on the number of instructions in the function
+  max_loops          backward branches inside the function (0 = straight-line code)
+  max_calls          calls and tail calls out of the function (0 = fully inlined)
+
+Any call target is reported by name, so a template change that stops inlining (e.g. an
+out-of-line `reverse_bytes` or `memcpy`) is visible in the failure message.
+
+Usage:
+  codegen_check.py --target x86-64 --cxx g++ [--cxx-flag=...] [--update]
+
+--update rewrites the budgets of the given target from the current compiler output,
+with a small headroom on the instruction count; review the diff before committing it.
+
+Every case in codegen/cases.cpp is measured. On a target with budgets, a case without one
+and a budget whose case no longer exists both fail the check ("run --update"). A target
+with no budgets at all reports each case as "no budget, run --update" and does not fail:
+budgets are only checked in once measured on a real toolchain.
+"""
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+CASES = os.path.join(ROOT, "codegen", "cases.cpp")
+BUDGETS = os.path.join(ROOT, "codegen", "budgets.json")
+
+# Per-target instruction classes. A "jump" whose operand is not a local label is a tail call.
+ARCH = {
+    "x86-64": {
+        "calls": {"call", "callq"},
+        "jumps": re.compile(r"^(j[a-z]+|loop[a-z]*)$"),
+        "extra_flags": [],
+    },
+    "aarch64": {
+        "calls": {"bl", "blr"},
+        "jumps": re.compile(r"^(b(\.[a-z]+)?|br|cbn?z|tbn?z)$"),
+        "extra_flags": [],
+    },
+    "xtensa": {
+        "calls": {"call0", "call4", "call8", "call12", "callx0", "callx4", "callx8", "callx12"},
+        "jumps": re.compile(r"^(j|jx|b[a-z]+(\.n)?|loop|loopnez|loopgtz)$"),
+        "extra_flags": ["-mlongcalls"],
+    },
+}
+
+LABEL = re.compile(r"^([A-Za-z_.$][\w.$]*):")
+LOCAL = re.compile(r"^\.L[\w.$]*$")
+
+
+def compile_to_asm(cxx, target, flags):
+    command = [cxx, "-std=c++17", "-O2", "-S", "-o", "-", "-I", ROOT,
+               "-fno-asynchronous-unwind-tables", "-fno-exceptions"]
+    command += ARCH[target]["extra_flags"] + flags + [CASES]
+    result = subprocess.run(command, capture_output=True, text=True)
+    if result.returncode != 0:
+        sys.stderr.write(result.stderr)
+        sys.exit(f"codegen_check: compiling {CASES} with {cxx} failed")
+    return result.stdout.splitlines()
+
+
+def split_functions(lines, names):
+    """Map each case name to the instruction lines (and labels) of its body."""
+    bodies, current = {}, None
+    for line in lines:
+        stripped = line.strip()
+        label = LABEL.match(stripped)
+        if label and label.group(1) in names:
+            current = label.group(1)
+            bodies[current] = []
+            continue
+        if current is None:
+            continue
+        if stripped.startswith(".size") or stripped.startswith(".cfi_endproc") or stripped == ".end":
+            current = None
+            continue
+        bodies[current].append(stripped)
+    return bodies
+
+
+def measure(body, target):
+    arch = ARCH[target]
+    labels, instructions = {}, []
+    for stripped in body:
+        if not stripped or stripped.startswith(("#", "//", "@", ";")):
+            continue
+        label = LABEL.match(stripped)
+        if label:
+            labels[label.group(1)] = len(instructions)
+            continue
+        if stripped.startswith("."):
+            continue  # assembler directive
+        stripped = stripped.split("#")[0].split("//")[0].strip()
+        parts = stripped.split(None, 1)
+        instructions.append((parts[0].lower(), parts[1].strip() if len(parts) > 1 else ""))
+
+    loops, calls = 0, []
+    for index, (mnemonic, operands) in enumerate(instructions):
+        operand_list = [o.strip() for o in operands.split(",") if o.strip()]
+        target_operand = operand_list[-1] if operand_list else ""
+        if mnemonic in arch["calls"]:
+            calls.append(target_operand or mnemonic)
+        elif arch["jumps"].match(mnemonic):
+            if target_operand in labels:
+                loops += labels[target_operand] <= index
+            elif not LOCAL.match(target_operand) and mnemonic not in ("ret", "retw", "retw.n"):
+                calls.append(f"{mnemonic} {target_operand}")  # tail call or indirect jump
+    return {"instructions": len(instructions), "loops": loops, "calls": calls}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--target", required=True, choices=sorted(ARCH))
+    parser.add_argument("--cxx", required=True, help="C++ compiler for the target")
+    parser.add_argument("--cxx-flag", action="append", default=[], help="extra compiler flag (repeatable)")
+    parser.add_argument("--update", action="store_true", help="rewrite this target's budgets from the current output")
+    args = parser.parse_args()
+
+    with open(BUDGETS) as file:
+        budgets = json.load(file)
+    # keys starting with "_" are comments
+    target_budgets = {k: v for k, v in budgets.get(args.target, {}).items() if not k.startswith("_")}
+    with open(CASES) as file:
+        names = set(re.findall(r"\b(eser_\w+)\(", file.read()))
+
+    bodies = split_functions(compile_to_asm(args.cxx, args.target, args.cxx_flag), names)
+    results = {name: measure(body, args.target) for name, body in sorted(bodies.items())}
+
+    missing = sorted(names - set(results))
+    if missing:
+        sys.exit(f"codegen_check: functions not found in the assembly: {', '.join(missing)}")
+
+    if args.update:
+        notes = {k: v for k, v in budgets.get(args.target, {}).items() if k.startswith("_")}
+        budgets[args.target] = notes | {
+            name: {
+                "max_instructions": result["instructions"] + max(2, result["instructions"] // 5),
+                "max_loops": result["loops"],
+                "max_calls": len(result["calls"]),
+            }
+            for name, result in results.items()
+        }
+        with open(BUDGETS, "w") as file:
+            json.dump(budgets, file, indent=4, sort_keys=True)
+            file.write("\n")
+        print(f"codegen_check: updated {len(results)} budgets for {args.target}")
+        return 0
+
+    failures = 0
+    # a target that was never measured only reports; a measured one must cover every case
+    measured = bool(target_budgets)
+    print(f"{'case':28} {'instr':>12} {'loops':>8} {'calls':>8}   [{args.target}, {args.cxx}]")
+    for name, result in results.items():
+        budget = target_budgets.get(name)
+        if budget is None:
+            failures += measured
+            print(f"{name:28} {result['instructions']:>5}/{'-':<6} {result['loops']:>3}/{'-':<4} "
+                  f"{len(result['calls']):>3}/{'-':<4} {'FAIL: ' if measured else ''}no budget, run --update")
+            continue
+        problems = []
+        if result["instructions"] > budget["max_instructions"]:
+            problems.append(f"{result['instructions']} instructions > {budget['max_instructions']}")
+        if result["loops"] > budget["max_loops"]:
+            problems.append(f"{result['loops']} loops > {budget['max_loops']}")
+        if len(result["calls"]) > budget["max_calls"]:
+            problems.append(f"calls {'; '.join(demangle(result['calls']))}")
+        status = "ok" if not problems else "FAIL: " + "; ".join(problems)
+        failures += bool(problems)
+        print(f"{name:28} {result['instructions']:>5}/{budget['max_instructions']:<6} "
+              f"{result['loops']:>3}/{budget['max_loops']:<4} {len(result['calls']):>3}/{budget['max_calls']:<4} {status}")
+    for name in sorted(set(target_budgets) - names):
+        failures += 1
+        print(f"{name:28} {'-':>12} {'-':>8} {'-':>8}   FAIL: stale budget, the case is gone; run --update")
+    return 1 if failures else 0
+
+
+def demangle(names):
+    """Demangle C++ symbols with c++filt when it is available; return them unchanged otherwise."""
+    try:
+        result = subprocess.run(["c++filt"], input="\n".join(names), capture_output=True, text=True)
+        return result.stdout.splitlines() if result.returncode == 0 else names
+    except OSError:
+        return names
+
+
+if __name__ == "__main__":
+    sys.exit(main())